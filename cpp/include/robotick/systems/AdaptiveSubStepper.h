@@ -0,0 +1,88 @@
+// Copyright Robotick contributors
+// SPDX-License-Identifier: Apache-2.0
+//
+// AdaptiveSubStepper: fixed-timestep catch-up for a simulation stepped from a slower tick. Each tick owes
+// nominal_steps * timestep of sim time; steps are taken until that debt is repaid, max_steps_per_tick is
+// reached or (unless deterministic) the next step would overrun tick_budget_ns. Unpaid debt carries over,
+// up to max_debt_sec - anything beyond is dropped so a slow host can't spiral. MuJoCoPhysicsWorkload
+// drives mj_step through it; the step itself is a callable so the bookkeeping can be tested on its own.
+
+#pragma once
+
+#include "robotick/framework/time/Clock.h"
+
+#include <cstdint>
+
+namespace robotick
+{
+	struct AdaptiveSubStepperConfig
+	{
+		double timestep_sec = 0.0;
+		uint32_t max_steps_per_tick = 1;
+		uint64_t tick_budget_ns = 0;
+		double max_debt_sec = 0.25;
+		bool deterministic = false; // true = ignore wall time, only max_steps_per_tick limits catch-up
+	};
+
+	class AdaptiveSubStepper
+	{
+	  public:
+		void configure(const AdaptiveSubStepperConfig& config)
+		{
+			config_ = config;
+			reset();
+		}
+
+		void reset()
+		{
+			debt_sec_ = 0.0;
+			dropped_sec_ = 0.0;
+		}
+
+		// Owe nominal_steps more steps, then call step() until repaid or a limit is hit. Returns the steps taken.
+		template <typename TStepFn> uint32_t tick(uint32_t nominal_steps, TStepFn&& step)
+		{
+			const double timestep = config_.timestep_sec;
+			if (timestep <= 0.0)
+				return 0;
+
+			const auto step_start_time = Clock::now();
+			double debt = debt_sec_ + static_cast<double>(nominal_steps) * timestep;
+
+			uint32_t steps = 0;
+			// Step while at least half a step is owed, so rounding never accumulates a phantom step.
+			while (debt >= 0.5 * timestep && steps < config_.max_steps_per_tick)
+			{
+				if (!config_.deterministic && steps >= 1)
+				{
+					const uint64_t elapsed_ns = Clock::to_nanoseconds(Clock::now() - step_start_time).count();
+					// Stop if the next step (estimated from the average so far) would overrun the budget.
+					if (elapsed_ns + elapsed_ns / steps > config_.tick_budget_ns)
+						break;
+				}
+
+				step();
+				debt -= timestep;
+				++steps;
+			}
+
+			if (debt > config_.max_debt_sec)
+			{
+				dropped_sec_ += debt - config_.max_debt_sec;
+				debt = config_.max_debt_sec;
+			}
+
+			debt_sec_ = debt;
+			return steps;
+		}
+
+		double get_debt_sec() const { return debt_sec_; }
+		double get_dropped_sec() const { return dropped_sec_; } // total since configure() / reset()
+
+	  private:
+		AdaptiveSubStepperConfig config_;
+		double debt_sec_ = 0.0;
+		double dropped_sec_ = 0.0;
+	};
+
+} // namespace robotick
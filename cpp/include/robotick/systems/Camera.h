@@ -8,6 +8,8 @@
 
 namespace robotick
 {
+	class FrameChangeDetector;
+
 	class Camera
 	{
 	  public:
@@ -31,6 +33,17 @@ namespace robotick
 		// On success, fills data_ptr/size with JPEG frame data
 		bool read_frame(uint8_t* dst_buffer, const size_t dst_capacity, size_t& out_size_used);
 
+		// As read_frame(), but scores the raw frame with change_detector first and only encodes it if the
+		// score reaches min_change_score or force_encode is set (the detector then adopts it as reference).
+		// Returns true if a frame was captured; out_size_used is 0 when it was skipped as unchanged.
+		bool read_frame_if_changed(uint8_t* dst_buffer,
+			const size_t dst_capacity,
+			FrameChangeDetector& change_detector,
+			const float min_change_score,
+			const bool force_encode,
+			size_t& out_size_used,
+			float& out_change_score);
+
 		// Print available camera IDs (friendly or index-based)
 		void print_available_cameras();
 
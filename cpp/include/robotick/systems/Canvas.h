@@ -3,8 +3,8 @@
 
 #pragma once
 
+#include "robotick/framework/containers/FixedVector.h"
 #include "robotick/framework/containers/HeapVector.h"
-#include "robotick/framework/containers/List.h"
 #include "robotick/framework/data/Blackboard.h"
 #include "robotick/framework/math/Vec2.h"
 #include "robotick/framework/strings/FixedString.h"
@@ -32,6 +32,43 @@ namespace robotick
 		Group,
 		Ellipse,
 		Rect,
+		Plot,
+	};
+
+	enum class CanvasPlotMode
+	{
+		Line,
+		Area,
+	};
+
+	using CanvasPlotSampleValues = FixedVector<float, 256>;
+
+	// Chunk type for plot controls bound to sample vectors (".append" / ".samples"). Producers bump sequence
+	// for every new chunk: ".append" takes a chunk once, when its sequence changes, so an output that is held
+	// across ticks (or ticks slower than the canvas) is not appended again.
+	struct CanvasPlotSamples
+	{
+		uint32_t sequence = 0; // 0 = no chunk yet
+		CanvasPlotSampleValues samples;
+	};
+
+	// Plot node storage: a ring of the most recent samples, drawn newest-rightmost across rect_w.
+	struct CanvasPlot
+	{
+		CanvasPlotMode mode = CanvasPlotMode::Line;
+		float value_min = 0.0f; // maps to the bottom edge
+		float value_max = 1.0f; // maps to the top edge
+		float baseline = 0.0f;	// Area mode fills between the trace and this value
+		uint32_t capacity = 0;
+		// Ring slots in the owning CanvasScene's sample pool.
+		float* samples = nullptr;
+		uint32_t head = 0; // next write slot
+		uint32_t count = 0;
+
+		void push(float value);
+		void clear() { head = count = 0; }
+		// i = 0 is the oldest retained sample.
+		float sample(uint32_t i) const { return samples[(head + capacity - count + i) % capacity]; }
 	};
 
 	struct CanvasNode
@@ -47,9 +84,19 @@ namespace robotick
 		Color fill = Colors::Black;
 		float ellipse_rx = 0.0f;
 		float ellipse_ry = 0.0f;
-		float rect_w = 0.0f;
+		float rect_w = 0.0f; // also the plot size
 		float rect_h = 0.0f;
-		HeapVector<CanvasNode*> children;
+		CanvasPlot plot;
+		// Points into the owning CanvasScene's child table; nodes never allocate individually.
+		CanvasNode* const* children = nullptr;
+		uint32_t child_count = 0;
+	};
+
+	// Binary cache for YAML scenes (see CanvasScene::load_from_file).
+	struct CanvasSceneCacheOptions
+	{
+		// Directory for cache files; nullptr writes "<scene>.canvasb" next to the YAML file.
+		const char* cache_dir = nullptr;
 	};
 
 	class CanvasScene
@@ -58,7 +105,17 @@ namespace robotick
 		CanvasScene();
 		~CanvasScene();
 
+		// Load a .canvas.yaml scene, or a binary scene written by save_binary() (recognised by its header).
 		bool load_from_file(const char* path);
+		// Load a YAML scene through its binary cache: reuse the cache when it was built from identical YAML
+		// content, otherwise parse the YAML and rewrite the cache.
+		bool load_from_file(const char* path, const CanvasSceneCacheOptions& cache_options, bool* out_cache_hit = nullptr);
+
+		// Write the loaded scene in the binary format. source_key records the YAML it came from (0 = none).
+		bool save_binary(const char* path, uint64_t source_key = 0) const;
+		// Content hash of a scene file as stored in binary caches; 0 if the file cannot be read.
+		static uint64_t compute_source_key(const char* path);
+		static bool get_cache_path(const char* scene_path, const CanvasSceneCacheOptions& cache_options, char* out_path, size_t out_path_size);
 
 		const CanvasSurface& surface() const { return surface_; }
 		const CanvasNode* root() const { return root_; }
@@ -82,6 +139,9 @@ namespace robotick
 			RotateDeg,
 			Visible,
 			Alpha,
+			PlotPush,	 // float: append one sample per apply
+			PlotAppend,	 // CanvasPlotSamples: append every sample of each new chunk (by sequence)
+			PlotSamples, // CanvasPlotSamples: replace the ring contents
 		};
 
 		struct NodeLookupEntry
@@ -95,11 +155,20 @@ namespace robotick
 			CanvasNode* node = nullptr;
 			ControlProperty property = ControlProperty::Translate;
 			FieldDescriptor* field = nullptr;
+			uint32_t last_sequence = 0; // PlotAppend: sequence of the last chunk appended
 		};
 
+		bool load_yaml(const char* path);
+		// expected_source_key 0 accepts any binary scene; otherwise the file must have been built from that content.
+		bool load_binary(const char* path, uint64_t expected_source_key);
+		void allocate_storage(size_t node_count, size_t control_count);
+		void set_control_alias(size_t index, const char* alias);
+
 		void parse_canvas_config(const YAML::Node& canvas_node);
-		CanvasNode* parse_node_recursive(const YAML::Node& node_yaml, size_t& next_index);
+		CanvasNode* parse_node_recursive(const YAML::Node& node_yaml, size_t& next_index, size_t& next_link_index);
 		void populate_lookup(CanvasNode& node, size_t& next_index);
+		void allocate_plot_storage();
+		void draw_plot(const CanvasNode& node, const Vec2f& center, const Vec2f& scale, float opacity, Renderer& renderer) const;
 		void parse_controls(const YAML::Node& controls_node);
 		ControlProperty parse_property_path(const char* path) const;
 		void parse_target(const char* target, ControlBinding& binding);
@@ -115,11 +184,16 @@ namespace robotick
 		CanvasNode* root_ = nullptr;
 
 		// Child pointers reference entries in nodes_; nodes_ must not be resized after population.
+		// Nodes are stored in pre-order; child_links_ holds every node's children as one contiguous run each.
 		HeapVector<CanvasNode> nodes_;
+		HeapVector<CanvasNode*> child_links_;
 		HeapVector<NodeLookupEntry> node_lookup_;
 		HeapVector<ControlBinding> control_bindings_;
-		List<FixedString64> alias_storage_;
+		HeapVector<FixedString64> alias_storage_;
 		HeapVector<const char*> control_aliases_;
+		// Ring storage for every plot node, and per-draw vertex scratch sized for the largest plot.
+		HeapVector<float> plot_sample_pool_;
+		mutable HeapVector<Vec2f> plot_scratch_;
 		FixedString256 source_path_;
 	};
 
@@ -0,0 +1,41 @@
+// Copyright Robotick contributors
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace robotick
+{
+	// Cheap "has the picture changed?" test for camera gating. Each frame is point-sampled onto a small
+	// luma grid (no full-frame pass, no allocation) and scored as the mean absolute difference against a
+	// reference grid: 0 = identical, 255 = maximal change. The reference only moves when accept() is
+	// called, so slow drift accumulates until it is big enough to publish rather than being lost.
+	class FrameChangeDetector
+	{
+	  public:
+		static constexpr int kGridWidth = 32;
+		static constexpr int kGridHeight = 24;
+
+		// Score a frame against the reference (returns 255 while there is none).
+		float measure_bgr888(const uint8_t* pixels, int width, int height, size_t row_stride_bytes);
+		// RGB565 with the high byte first, as delivered by the ESP32 camera driver.
+		float measure_rgb565_be(const uint8_t* pixels, int width, int height, size_t row_stride_bytes);
+
+		// Adopt the most recently measured frame as the new reference (i.e. it was published).
+		void accept();
+		void reset();
+
+		bool has_reference() const { return has_reference_; }
+
+	  private:
+		float score_current() const;
+
+		uint8_t reference_[kGridWidth * kGridHeight] = {};
+		uint8_t current_[kGridWidth * kGridHeight] = {};
+		bool has_reference_ = false;
+		bool has_current_ = false;
+	};
+
+} // namespace robotick
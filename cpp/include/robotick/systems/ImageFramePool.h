@@ -0,0 +1,184 @@
+// Copyright Robotick contributors
+// SPDX-License-Identifier: Apache-2.0
+//
+// ImageFramePool: preallocated, reference-counted image frames shared by handle.
+// A producer writes each frame once into a pool slot and publishes a small ImageHandle; data connections
+// then copy only the handle, and any number of consumers read the frame in place. Slots are recycled
+// once neither the pool (as "latest frame") nor any reader holds them. Pools are shared by name
+// through ImageFramePoolRegistry, and a handle carries its pool id so consumers need no extra config.
+
+#pragma once
+
+#include "robotick/api.h"
+#include "robotick/framework/concurrency/Sync.h"
+#include "robotick/framework/containers/HeapVector.h"
+#include "robotick/framework/memory/StdApproved.h"
+#include "robotick/framework/strings/FixedString.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace robotick
+{
+	enum class ImageFormat : uint8_t
+	{
+		Unknown,
+		Jpeg,
+		Png,
+		Rgb888,
+		Rgba8888,
+		DepthMetresF32,		 // float per pixel, distance from the camera plane
+		DepthMillimetresU16, // uint16_t per pixel, saturated at 65535
+		SegmentationU16		 // uint16_t per pixel: object id + 1, 0 = background
+	};
+
+	// What flows through data connections in place of the pixels. Copying it is cheap; reading the
+	// frame it names goes through ImageFramePool::acquire(). A default-constructed handle is invalid.
+	struct ImageHandle
+	{
+		uint16_t pool_id = 0; // ImageFramePoolRegistry id; 0 = no frame
+		uint16_t slot = 0;
+		uint32_t generation = 0; // bumped each time the slot is reused, so stale handles are detected
+		uint32_t size_bytes = 0;
+		uint16_t width = 0;
+		uint16_t height = 0;
+		ImageFormat format = ImageFormat::Unknown;
+
+		bool is_valid() const { return pool_id != 0; }
+	};
+
+	// A frame a reader holds a reference to. Valid until the matching release().
+	struct ImageFrameView
+	{
+		const uint8_t* data = nullptr;
+		size_t size = 0;
+		ImageHandle handle;
+
+		bool is_valid() const { return data != nullptr; }
+	};
+
+	class ImageFramePool
+	{
+	  public:
+		ImageFramePool() = default;
+		ImageFramePool(const ImageFramePool&) = delete;
+		ImageFramePool& operator=(const ImageFramePool&) = delete;
+
+		// Allocate every slot up front. Call once, before use. pool_id is stamped into published handles;
+		// generations continue from first_generation so a pool recreated under the same id rejects old handles.
+		void initialize(uint16_t pool_id, uint32_t slot_count, size_t slot_capacity_bytes, uint32_t first_generation = 0);
+
+		// Producer (single writer): claim a free slot and fill up to get_slot_capacity() bytes, then
+		// publish() or cancel_write(). Returns nullptr if every slot is still held by readers.
+		// Free slots are claimed round-robin, so a superseded frame nobody holds stays acquirable until the
+		// producer has cycled through the other free slots - roughly slot_count - 1 further frames. A reader
+		// that needs a frame for longer must acquire() it within that window.
+		uint8_t* begin_write();
+		// Make the claimed slot the latest frame and return its handle. The previous latest frame is
+		// recycled as soon as its last reader releases it.
+		ImageHandle publish(size_t size_bytes, ImageFormat format, uint16_t width, uint16_t height);
+		void cancel_write();
+
+		// Consumer: take a reference to the frame a handle names. Fails (returns an invalid view) if the
+		// handle is from another pool or its slot has since been recycled. Pair with release().
+		ImageFrameView acquire(const ImageHandle& handle);
+		void release(const ImageFrameView& view);
+
+		// Handle of the most recently published frame (invalid before the first publish).
+		ImageHandle get_latest() const;
+
+		uint16_t get_pool_id() const { return pool_id; }
+		uint32_t get_slot_count() const { return static_cast<uint32_t>(slots.size()); }
+		size_t get_slot_capacity() const { return slot_capacity; }
+		uint32_t get_free_slot_count() const;
+		uint32_t get_ref_count(const ImageHandle& handle) const;
+		uint32_t get_last_generation() const;
+
+	  private:
+		struct Slot
+		{
+			uint32_t generation = 0;
+			uint32_t ref_count = 0; // readers, plus one while this is the latest frame
+			bool is_writing = false;
+			ImageHandle handle;
+		};
+
+		Slot* find_slot(const ImageHandle& handle);
+		const Slot* find_slot(const ImageHandle& handle) const;
+
+		HeapVector<uint8_t> storage; // slot_count * slot_capacity, slot i at i * slot_capacity
+		HeapVector<Slot> slots;
+		size_t slot_capacity = 0;
+		uint16_t pool_id = 0;
+		uint32_t last_generation = 0; // pool-wide, so every published frame gets a distinct generation
+		int32_t writing_slot = -1;
+		int32_t latest_slot = -1;
+		size_t next_write_slot = 0; // where begin_write() starts looking for a free slot
+
+		// Guards slot bookkeeping only; pixel data is read and written outside it.
+		mutable Mutex mutex;
+	};
+
+	// Consumer-side holder for the frame a handle names: keeps both the frame and its pool referenced until
+	// reset() or destruction. This is how workloads reading an ImageHandle input should get at the bytes.
+	class ScopedImageFrame
+	{
+	  public:
+		ScopedImageFrame() = default;
+		explicit ScopedImageFrame(const ImageHandle& handle) { reset(handle); }
+		~ScopedImageFrame() { reset(); }
+
+		ScopedImageFrame(const ScopedImageFrame&) = delete;
+		ScopedImageFrame& operator=(const ScopedImageFrame&) = delete;
+
+		// Release the held frame (if any), then take the one handle names. Returns is_valid().
+		bool reset(const ImageHandle& handle = ImageHandle{});
+
+		bool is_valid() const { return view.is_valid(); }
+		const uint8_t* data() const { return view.data; }
+		size_t size() const { return view.size; }
+		const ImageHandle& get_handle() const { return view.handle; }
+
+	  private:
+		ImageFramePool* pool = nullptr;
+		ImageFrameView view;
+	};
+
+	class ImageFramePoolRegistry
+	{
+	  public:
+		// Process-local singleton mapping pool names to shared ImageFramePool instances.
+		static ImageFramePoolRegistry& get();
+
+		// Find or create the named pool and take a reference to it. The first acquirer sizes it; later
+		// callers get the existing pool, or nullptr if it is too small for them or the registry is full.
+		ImageFramePool* acquire(const char* name, uint32_t slot_count, size_t slot_capacity_bytes);
+
+		// Take a reference to the pool that published a handle (nullptr if it no longer exists), so that it
+		// outlives its producer while the caller uses it. Pair with release().
+		ImageFramePool* acquire(const ImageHandle& handle);
+
+		// Drop a reference taken by either acquire(); the pool is freed with its last reference.
+		void release(ImageFramePool* pool);
+
+		// Number of live references to the named pool (0 if it does not exist).
+		uint32_t get_ref_count(const char* name) const;
+
+	  private:
+		struct PoolEntry
+		{
+			FixedString32 name;
+			std_approved::unique_ptr<ImageFramePool> pool;
+			uint32_t ref_count = 0;
+			uint32_t last_generation = 0; // carried over to the next pool created in this entry
+		};
+
+		// Fixed-size registry to keep allocation simple and deterministic.
+		static constexpr uint32_t kMaxPools = 8;
+
+		// Protects all registry operations (not the pools themselves).
+		mutable Mutex mutex_;
+		PoolEntry entries_[kMaxPools]{};
+	};
+
+} // namespace robotick
@@ -24,6 +24,7 @@ namespace robotick
 	enum class MqttOpResult
 	{
 		Success,
+		Queued, // held in the store-and-forward outbox, sent once the link is back
 		Dropped,
 		Error,
 	};
@@ -58,6 +59,12 @@ namespace robotick
 		void set_qos(uint8_t publish_qos, uint8_t subscribe_qos) override;
 		void set_socket_timeout_ms(uint32_t milliseconds);
 
+		// Optional store-and-forward (call once, before use; 0 topics = disabled). While disconnected, and until the
+		// backlog has drained, retained publishes are held as the latest payload per topic in a fixed-size outbox.
+		// poll() then sends them oldest-first, at most drain_per_poll per call, so a reconnect is paced rather than
+		// a burst that floods the broker and the send buffer. Non-retained publishes are never held.
+		void set_store_and_forward(uint32_t max_topics, uint32_t drain_per_poll);
+
 		// Optional: drive mqtt-c from your engine tick
 		void poll();	   // declare
 		void disconnect(); // declare
@@ -78,6 +85,9 @@ namespace robotick
 			uint32_t publish_drops = 0;
 			uint32_t subscribe_drops = 0;
 			uint64_t last_drop_timestamp_ms = 0;
+			uint32_t queued_publishes = 0;	  // publishes taken by the store-and-forward outbox
+			uint32_t coalesced_publishes = 0; // held payloads replaced by a newer one for the same topic
+			uint32_t pending_publishes = 0;	  // topics currently waiting in the outbox
 		};
 		const HealthMetrics& get_health_metrics() const;
 		const BackpressureStats& get_backpressure_stats() const;
@@ -99,6 +109,17 @@ namespace robotick
 		FixedString256 inbound_topic;
 		FixedString1024 inbound_payload;
 
+		struct OutboxEntry
+		{
+			FixedString256 topic;
+			FixedString1024 payload;
+			uint32_t sequence = 0; // drain order; kept when the payload is replaced
+			bool pending = false;
+		};
+		HeapVector<OutboxEntry> outbox;
+		uint32_t outbox_drain_per_poll = 0;
+		uint32_t outbox_sequence = 0;
+
 		// static publish callback with access to private members
 		static void on_publish(void** state, struct mqtt_response_publish* published);
 
@@ -114,6 +135,9 @@ namespace robotick
 		void schedule_backoff(uint64_t now);
 		bool ensure_connected_or_drop(bool publish);
 		void record_backpressure(bool publish);
+		bool should_hold_publish(bool retained) const;
+		bool store_in_outbox(const char* topic, const char* payload);
+		void drain_outbox();
 
 		Mutex operation_mutex;
 		bool tls_enabled = false;
@@ -30,6 +30,7 @@ namespace robotick
 	enum class MqttOpResult
 	{
 		Success,
+		Queued,
 		Dropped,
 		Error,
 	};
@@ -46,7 +47,8 @@ namespace robotick
 	  public:
 		// For unit tests: only a publisher lambda
 		using PublisherFn = Function<void(const char*, const char*, bool)>;
-		using TopicMap = Map<FixedString256, nlohmann::json, 128>;
+		using TopicMap = Map<FixedString256, FixedString1024, 128>; // topic -> JSON payload text
+		using PayloadHashMap = Map<FixedString256, uint64_t, 128>;	// topic -> hash of the payload text
 
 		/** Constructor for tests (no Engine/IMqttClient) */
 		MqttFieldSync(const char* root_ns, PublisherFn publisher);
@@ -71,12 +73,15 @@ namespace robotick
 		 */
 		void publish_fields(const Engine& engine, const WorkloadsBuffer& buffer, bool publish_control);
 
-		void queue_control_topic(const char* topic, const nlohmann::json& value);
+		/** Queue a raw JSON control payload; it is decoded into the field by apply_control_updates() */
+		void queue_control_topic(const char* topic, const char* payload);
+
 		struct Metrics
 		{
 			uint32_t state_publish_failures = 0;
 			uint32_t control_publish_failures = 0;
 			uint32_t subscribe_failures = 0;
+			uint32_t oversize_skips = 0; // fields not published, or controls not queued, as topic or payload would not fit
 			MqttOpResult last_subscribe_result = MqttOpResult::Success;
 			MqttOpResult last_state_result = MqttOpResult::Success;
 			MqttOpResult last_control_result = MqttOpResult::Success;
@@ -89,13 +94,17 @@ namespace robotick
 		PublisherFn publisher;
 		IMqttClient* mqtt_ptr;
 		Engine* engine_ptr = nullptr;
-		TopicMap last_published;
+		// Only echo suppression reads last_published, so it keeps a hash per topic rather than a second copy of
+		// every payload; updated_topics needs the text itself, until apply_control_updates() decodes it.
+		PayloadHashMap last_published;
 		TopicMap updated_topics;
 		Metrics metrics;
 
 		/** Serialize a single field (by pointer and TypeId) into JSON */
 		nlohmann::json serialize(void* ptr, TypeId type);
-		void store_topic(TopicMap& table, const char* topic, const nlohmann::json& value);
+		/** Record a queued payload; false (with a warning) if topic or payload would not fit unshortened */
+		bool store_topic(TopicMap& table, const char* topic, const char* payload);
+		void store_published_topic(const char* topic, const char* payload);
 		bool topic_starts_with(const char* topic, const char* prefix) const;
 	};
 #else
@@ -115,12 +124,13 @@ namespace robotick
 		void apply_control_updates();
 		void publish_state_fields();
 		void publish_fields(const Engine& engine, const WorkloadsBuffer& buffer, bool publish_control);
-		void queue_control_topic(const char* topic, const nlohmann::json& value);
+		void queue_control_topic(const char* topic, const char* payload);
 		struct Metrics
 		{
 			uint32_t state_publish_failures = 0;
 			uint32_t control_publish_failures = 0;
 			uint32_t subscribe_failures = 0;
+			uint32_t oversize_skips = 0; // fields not published, or controls not queued, as topic or payload would not fit
 			MqttOpResult last_subscribe_result = MqttOpResult::Success;
 			MqttOpResult last_state_result = MqttOpResult::Success;
 			MqttOpResult last_control_result = MqttOpResult::Success;
@@ -138,7 +148,8 @@ namespace robotick
 		Metrics metrics;
 
 		nlohmann::json serialize(void* ptr, TypeId type);
-		void store_topic(TopicMap& table, const char* topic, const nlohmann::json& value);
+		bool store_topic(TopicMap& table, const char* topic, const char* payload);
+		void store_published_topic(const char* topic, const char* payload);
 		bool topic_starts_with(const char* topic, const char* prefix) const;
 	};
 #endif
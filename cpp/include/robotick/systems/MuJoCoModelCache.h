@@ -0,0 +1,44 @@
+// Copyright Robotick contributors
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+typedef struct mjModel_ mjModel;
+
+namespace robotick
+{
+	struct MuJoCoModelCacheOptions
+	{
+		// Directory for compiled .mjb files; nullptr/empty stores them next to the model XML (git-ignored).
+		const char* cache_dir = nullptr;
+	};
+
+	// MuJoCoModelCache skips MJCF parsing/compilation (meshes, convex hulls, inertias) on repeat loads by
+	// keeping a compiled .mjb beside a key file. The key hashes the XML, every <include> and every
+	// file-backed asset (mesh/texture/hfield/skin, resolved via <compiler> meshdir/texturedir/assetdir)
+	// plus the MuJoCo version, so editing any of them recompiles and refreshes the cache.
+	class MuJoCoModelCache
+	{
+	  public:
+		// Load a compiled model, from the cache when its key matches, otherwise by compiling the XML
+		// (and then refreshing the cache). Caller owns the result (mj_deleteModel). nullptr on failure,
+		// with the compiler's message in error.
+		static ::mjModel* load(const char* model_path, const MuJoCoModelCacheOptions& options, char* error, int error_size, bool* out_cache_hit = nullptr);
+		// As load(), with content_key already computed by the caller (compute_content_key), so callers that
+		// need the key themselves (MuJoCoModelStore) don't hash the model files twice.
+		static ::mjModel* load_with_key(const char* model_path, uint64_t content_key, const MuJoCoModelCacheOptions& options, char* error,
+			int error_size, bool* out_cache_hit = nullptr);
+
+		// Content key over the model XML, its includes and referenced asset files (not the MuJoCo version).
+		// Returns 0 if the model file itself cannot be read.
+		static uint64_t compute_content_key(const char* model_path);
+
+		// Paths of the compiled model and its key file for model_path; false if they don't fit.
+		static bool get_cache_paths(const char* model_path, const MuJoCoModelCacheOptions& options, char* mjb_path, size_t mjb_path_size,
+			char* key_path, size_t key_path_size);
+	};
+
+} // namespace robotick
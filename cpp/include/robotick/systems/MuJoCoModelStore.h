@@ -0,0 +1,64 @@
+// Copyright Robotick contributors
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "robotick/framework/concurrency/Sync.h"
+#include "robotick/framework/strings/FixedString.h"
+
+#include <cstdint>
+
+typedef struct mjModel_ mjModel;
+
+namespace robotick
+{
+	struct MuJoCoModelCacheOptions;
+
+	// MuJoCoModelStore lets MuJoCoPhysics instances that load the same model share one immutable mjModel;
+	// each instance still owns its own mjData. Entries are keyed by model path and content key (see
+	// MuJoCoModelCache::compute_content_key), so an edited file loads as a new entry, and are
+	// reference-counted: the model is freed when the last instance releases it.
+	class MuJoCoModelStore
+	{
+	  public:
+		// Process-local singleton.
+		static MuJoCoModelStore& get();
+
+		// Return the shared model for model_path, loading it (through the .mjb cache when cache_options is
+		// given) on first use. Every successful acquire must be paired with release(). nullptr on failure.
+		// Compilation runs outside the store lock; concurrent requests for the same model wait for the
+		// first one's result instead of compiling it again.
+		const ::mjModel* acquire(const char* model_path, const MuJoCoModelCacheOptions* cache_options, char* error, int error_size);
+		// Drop one reference; frees the model when none remain.
+		void release(const ::mjModel* model);
+
+		// The only sanctioned mutation of a shared model: the first caller sets opt.timestep, later callers
+		// succeed only if they ask for the same value. Returns false if the model would need its own copy.
+		bool try_set_shared_timestep(const ::mjModel* model, double timestep);
+
+		uint32_t get_ref_count(const ::mjModel* model) const;
+		uint32_t get_num_models() const;
+
+	  private:
+		struct ModelEntry
+		{
+			FixedString256 path;
+			uint64_t content_key = 0;
+			::mjModel* model = nullptr;
+			uint32_t ref_count = 0;
+			bool is_timestep_set = false;
+			bool is_loading = false; // reserved by an acquire() that is still compiling model
+		};
+
+		static constexpr uint32_t kMaxModels = 16;
+
+		ModelEntry* find_entry(const ::mjModel* model);
+		const ModelEntry* find_entry(const ::mjModel* model) const;
+
+		void release_failed_entry(ModelEntry& entry);
+
+		mutable Mutex mutex_;
+		ConditionVariable loaded_cv_; // signalled whenever an entry finishes loading
+		ModelEntry entries_[kMaxModels]{};
+	};
+} // namespace robotick
@@ -5,12 +5,16 @@
 
 #include "robotick/framework/concurrency/Sync.h"
 
+#include <cstdint>
+
 // Forward declarations to avoid requiring MuJoCo headers in all translation units.
 typedef struct mjModel_ mjModel;
 typedef struct mjData_ mjData;
 
 namespace robotick
 {
+	struct MuJoCoModelCacheOptions;
+
 	// MuJoCoPhysics owns the per-scene mjModel/mjData lifecycle and provides
 	// thread-safe render snapshots. MuJoCoPhysicsWorkload runs physics via this class,
 	// then registers the instance with MuJoCoSceneRegistry so camera workloads
@@ -28,8 +32,14 @@ namespace robotick
 
 		// Load model/data from an MJCF XML file path; returns false on failure.
 		bool load_from_xml(const char* model_path);
+		// As above, but reuses a compiled .mjb from MuJoCoModelCache when the model and its assets are unchanged.
+		bool load_from_xml(const char* model_path, const MuJoCoModelCacheOptions& cache_options);
+		// Share one mjModel (via MuJoCoModelStore) with every other instance loading the same unchanged model;
+		// only mjData is allocated per instance. cache_options may be nullptr to always compile the XML.
+		bool load_shared_from_xml(const char* model_path, const MuJoCoModelCacheOptions* cache_options = nullptr);
 		void unload();
 		bool is_loaded() const { return model_ != nullptr && data_ != nullptr; }
+		bool is_model_shared() const { return model_shared_; }
 
 		// Advance internal derived quantities without stepping time.
 		void forward();
@@ -37,7 +47,12 @@ namespace robotick
 		void step();
 
 		const ::mjModel* model() const { return model_; }
-		::mjModel* model_mutable() { return model_; }
+		// Copy-on-write: a shared model is first copied so other instances never see the change.
+		::mjModel* model_mutable();
+
+		// Set opt.timestep without giving up a shared model when every sharer asks for the same value.
+		// Like model_mutable(), call with lock() held.
+		void set_timestep(double timestep);
 		const ::mjData* data() const { return data_; }
 		::mjData* data_mutable() { return data_; }
 
@@ -45,8 +60,15 @@ namespace robotick
 		bool alloc_render_snapshot(::mjData*& data_out, const ::mjModel*& model_out, double& time_out) const;
 		// Frees a snapshot allocated by alloc_render_snapshot(). Safe to call with nullptr.
 		void destroy_render_snapshot(::mjData*& data_out) const;
-		// Thread-safe copy into a caller-owned mjData buffer; no allocation.
-		bool copy_render_snapshot(::mjData* dst, const ::mjModel*& model_out, double& time_out) const;
+		// Thread-safe copy into a caller-owned mjData buffer; no allocation. revision_out (optional) receives
+		// the state revision the copy was taken at.
+		bool copy_render_snapshot(::mjData* dst, const ::mjModel*& model_out, double& time_out, uint64_t* revision_out = nullptr) const;
+
+		// Monotonic counter bumped whenever the simulation state changes (step/forward/load, or an explicit
+		// mark_state_changed()); lets renderers skip frames when nothing has moved.
+		uint64_t state_revision() const;
+		// For callers that step or edit data_mutable() directly. Like model_mutable(), call with lock() held.
+		void mark_state_changed() { ++state_revision_; }
 
 		// Static helper for freeing mjData without requiring an instance.
 		static void destroy_snapshot(::mjData*& data_out);
@@ -55,9 +77,14 @@ namespace robotick
 		UniqueLock lock() const { return UniqueLock(mutex_); }
 
 	  private:
+		bool adopt_model(::mjModel* model, bool is_shared);
+
 		// Guards model/data access and snapshot creation.
 		mutable Mutex mutex_;
 		::mjModel* model_ = nullptr;
 		::mjData* data_ = nullptr;
+		// True while model_ is owned by MuJoCoModelStore rather than by this instance.
+		bool model_shared_ = false;
+		uint64_t state_revision_ = 0;
 	};
 } // namespace robotick
@@ -5,7 +5,10 @@
 
 #if defined(ROBOTICK_PLATFORM_DESKTOP) || defined(ROBOTICK_PLATFORM_LINUX)
 
+#include "robotick/framework/memory/StdApproved.h"
+
 #include <cstddef>
+#include <cstdint>
 #include <EGL/egl.h>
 
 // Forward declarations from MuJoCo (keep in global namespace).
@@ -19,6 +22,20 @@ typedef struct mjrRect_ mjrRect;
 
 namespace robotick
 {
+	// Caller-owned buffers for MuJoCoRenderContext::render_frame. Any target left null is skipped; capacities
+	// are in elements. All targets share the render size and GL row order (bottom row first).
+	struct MuJoCoRenderTargets
+	{
+		uint8_t* rgb = nullptr; // 3 bytes per pixel
+		size_t rgb_capacity = 0;
+
+		float* depth = nullptr; // linear distance from the camera plane, metres
+		size_t depth_capacity = 0;
+
+		int32_t* segmentation = nullptr; // geom id per pixel, -1 for background / non-geom objects
+		size_t segmentation_capacity = 0;
+	};
+
 	class MuJoCoRenderContext
 	{
 	  public:
@@ -40,6 +57,11 @@ namespace robotick
 			int& out_height,
 			bool use_window_buffer = false);
 
+		// Render one frame and read back every requested target. The scene is built once (one mjv_updateScene);
+		// depth comes from the same pass as colour, segmentation re-renders that scene with id colours.
+		bool render_frame(
+			const mjModel* model, const mjData* data, const char* camera_name, const MuJoCoRenderTargets& targets, int& out_width, int& out_height);
+
 		// Test helper: clear the current framebuffer to solid blue and read back RGB.
 		bool debug_clear_and_read_blue(
 			uint8_t* out_rgb,
@@ -54,6 +76,9 @@ namespace robotick
 		void destroy_gl_context();
 		void update_viewport(int width, int height);
 		void ensure_scene_initialized(const mjModel* model);
+		bool prepare_viewport_and_camera(const mjModel* model, const char* camera_name);
+		void linearize_depth(const mjModel* model, float* depth, size_t pixel_count) const;
+		void read_segmentation(int32_t* out_ids, size_t pixel_count);
 
 		bool initialized_ = false;
 		bool owns_sdl_video_ = false;
@@ -73,6 +98,9 @@ namespace robotick
 
 		bool scene_ready_ = false;
 		bool context_ready_ = false;
+
+		// Id-colour readback for segmentation, sized on first use.
+		std_approved::vector<uint8_t> segment_rgb_;
 	};
 } // namespace robotick
 
@@ -28,7 +28,10 @@ namespace robotick
 		// Allocate a render snapshot; returns false on invalid handle or alloc failure.
 		bool alloc_render_snapshot(uint32_t scene_id, ::mjData*& data_out, const ::mjModel*& model_out, double& time_out) const;
 		// Copy into a caller-owned mjData buffer; returns false on invalid handle.
-		bool copy_render_snapshot(uint32_t scene_id, ::mjData* dst, const ::mjModel*& model_out, double& time_out) const;
+		bool copy_render_snapshot(
+			uint32_t scene_id, ::mjData* dst, const ::mjModel*& model_out, double& time_out, uint64_t* revision_out = nullptr) const;
+		// Fetch the scene's state revision (see MuJoCoPhysics::state_revision); returns false on invalid handle.
+		bool get_state_revision(uint32_t scene_id, uint64_t& revision_out) const;
 		// Release a snapshot obtained from alloc_render_snapshot().
 		void destroy_render_snapshot(::mjData*& data_out) const;
 
@@ -0,0 +1,77 @@
+// Copyright Robotick contributors
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace robotick
+{
+	// Several cameras captured as one synchronised set (e.g. a stereo pair). Every device is grabbed
+	// back-to-back before any frame is retrieved or decoded, so the inter-camera skew is only the time
+	// between the grab calls, and all cameras share one JPEG encode buffer.
+	class MultiCamera
+	{
+	  public:
+		static constexpr uint32_t kMaxCameras = 4;
+
+		struct Impl;
+
+		MultiCamera();
+		~MultiCamera();
+
+		MultiCamera(const MultiCamera&) = delete;
+		MultiCamera& operator=(const MultiCamera&) = delete;
+
+		// Open every device (V4L2 index; virtual devices such as v4l2loopback or vivid work the same way).
+		// Fails, leaving nothing open, if any device cannot be opened.
+		bool setup(const int* camera_indices, uint32_t camera_count);
+		uint32_t get_camera_count() const;
+
+		// Grab all cameras, then retrieve all. Returns false (and keeps no partial set) if any camera fails.
+		bool capture();
+
+		// Grab time of camera i in the last set, relative to the start of capture().
+		uint64_t get_grab_offset_ns(uint32_t camera) const;
+		// Grab time of camera i in the last set, on the steady Clock, relative to the last reset_clock() (or setup()).
+		uint64_t get_grab_time_ns(uint32_t camera) const;
+		void reset_clock();
+		// Spread between the earliest and latest grab in the last set.
+		uint64_t get_skew_ns() const;
+
+		// JPEG-encode camera i's frame from the last set.
+		bool encode_jpeg(uint32_t camera, uint8_t* dst_buffer, size_t dst_capacity, size_t& out_size_used);
+
+		void print_available_cameras();
+
+	  private:
+		Impl* impl = nullptr;
+	};
+
+	// Capture one set from cameras (a MultiCamera, or anything with the same capture / get_camera_count /
+	// encode_jpeg calls) and JPEG-encode camera i into *jpeg_outputs[i]. All or nothing: returns false if
+	// the capture fails (outputs untouched, so they still hold the previous whole set) or any encode fails
+	// (every output emptied, so no mix of old and new frames is ever visible).
+	template <typename TCameras, typename TJpeg> bool capture_jpeg_set(TCameras& cameras, TJpeg* const* jpeg_outputs)
+	{
+		if (!cameras.capture())
+			return false;
+
+		const uint32_t camera_count = cameras.get_camera_count();
+		for (uint32_t i = 0; i < camera_count; ++i)
+		{
+			TJpeg& jpeg = *jpeg_outputs[i];
+			size_t size_used = 0;
+			if (!cameras.encode_jpeg(i, jpeg.data(), jpeg.capacity(), size_used))
+			{
+				for (uint32_t j = 0; j < camera_count; ++j)
+					jpeg_outputs[j]->set_size(0);
+				return false;
+			}
+			jpeg.set_size(size_used);
+		}
+		return true;
+	}
+
+} // namespace robotick
@@ -63,11 +63,18 @@ namespace robotick
 			logical_h = h;
 		}
 
+		// Physical pixels per logical unit (e.g. to size per-pixel work such as plot decimation).
+		float get_pixel_scale() const { return scale; }
+
 		// Drawing
 		void draw_ellipse_filled(const Vec2f& center, const float rx, const float ry, const Color& color);
 		void draw_circle_filled(const Vec2f& center, const float radius, const Color& color) { draw_ellipse_filled(center, radius, radius, color); }
 		void draw_triangle_filled(const Vec2f& p0, const Vec2f& p1, const Vec2f& p2, const Color& color);
 		void draw_rect_filled(const Vec2f& p0, const Vec2f& p1, const Color& color);
+		// Batched primitives: one backend draw call for the whole set.
+		void draw_polyline(const Vec2f* points, size_t count, const Color& color);
+		// rect_corners holds 2 * rect_count points: (p0, p1) per axis-aligned rect.
+		void draw_rects_filled(const Vec2f* rect_corners, size_t rect_count, const Color& color);
 		void draw_text(const char* text, const Vec2f& pos, const float size, const TextAlign align, const Color& color);
 
 		// New: blit an RGBA8888 image and scale to the current viewport
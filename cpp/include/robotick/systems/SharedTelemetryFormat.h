@@ -0,0 +1,120 @@
+/* Copyright Robotick contributors
+ * SPDX-License-Identifier: Apache-2.0 */
+
+/*
+ * Layout of a shared-memory telemetry segment (see SharedTelemetryWriter), plus a header-only reader.
+ * Plain C so that loggers and tools can map the segment without linking robotick.
+ *
+ * Segment: [header][field descriptors][snapshot data]
+ *
+ * The snapshot is guarded by a seqlock: the writer makes `sequence` odd, copies the fields, then makes it
+ * even again. A reader copies the snapshot between two reads of `sequence` and retries if they differ or
+ * were odd. Readers never block the writer.
+ */
+
+#ifndef ROBOTICK_SHARED_TELEMETRY_FORMAT_H
+#define ROBOTICK_SHARED_TELEMETRY_FORMAT_H
+
+#include <stdint.h>
+#include <string.h>
+
+#define ROBOTICK_SHARED_TELEMETRY_MAGIC 0x4D545452u /* "RTTM" */
+#define ROBOTICK_SHARED_TELEMETRY_VERSION 1u
+#define ROBOTICK_SHARED_TELEMETRY_PATH_SIZE 112u
+#define ROBOTICK_SHARED_TELEMETRY_FLAG_WRITER_ATTACHED 0x1u
+
+/* How a field's bytes are to be read. Values are little-endian, in host layout. */
+enum RobotickSharedTelemetryKind
+{
+	ROBOTICK_SHARED_TELEMETRY_BYTES = 0, /* opaque: anything without a simpler representation */
+	ROBOTICK_SHARED_TELEMETRY_INT32 = 1,
+	ROBOTICK_SHARED_TELEMETRY_UINT8 = 2,
+	ROBOTICK_SHARED_TELEMETRY_UINT16 = 3,
+	ROBOTICK_SHARED_TELEMETRY_UINT32 = 4,
+	ROBOTICK_SHARED_TELEMETRY_FLOAT32 = 5,
+	ROBOTICK_SHARED_TELEMETRY_FLOAT64 = 6,
+	ROBOTICK_SHARED_TELEMETRY_BOOL = 7,
+	ROBOTICK_SHARED_TELEMETRY_STRING = 8 /* NUL-terminated within `size` bytes */
+};
+
+typedef struct RobotickSharedTelemetryHeader
+{
+	uint32_t magic;
+	uint16_t version;
+	uint16_t header_size;
+	uint32_t flags; /* ROBOTICK_SHARED_TELEMETRY_FLAG_* */
+	uint32_t writer_pid;
+	uint32_t field_count;
+	uint32_t fields_offset; /* from the start of the segment */
+	uint32_t data_offset;	/* from the start of the segment */
+	uint32_t data_size;
+	uint32_t sequence; /* seqlock: odd while the writer is updating */
+	uint32_t reserved0;
+	uint64_t timestamp_ns;	/* engine time of the snapshot (covered by the seqlock) */
+	uint64_t publish_count; /* (covered by the seqlock) */
+	uint64_t reserved1;
+} RobotickSharedTelemetryHeader;
+
+typedef struct RobotickSharedTelemetryField
+{
+	char path[ROBOTICK_SHARED_TELEMETRY_PATH_SIZE]; /* "<workload>.<outputs|inputs|config>.<field>[.<subfield>]" */
+	uint32_t offset;								/* within the snapshot data */
+	uint32_t size;
+	uint8_t kind; /* RobotickSharedTelemetryKind */
+	uint8_t reserved[7];
+} RobotickSharedTelemetryField;
+
+static inline const RobotickSharedTelemetryHeader* robotick_shared_telemetry_header(const void* segment)
+{
+	const RobotickSharedTelemetryHeader* header = (const RobotickSharedTelemetryHeader*)segment;
+	if (header == NULL || header->magic != ROBOTICK_SHARED_TELEMETRY_MAGIC || header->version != ROBOTICK_SHARED_TELEMETRY_VERSION)
+		return NULL;
+	return header;
+}
+
+static inline const RobotickSharedTelemetryField* robotick_shared_telemetry_find_field(const void* segment, const char* path)
+{
+	const RobotickSharedTelemetryHeader* header = robotick_shared_telemetry_header(segment);
+	if (header == NULL || path == NULL)
+		return NULL;
+
+	const RobotickSharedTelemetryField* fields = (const RobotickSharedTelemetryField*)((const uint8_t*)segment + header->fields_offset);
+	for (uint32_t i = 0; i < header->field_count; ++i)
+	{
+		if (strncmp(fields[i].path, path, ROBOTICK_SHARED_TELEMETRY_PATH_SIZE) == 0)
+			return &fields[i];
+	}
+	return NULL;
+}
+
+/* Copies a consistent snapshot (header->data_size bytes) into dst. Returns 1 on success, 0 if the segment
+ * is invalid, dst is too small, or no consistent copy was made within max_attempts. */
+static inline int robotick_shared_telemetry_read(
+	const void* segment, void* dst, uint32_t dst_size, uint64_t* out_timestamp_ns, uint32_t max_attempts)
+{
+	const RobotickSharedTelemetryHeader* header = robotick_shared_telemetry_header(segment);
+	if (header == NULL || dst == NULL || dst_size < header->data_size)
+		return 0;
+
+	const uint8_t* data = (const uint8_t*)segment + header->data_offset;
+	for (uint32_t attempt = 0; attempt < max_attempts; ++attempt)
+	{
+		const uint32_t begin = __atomic_load_n(&header->sequence, __ATOMIC_ACQUIRE);
+		if (begin & 1u)
+			continue;
+
+		memcpy(dst, data, header->data_size);
+		const uint64_t timestamp_ns = header->timestamp_ns;
+
+		__atomic_thread_fence(__ATOMIC_ACQUIRE);
+		if (__atomic_load_n(&header->sequence, __ATOMIC_RELAXED) == begin)
+		{
+			if (out_timestamp_ns != NULL)
+				*out_timestamp_ns = timestamp_ns;
+			return 1;
+		}
+	}
+	return 0;
+}
+
+#endif /* ROBOTICK_SHARED_TELEMETRY_FORMAT_H */
@@ -0,0 +1,69 @@
+// Copyright Robotick contributors
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#if defined(ROBOTICK_PLATFORM_DESKTOP) || defined(ROBOTICK_PLATFORM_LINUX)
+
+#include "robotick/framework/containers/HeapVector.h"
+#include "robotick/framework/strings/FixedString.h"
+#include "robotick/systems/SharedTelemetryFormat.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace robotick
+{
+	struct SharedTelemetryField
+	{
+		FixedString128 path;
+		const void* src = nullptr; // read on every publish(); must stay valid while the writer is open
+		uint32_t size = 0;
+		RobotickSharedTelemetryKind kind = ROBOTICK_SHARED_TELEMETRY_BYTES;
+	};
+
+	// Publishes a fixed set of fields into a named POSIX shared-memory segment (layout: SharedTelemetryFormat.h),
+	// so same-host readers get fresh values without serialisation or a broker hop.
+	class SharedTelemetryWriter
+	{
+	  public:
+		SharedTelemetryWriter() = default;
+		~SharedTelemetryWriter();
+
+		SharedTelemetryWriter(const SharedTelemetryWriter&) = delete;
+		SharedTelemetryWriter& operator=(const SharedTelemetryWriter&) = delete;
+
+		// Creates (replacing any stale segment of the same name) and writes the layout descriptor.
+		bool open(const char* segment_name, const SharedTelemetryField* fields, uint32_t field_count);
+		// Detaches and unlinks the segment; readers still mapping it see the writer-attached flag cleared.
+		void close();
+
+		// Copies every field into the snapshot under the seqlock.
+		void publish(uint64_t timestamp_ns);
+
+		bool is_open() const { return header != nullptr; }
+		uint32_t get_data_size() const { return header ? header->data_size : 0; }
+		uint32_t get_copy_run_count() const { return run_count; }
+		const void* get_segment() const { return header; }
+
+	  private:
+		// Fields that are adjacent in the engine's buffer are copied as one block.
+		struct CopyRun
+		{
+			const uint8_t* src = nullptr;
+			uint32_t dst_offset = 0;
+			uint32_t size = 0;
+		};
+
+		RobotickSharedTelemetryHeader* header = nullptr;
+		uint8_t* data = nullptr;
+		size_t segment_size = 0;
+		FixedString64 name;
+
+		HeapVector<CopyRun> runs;
+		uint32_t run_count = 0;
+	};
+
+} // namespace robotick
+
+#endif // ROBOTICK_PLATFORM_DESKTOP || ROBOTICK_PLATFORM_LINUX
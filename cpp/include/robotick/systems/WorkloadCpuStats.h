@@ -0,0 +1,89 @@
+// Copyright Robotick contributors
+// SPDX-License-Identifier: Apache-2.0
+//
+// WorkloadCpuStats: per-workload thread CPU time and context switches, accumulated tick by tick.
+// Wall-clock tick durations alone cannot tell a workload that computed for 5 ms from one that sat
+// blocked on a mutex (or the GIL) for 4.9 ms of it; CPU time and voluntary switches can.
+// Group workloads record into WorkloadCpuStatsRegistry while any reporter holds it enabled (each
+// TimingDiagnosticsWorkload with report_workload_cpu does), so the extra clock reads cost nothing otherwise.
+
+#pragma once
+
+#include "robotick/api.h"
+#include "robotick/framework/concurrency/Atomic.h"
+#include "robotick/framework/concurrency/Sync.h"
+#include "robotick/framework/strings/FixedString.h"
+
+#include <cstdint>
+
+namespace robotick
+{
+	// CPU time and context switches of the calling thread so far.
+	struct ThreadCpuSample
+	{
+		uint64_t cpu_ns = 0;
+		uint64_t voluntary_switches = 0;   // blocked (mutex, I/O, sleep) and gave up the CPU
+		uint64_t involuntary_switches = 0; // preempted while runnable
+	};
+
+	// Returns false where thread CPU clocks are unavailable. Context switch counts are left at 0 on
+	// platforms that do not report them per thread.
+	bool sample_thread_cpu(ThreadCpuSample& out);
+
+	// Plain copy of a WorkloadCpuStats' totals, for computing deltas between reports.
+	struct WorkloadCpuTotals
+	{
+		uint64_t tick_count = 0;
+		uint64_t wall_ns = 0;
+		uint64_t cpu_ns = 0;
+		uint64_t voluntary_switches = 0;
+		uint64_t involuntary_switches = 0;
+	};
+
+	// Running totals for one workload. Written only by the thread that ticks it; read by anyone.
+	struct WorkloadCpuStats
+	{
+		FixedString64 name;
+
+		AtomicValue<uint64_t> tick_count{0};
+		AtomicValue<uint64_t> wall_ns{0};
+		AtomicValue<uint64_t> cpu_ns{0};
+		AtomicValue<uint64_t> voluntary_switches{0};
+		AtomicValue<uint64_t> involuntary_switches{0};
+
+		void record_tick(uint64_t tick_wall_ns, const ThreadCpuSample& before, const ThreadCpuSample& after);
+		WorkloadCpuTotals get_totals() const;
+	};
+
+	class WorkloadCpuStatsRegistry
+	{
+	  public:
+		static constexpr uint32_t kMaxWorkloads = 64;
+
+		// Process-local singleton holding one WorkloadCpuStats per workload name.
+		static WorkloadCpuStatsRegistry& get();
+
+		// Recording is off by default and stays on while any reporter holds it: every add_reporter() must be
+		// paired with a remove_reporter(). Tickers check is_enabled() before sampling.
+		void add_reporter();
+		void remove_reporter();
+		bool is_enabled() const { return enabled_.is_set(); }
+
+		// Stats for the named workload, created on first use. Entries live for the whole process, so the
+		// pointer may be cached. Returns nullptr once the registry is full.
+		WorkloadCpuStats* find_or_add(const char* name);
+
+		// Entries are only ever appended: [0, get_count()) are all valid.
+		uint32_t get_count() const { return count_.load(); }
+		const WorkloadCpuStats& get_entry(uint32_t index) const;
+
+	  private:
+		// Serialises find_or_add() and the reporter count; readers rely on count_ only being bumped once an entry is named.
+		Mutex mutex_;
+		uint32_t num_reporters_ = 0;
+		AtomicFlag enabled_{false}; // num_reporters_ > 0, readable without the lock
+		AtomicValue<uint32_t> count_{0};
+		WorkloadCpuStats entries_[kMaxWorkloads]{};
+	};
+
+} // namespace robotick
@@ -23,7 +23,7 @@ namespace robotick
 	{
 		AudioBuffer512 samples;
 		double timestamp = 0.0;
-		uint32_t sample_rate = 44100;
+		uint32_t sample_rate = 44100; // producers stamp the obtained AudioSystem rate (see AudioDeviceConfig)
 	};
 
 } // namespace robotick
@@ -0,0 +1,131 @@
+// Copyright Robotick contributors
+// SPDX-License-Identifier: Apache-2.0
+//
+// AudioHistory: single-writer / multi-reader streaming ring of recent mono audio.
+// One producer (e.g. MicWorkload) writes each block once; any number of consumers read the most
+// recent N seconds, or everything new since their own cursor, as zero-copy spans into the ring.
+// Histories are shared by name through AudioHistoryRegistry and freed when the last user releases.
+
+#pragma once
+
+#include "robotick/api.h"
+#include "robotick/framework/concurrency/Atomic.h"
+#include "robotick/framework/concurrency/Sync.h"
+#include "robotick/framework/containers/HeapVector.h"
+#include "robotick/framework/memory/StdApproved.h"
+#include "robotick/framework/strings/FixedString.h"
+#include "robotick/systems/audio/AudioFrame.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace robotick
+{
+	// Zero-copy view of a run of history samples. The run may wrap the end of the ring, so it is
+	// exposed as up to two contiguous pieces (first, then second).
+	struct AudioHistorySpan
+	{
+		const float* first = nullptr;
+		size_t first_count = 0;
+		const float* second = nullptr;
+		size_t second_count = 0;
+
+		uint64_t start_sample = 0; // absolute index (since the history was created) of the first sample
+
+		size_t size() const { return first_count + second_count; }
+		bool empty() const { return size() == 0; }
+		float operator[](size_t index) const { return (index < first_count) ? first[index] : second[index - first_count]; }
+
+		// Copy into a contiguous buffer of at least size() floats (for consumers that need one).
+		void copy_to(float* dst) const;
+	};
+
+	// Per-consumer read position. Each reader owns its cursor; the history never tracks readers.
+	struct AudioHistoryCursor
+	{
+		uint64_t next_sample = 0;
+		uint64_t dropped_samples = 0; // samples overwritten before this reader got to them
+		bool is_attached = false;
+	};
+
+	class AudioHistory
+	{
+	  public:
+		// Writes are published in chunks of at most this many samples; the ring keeps this much extra
+		// room beyond the readable capacity so spans stay intact while a chunk is in flight.
+		static constexpr size_t write_chunk_samples = AudioBuffer512::capacity();
+
+		AudioHistory() = default;
+		AudioHistory(const AudioHistory&) = delete;
+		AudioHistory& operator=(const AudioHistory&) = delete;
+
+		// Allocate the ring. Call once, before any writer/reader uses it.
+		void initialize(size_t capacity_samples, uint32_t sample_rate);
+
+		// Append samples (writer thread only).
+		void write(const float* samples, size_t count);
+		void write(const AudioFrame& frame) { write(frame.samples.data(), frame.samples.size()); }
+
+		// Span over the most recent min(num_samples, available) samples.
+		AudioHistorySpan get_latest(size_t num_samples) const;
+		AudioHistorySpan get_latest_seconds(float seconds) const { return get_latest(seconds_to_samples(seconds)); }
+
+		// Start a cursor at the current write position (it will see only audio written from now on).
+		void attach(AudioHistoryCursor& cursor) const;
+
+		// Span over up to max_samples not yet seen by this cursor, then advance it. Auto-attaches an
+		// unattached cursor; a cursor that fell more than capacity behind skips to the oldest sample.
+		AudioHistorySpan read(AudioHistoryCursor& cursor, size_t max_samples) const;
+
+		// True if none of the span's samples have been overwritten since it was taken. Readers that
+		// process a span over several ticks should check this before trusting the result.
+		bool is_intact(const AudioHistorySpan& span) const;
+
+		size_t get_capacity() const { return capacity_samples; }
+		uint32_t get_sample_rate() const { return sample_rate; }
+		uint64_t get_total_written() const { return total_written.load(); }
+		size_t seconds_to_samples(float seconds) const;
+
+	  private:
+		AudioHistorySpan make_span(uint64_t start_sample, size_t count) const;
+
+		HeapVector<float> ring; // capacity_samples + write_chunk_samples
+		size_t capacity_samples = 0;
+		uint32_t sample_rate = 0;
+		AtomicValue<uint64_t> total_written{0};
+	};
+
+	class AudioHistoryRegistry
+	{
+	  public:
+		// Process-local singleton mapping history names to shared AudioHistory instances.
+		static AudioHistoryRegistry& get();
+
+		// Find or create the named history and take a reference to it. The first acquirer sizes it;
+		// later callers get the existing ring (a larger request is clamped with a warning).
+		// Returns nullptr on sample-rate mismatch or when the registry is full.
+		AudioHistory* acquire(const char* name, float capacity_sec, uint32_t sample_rate);
+
+		// Drop a reference taken by acquire(); the history is freed with its last reference.
+		void release(AudioHistory* history);
+
+		// Number of live references to the named history (0 if it does not exist).
+		uint32_t get_ref_count(const char* name) const;
+
+	  private:
+		struct HistoryEntry
+		{
+			FixedString32 name;
+			std_approved::unique_ptr<AudioHistory> history;
+			uint32_t ref_count = 0;
+		};
+
+		// Fixed-size registry to keep allocation simple and deterministic.
+		static constexpr uint32_t kMaxHistories = 8;
+
+		// Protects all registry operations (not the histories themselves).
+		mutable Mutex mutex_;
+		HistoryEntry entries_[kMaxHistories]{};
+	};
+
+} // namespace robotick
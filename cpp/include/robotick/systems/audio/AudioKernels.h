@@ -0,0 +1,64 @@
+// Copyright Robotick contributors
+// SPDX-License-Identifier: Apache-2.0
+//
+// AudioKernels: small block-level DSP helpers shared by the audio workloads and systems.
+// Each kernel has an SSE2/AVX2 (x86) or NEON (arm) path selected at compile-time from the
+// target's baseline instruction set, with a scalar fallback (e.g. ESP32) and scalar tail handling.
+// Results are bit-identical to the scalar reference except where noted.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace robotick
+{
+	class AudioKernels
+	{
+	  public:
+		// Name of the compiled-in SIMD backend ("avx2", "sse2", "neon" or "scalar").
+		static const char* get_backend_name();
+
+		// samples[i] *= gain
+		static void apply_gain(float* samples, size_t count, float gain);
+
+		// dst[i] = src[i] * gain (src and dst may alias)
+		static void copy_with_gain(const float* src, float* dst, size_t count, float gain);
+
+		// dst[i] += src[i] * gain (may differ from scalar by rounding where the target fuses multiply-add)
+		static void mix_into(const float* src, float* dst, size_t count, float gain);
+
+		// dst[i] = 0.5 * (a[i] + b[i]) - e.g. stereo mix-down to mono
+		static void average(const float* a, const float* b, float* dst, size_t count);
+
+		// samples[i] = clamp(samples[i], min_value, max_value)
+		static void clip(float* samples, size_t count, float min_value, float max_value);
+
+		// dst[i] = src[i] / 32768
+		static void int16_to_float(const int16_t* src, float* dst, size_t count);
+
+		// dst[i] = round_to_nearest_even(clamp(src[i], -1, 1) * 32767)
+		static void float_to_int16(const float* src, int16_t* dst, size_t count);
+
+		// dst_lr = L0 R0 L1 R1 ... ; a null left/right input is treated as silence.
+		static void interleave_stereo(const float* left, const float* right, float* dst_lr, size_t frames);
+
+		// dst = C0[0] C1[0] .. Cn[0] C0[1] ... ; planar[c] may be null for a silent channel.
+		// Mono/stereo/quad layouts use the SIMD paths, other channel counts use a strided scalar loop.
+		static void interleave(const float* const* planar, size_t num_channels, float* dst, size_t frames);
+
+		// left/right = split of src_lr; either output may be null to skip it.
+		static void deinterleave_stereo(const float* src_lr, float* left, float* right, size_t frames);
+
+		// dst_lr = M0 M0 M1 M1 ...
+		static void duplicate_mono_to_stereo(const float* mono, float* dst_lr, size_t frames);
+
+		// mono[i] = 0.5 * (src_lr[2i] + src_lr[2i+1])
+		static void mix_stereo_to_mono(const float* src_lr, float* mono, size_t frames);
+
+		// mono[i] = sum(planar[c][i]) / num_channels; a null planar[c] is a silent channel and still counts,
+		// so one active channel of two folds at 0.5 (as a stereo frame with one side silent always has).
+		static void mix_planar_to_mono(const float* const* planar, size_t num_channels, float* mono, size_t frames);
+	};
+
+} // namespace robotick
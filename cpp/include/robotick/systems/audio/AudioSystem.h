@@ -34,25 +34,69 @@ namespace robotick
 		size_t samples_read = 0;
 	};
 
+	enum class AudioSampleFormat
+	{
+		Float32,
+		Int16,
+	};
+
+	// Device settings to ask for when AudioSystem opens its devices. Properties whose allow_* flag is
+	// set may be changed by the driver (SDL_AUDIO_ALLOW_*_CHANGE) - read the obtained values back with
+	// get_output_info()/get_input_info(); anything not allowed to change is converted by SDL instead.
+	struct AudioDeviceConfig
+	{
+		uint32_t sample_rate = 44100; // output and mic
+		uint16_t buffer_frames = 256; // device period, in frames
+		uint8_t output_channels = 2;  // mic is always mono
+		AudioSampleFormat format = AudioSampleFormat::Float32;
+
+		bool allow_rate_change = true;
+		bool allow_buffer_change = true;
+		bool allow_channel_change = true;
+		bool allow_format_change = false; // Int16 devices are converted to/from float internally
+	};
+
+	// What a device actually opened with.
+	struct AudioDeviceInfo
+	{
+		uint32_t sample_rate = 0;
+		uint16_t buffer_frames = 0;
+		uint8_t channels = 0;
+		AudioSampleFormat format = AudioSampleFormat::Float32;
+	};
+
 	/**
 	 * @brief Singleton audio system wrapper for SDL2
 	 *
-	 * Provides stereo output (float32), mono mic input, and helpers to write
-	 * mono/stereo buffers. All write() calls are non-blocking queue operations.
+	 * Provides multi-channel output (stereo at 44.1 kHz by default, see AudioDeviceConfig), mono mic input,
+	 * and helpers to write mono/stereo/planar float buffers. All write() calls are non-blocking queue
+	 * operations; Int16 devices are converted internally.
 	 */
 	class AudioSystem
 	{
 	  public:
+		static constexpr uint8_t max_output_channels = 8;
+
 		// Initialize the audio system (idempotent)
 		static bool init();
 
-		// Output device info
+		// Device settings to request when the devices are opened. Must precede init() (later calls are
+		// ignored with a warning if they differ); the obtained values may differ - see get_output_info().
+		static void set_requested_config(const AudioDeviceConfig& config);
+		static AudioDeviceConfig get_requested_config();
+
+		// Shorthand for changing only the requested output channel count (default 2).
+		static void set_requested_output_channels(uint8_t channels);
+
+		// Output device info (obtained values; zero before init)
 		static uint32_t get_sample_rate();
 		static uint8_t get_output_channels(); // e.g. 2 for stereo
+		static AudioDeviceInfo get_output_info();
 
 		// Input device info (microphone)
 		static uint32_t get_input_sample_rate();
 		static uint8_t get_input_channels();
+		static AudioDeviceInfo get_input_info();
 
 		// --- Output: convenience APIs ---
 		// Queue a mono buffer (duplicates across channels if device is stereo).
@@ -64,9 +108,16 @@ namespace robotick
 		// Queue separate left/right mono buffers (will interleave internally).
 		static AudioQueueResult write_stereo(const float* left, const float* right, size_t frames);
 
-		// Queue a mono buffer into a specific channel (0=left, 1=right). Other channel is zero.
+		// Queue a mono buffer into a specific channel (0=left, 1=right, ...). Other channels are zero.
 		static AudioQueueResult write_mono_to_channel(int channel, const float* mono, size_t frames);
 
+		// Queue planar buffers (channels[c] feeds output channel c; null = silence) in a single
+		// interleave + queue pass. Extra input channels beyond the device count are ignored, except on a
+		// mono device where all num_channels are folded with equal weight (a null one counts as silence).
+		static AudioQueueResult write_planar(const float* const* channels, uint8_t num_channels, size_t frames);
+
+		static const char* describe_queue_result(AudioQueueResult result);
+
 		// --- Input ---
 		// Read mono float32 samples from the microphone.
 		static AudioReadResult read(float* buffer, size_t max_count);
@@ -81,6 +132,11 @@ namespace robotick
 		static void reset_backpressure_stats();
 		static void record_drop_for_test(uint32_t bytes);
 		static void set_output_spec_for_test(uint32_t sample_rate, uint8_t channels);
+
+		// Collect queued output samples (interleaved, in the test output spec's layout) into buffer instead of
+		// a device, so writes work without one. Restarts the count; pass nullptr to stop capturing.
+		static void set_output_capture_for_test(float* buffer, size_t capacity_samples);
+		static size_t get_captured_samples_for_test();
 	};
 
 } // namespace robotick
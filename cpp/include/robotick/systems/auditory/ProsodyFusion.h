@@ -3,7 +3,9 @@
 
 #pragma once
 
+#include "robotick/framework/concurrency/Sync.h"
 #include "robotick/framework/containers/FixedVector.h"
+#include "robotick/framework/memory/StdApproved.h"
 #include "robotick/systems/auditory/ProsodyState.h"
 #include "robotick/systems/auditory/SpeechToText.h"
 
@@ -33,6 +35,9 @@ namespace robotick
 	// transcript text (proto or finalized) so we do not need a separate string.
 	struct ProsodicSegment
 	{
+		uint32_t segment_id = 0; // stable handle across updates (0 = not yet published)
+		uint32_t revision = 0;	 // fusion revision at which this segment last changed
+
 		float start_time_sec = 0.0f;
 		float end_time_sec = 0.0f;
 
@@ -49,8 +54,91 @@ namespace robotick
 
 	using ProsodicSegmentBuffer = FixedVector<ProsodicSegment, 32>;
 
+	// Segments changed since a given revision. Sized for a typical tick (the live segment plus one transcript
+	// update); a busier tick marks its delta incomplete and mirrors refetch from ProsodicSegmentStore instead.
+	using ProsodicSegmentDelta = FixedVector<ProsodicSegment, 2>;
+
 	void drop_oldest_history(ProsodyHistoryBuffer& buffer, size_t count);
 	void drop_oldest_segments(ProsodicSegmentBuffer& buffer, size_t count);
 	void append_segment_with_capacity(ProsodicSegmentBuffer& buffer, const ProsodicSegment& segment);
 
+	// Copy segments with revision > since_revision into out, in buffer order. Returns false if out could
+	// not hold them all (the newest changes are kept), in which case consumers should resync from the full buffer.
+	bool collect_segments_changed_since(const ProsodicSegmentBuffer& segments, uint32_t since_revision, ProsodicSegmentDelta& out);
+
+	// Merge a delta into a consumer-side mirror: newer revisions replace the segment with the same id,
+	// unknown ids are inserted in id order (evicting the oldest, as the producer does). Re-applying is harmless.
+	void apply_segment_delta(ProsodicSegmentBuffer& mirror, const ProsodicSegmentDelta& delta);
+
+	// Copy of a ProsodyFusion instance's segments, kept current from its delta outputs. A delta only holds the
+	// changes after delta_base_revision, so it is applied only to a mirror that has seen that revision; after a
+	// gap (missed ticks, an incomplete delta, a producer restart) the mirror copies the full set instead.
+	struct ProsodicSegmentMirror
+	{
+		ProsodicSegmentBuffer segments;
+		uint32_t revision = 0;		  // producer revision the mirror reflects
+		uint32_t segments_handle = 0; // ProsodicSegmentStore set followed by the consumer sync()
+
+		// Consumer: on a gap, copy the full set from the ProsodicSegmentStore set named by segments_handle, so
+		// only the delta outputs need wiring. Returns true if the mirror had to resync.
+		bool sync(const ProsodicSegmentDelta& delta,
+			bool delta_complete,
+			uint32_t delta_base_revision,
+			uint32_t producer_revision,
+			uint32_t segments_handle);
+
+		// Producer side (ProsodicSegmentStore): on a gap, copy full_segments. Returns true if the mirror had to resync.
+		bool sync(const ProsodicSegmentDelta& delta,
+			bool delta_complete,
+			uint32_t delta_base_revision,
+			uint32_t producer_revision,
+			const ProsodicSegmentBuffer& full_segments);
+
+		void clear();
+	};
+
+	// Process-local home of each ProsodyFusion instance's latest full segment set. The producer brings its set
+	// up to date after every changing tick (applying the delta in place), and a consumer mirror copies it only
+	// when it has missed a revision - so steady-state ticks move just the delta between workloads.
+	class ProsodicSegmentStore
+	{
+	  public:
+		static constexpr uint32_t kMaxSets = 8;
+
+		// Process-local singleton.
+		static ProsodicSegmentStore& get();
+
+		// Producer: claim a set and return its handle (0 if the store is full). Handles are never reused, so a
+		// mirror following a released set notices. Pair with release_set().
+		uint32_t acquire_set();
+		void release_set(uint32_t handle);
+
+		// Producer, after a tick that changed anything: bring the set up to producer_revision, copying
+		// full_segments only if the delta does not cover every change since the stored revision.
+		void publish(uint32_t handle,
+			const ProsodicSegmentDelta& delta,
+			bool delta_complete,
+			uint32_t delta_base_revision,
+			uint32_t producer_revision,
+			const ProsodicSegmentBuffer& full_segments);
+
+		// Consumer: copy the set (and the revision it reflects) out. Returns false if the handle is unknown.
+		bool copy_set(uint32_t handle, ProsodicSegmentBuffer& out_segments, uint32_t& out_revision) const;
+
+	  private:
+		struct SetEntry
+		{
+			uint32_t handle = 0; // 0 = free
+			std_approved::unique_ptr<ProsodicSegmentMirror> mirror;
+		};
+
+		SetEntry* find_entry(uint32_t handle);
+		const SetEntry* find_entry(uint32_t handle) const;
+
+		// Guards the entries and their segment sets; held for one publish() or copy_set().
+		mutable Mutex mutex_;
+		uint32_t last_handle_ = 0;
+		SetEntry entries_[kMaxSets]{};
+	};
+
 } // namespace robotick
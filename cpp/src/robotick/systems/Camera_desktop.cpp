@@ -5,6 +5,7 @@
 
 #include "robotick/api.h"
 #include "robotick/systems/Camera.h"
+#include "robotick/systems/FrameChangeDetector.h"
 
 #include <cstring>
 #include <opencv2/opencv.hpp>
@@ -16,6 +17,32 @@ namespace robotick
 	{
 	  public:
 		cv::VideoCapture video_capture;
+
+		bool grab(cv::Mat& frame)
+		{
+			if (!video_capture.isOpened())
+				return false;
+
+			if (!video_capture.grab())
+				return false;
+
+			return video_capture.retrieve(frame);
+		}
+
+		static bool encode_jpeg(const cv::Mat& frame, uint8_t* dst_buffer, const size_t dst_capacity, size_t& out_size_used)
+		{
+			// OpenCV only exposes STL vector-based encoders (no fixed buffer hook), so keep STL here and copy out afterward.
+			std_approved::vector<uchar> jpeg_data;
+			if (!cv::imencode(".jpg", frame, jpeg_data))
+				return false;
+
+			if (jpeg_data.size() > dst_capacity)
+				return false;
+
+			::memcpy(dst_buffer, jpeg_data.data(), jpeg_data.size());
+			out_size_used = jpeg_data.size();
+			return true;
+		}
 	};
 
 	Camera::Camera()
@@ -47,26 +74,42 @@ namespace robotick
 
 	bool Camera::read_frame(uint8_t* dst_buffer, const size_t dst_capacity, size_t& out_size_used)
 	{
-		if (!impl->video_capture.isOpened())
+		cv::Mat frame;
+		if (!impl->grab(frame))
 			return false;
 
-		if (!impl->video_capture.grab())
-			return false;
+		return Impl::encode_jpeg(frame, dst_buffer, dst_capacity, out_size_used);
+	}
+
+	bool Camera::read_frame_if_changed(uint8_t* dst_buffer,
+		const size_t dst_capacity,
+		FrameChangeDetector& change_detector,
+		const float min_change_score,
+		const bool force_encode,
+		size_t& out_size_used,
+		float& out_change_score)
+	{
+		out_size_used = 0;
 
 		cv::Mat frame;
-		if (!impl->video_capture.retrieve(frame))
+		if (!impl->grab(frame))
 			return false;
 
-		// OpenCV only exposes STL vector-based encoders (no fixed buffer hook), so keep STL here and copy out afterward.
-		std_approved::vector<uchar> jpeg_data;
-		if (!cv::imencode(".jpg", frame, jpeg_data))
-			return false;
+		if (frame.type() != CV_8UC3)
+		{
+			// Unexpected layout: never gate what we cannot score.
+			out_change_score = 255.0f;
+			return Impl::encode_jpeg(frame, dst_buffer, dst_capacity, out_size_used);
+		}
+
+		out_change_score = change_detector.measure_bgr888(frame.data, frame.cols, frame.rows, frame.step[0]);
+		if (!force_encode && out_change_score < min_change_score)
+			return true;
 
-		if (jpeg_data.size() > dst_capacity)
+		if (!Impl::encode_jpeg(frame, dst_buffer, dst_capacity, out_size_used))
 			return false;
 
-		::memcpy(dst_buffer, jpeg_data.data(), jpeg_data.size());
-		out_size_used = jpeg_data.size();
+		change_detector.accept();
 		return true;
 	}
 
@@ -7,6 +7,7 @@
 
 #include "robotick/api.h"
 #include "robotick/systems/Camera.h"
+#include "robotick/systems/FrameChangeDetector.h"
 
 #include "esp_camera.h"
 #include "esp_heap_caps.h"
@@ -94,6 +95,36 @@ namespace robotick
 		return len;
 	}
 
+	// Encode an RGB565 frame buffer to JPEG in dst_buffer. Does not return the frame buffer.
+	static bool encode_fb_to_jpeg(camera_fb_t* fb, uint8_t* dst_buffer, const size_t dst_capacity, size_t& out_size_used)
+	{
+		if (!fmt2jpg_cb(fb->buf, fb->len, fb->width, fb->height, PIXFORMAT_RGB565, 75, jpeg_output_cb, dst_buffer))
+		{
+			ROBOTICK_WARNING("fmt2jpg_cb() failed");
+			return false;
+		}
+
+		// Find JPEG end marker (0xFFD9)
+		size_t jpeg_len = dst_capacity;
+		for (jpeg_len = 2; jpeg_len < dst_capacity - 1; ++jpeg_len)
+		{
+			if (dst_buffer[jpeg_len] == 0xFF && dst_buffer[jpeg_len + 1] == 0xD9)
+			{
+				jpeg_len += 2;
+				break;
+			}
+		}
+
+		if (jpeg_len >= dst_capacity)
+		{
+			ROBOTICK_WARNING("JPEG frame overran buffer");
+			return false;
+		}
+
+		out_size_used = jpeg_len;
+		return true;
+	}
+
 	bool Camera::read_frame(uint8_t* dst_buffer, const size_t dst_capacity, size_t& out_size_used)
 	{
 		ROBOTICK_INFO("Camera::read_frame - acquiring frame");
@@ -117,39 +148,16 @@ namespace robotick
 
 		ROBOTICK_INFO("fb: width=%d, height=%d, len=%d (expected %d)", fb->width, fb->height, fb->len, fb->width * fb->height * 2);
 
-		size_t jpeg_len = dst_capacity;
-
 		const int64_t encode_start_us = esp_timer_get_time();
 
-		bool ok = fmt2jpg_cb(fb->buf, fb->len, fb->width, fb->height, PIXFORMAT_RGB565, 75, jpeg_output_cb, dst_buffer);
+		const bool ok = encode_fb_to_jpeg(fb, dst_buffer, dst_capacity, out_size_used);
 
 		const int64_t encode_end_us = esp_timer_get_time();
 
 		esp_camera_fb_return(fb);
 
 		if (!ok)
-		{
-			ROBOTICK_WARNING("fmt2jpg_cb() failed");
 			return false;
-		}
-
-		// Find JPEG end marker (0xFFD9)
-		for (jpeg_len = 2; jpeg_len < dst_capacity - 1; ++jpeg_len)
-		{
-			if (dst_buffer[jpeg_len] == 0xFF && dst_buffer[jpeg_len + 1] == 0xD9)
-			{
-				jpeg_len += 2;
-				break;
-			}
-		}
-
-		if (jpeg_len >= dst_capacity)
-		{
-			ROBOTICK_WARNING("JPEG frame overran buffer");
-			return false;
-		}
-
-		out_size_used = jpeg_len;
 
 		const int64_t end_us = esp_timer_get_time();
 
@@ -158,7 +166,41 @@ namespace robotick
 			(got_frame_us - start_us) / 1000.0,
 			(encode_end_us - encode_start_us) / 1000.0);
 
-		ROBOTICK_INFO("JPEG frame ready (%d bytes)", (int)jpeg_len);
+		ROBOTICK_INFO("JPEG frame ready (%d bytes)", (int)out_size_used);
+		return true;
+	}
+
+	bool Camera::read_frame_if_changed(uint8_t* dst_buffer,
+		const size_t dst_capacity,
+		FrameChangeDetector& change_detector,
+		const float min_change_score,
+		const bool force_encode,
+		size_t& out_size_used,
+		float& out_change_score)
+	{
+		out_size_used = 0;
+
+		camera_fb_t* fb = esp_camera_fb_get();
+		if (!fb)
+		{
+			ROBOTICK_WARNING("Camera frame not ready");
+			return false;
+		}
+
+		// Scoring samples a few hundred pixels of the raw frame; the JPEG encode is what gating saves.
+		out_change_score = change_detector.measure_rgb565_be(fb->buf, fb->width, fb->height, static_cast<size_t>(fb->width) * 2);
+		if (!force_encode && out_change_score < min_change_score)
+		{
+			esp_camera_fb_return(fb);
+			return true;
+		}
+
+		const bool ok = encode_fb_to_jpeg(fb, dst_buffer, dst_capacity, out_size_used);
+		esp_camera_fb_return(fb);
+		if (!ok)
+			return false;
+
+		change_detector.accept();
 		return true;
 	}
 
@@ -204,6 +246,24 @@ namespace robotick
 		return false;
 	}
 
+	bool Camera::read_frame_if_changed(uint8_t* dst_buffer,
+		const size_t dst_capacity,
+		FrameChangeDetector& change_detector,
+		const float min_change_score,
+		const bool force_encode,
+		size_t& out_size_used,
+		float& out_change_score)
+	{
+		(void)dst_buffer;
+		(void)dst_capacity;
+		(void)change_detector;
+		(void)min_change_score;
+		(void)force_encode;
+		out_size_used = 0;
+		out_change_score = 0.0f;
+		return false;
+	}
+
 	void Camera::print_available_cameras()
 	{
 		ROBOTICK_INFO("Camera stubs active (ESP32)");
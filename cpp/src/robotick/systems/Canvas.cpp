@@ -3,6 +3,7 @@
 
 #include "robotick/systems/Canvas.h"
 
+#include "robotick/api.h"
 #include "robotick/framework/math/Abs.h"
 #include "robotick/framework/math/MathUtils.h"
 #include "robotick/framework/memory/Memory.h"
@@ -12,11 +13,20 @@
 #endif
 
 #include <cmath>
+#include <cstdio>
 #include <cstring>
 #include <new>
+#include <sys/stat.h>
 
 namespace robotick
 {
+	ROBOTICK_REGISTER_FIXED_VECTOR(CanvasPlotSampleValues, float);
+
+	ROBOTICK_REGISTER_STRUCT_BEGIN(CanvasPlotSamples)
+	ROBOTICK_STRUCT_FIELD(CanvasPlotSamples, uint32_t, sequence)
+	ROBOTICK_STRUCT_FIELD(CanvasPlotSamples, CanvasPlotSampleValues, samples)
+	ROBOTICK_REGISTER_STRUCT_END(CanvasPlotSamples)
+
 	namespace
 	{
 		void reset_node(CanvasNode& node)
@@ -24,6 +34,111 @@ namespace robotick
 			node = CanvasNode{};
 		}
 
+		// Binary scene layout: header, node records in pre-order, child links (node indices, one contiguous
+		// run per parent), control records. Fixed-width fields only, so a file is read with a single fread.
+		constexpr char kBinaryMagic[8] = {'R', 'C', 'A', 'N', 'V', 'A', 'S', 'B'};
+		constexpr uint32_t kBinaryVersion = 2;
+		constexpr size_t kBinaryIdSize = 64;
+
+		// Upper bound on a single plot's ring, to keep a typo from reserving megabytes.
+		constexpr uint32_t kMaxPlotCapacity = 65536;
+
+		constexpr uint64_t kFnvOffset = 1469598103934665603ull;
+		constexpr uint64_t kFnvPrime = 1099511628211ull;
+
+		struct CanvasBinaryHeader
+		{
+			char magic[8];
+			uint32_t version;
+			uint32_t node_count;
+			uint32_t child_link_count;
+			uint32_t control_count;
+			uint64_t source_key;
+			float logical_width;
+			float logical_height;
+			float output_width;
+			float output_height;
+			uint8_t background[4];
+			uint32_t reserved;
+		};
+
+		struct CanvasBinaryNode
+		{
+			char id[kBinaryIdSize];
+			uint32_t type;
+			uint32_t first_child_link;
+			uint32_t child_count;
+			float translate[2];
+			float rotate_deg;
+			float scale[2];
+			float alpha;
+			float ellipse_rx;
+			float ellipse_ry;
+			float rect_w;
+			float rect_h;
+			uint8_t fill[4];
+			uint8_t visible;
+			uint8_t has_fill;
+			uint8_t reserved[2];
+			uint32_t plot_mode;
+			uint32_t plot_capacity;
+			float plot_min;
+			float plot_max;
+			float plot_baseline;
+		};
+
+		struct CanvasBinaryControl
+		{
+			uint32_t node_index;
+			uint32_t property;
+			char alias[kBinaryIdSize];
+		};
+
+		void hash_bytes(uint64_t& hash, const void* data, size_t size)
+		{
+			const uint8_t* bytes = static_cast<const uint8_t*>(data);
+			for (size_t i = 0; i < size; ++i)
+			{
+				hash ^= bytes[i];
+				hash *= kFnvPrime;
+			}
+		}
+
+		void copy_id(char (&dst)[kBinaryIdSize], const char* src)
+		{
+			::strncpy(dst, src ? src : "", kBinaryIdSize - 1);
+			dst[kBinaryIdSize - 1] = '\0';
+		}
+
+		void copy_color(uint8_t (&dst)[4], const Color& color)
+		{
+			dst[0] = color.r;
+			dst[1] = color.g;
+			dst[2] = color.b;
+			dst[3] = color.a;
+		}
+
+		Color to_color(const uint8_t (&src)[4])
+		{
+			Color color;
+			color.r = src[0];
+			color.g = src[1];
+			color.b = src[2];
+			color.a = src[3];
+			return color;
+		}
+
+		bool is_binary_scene_file(const char* path)
+		{
+			FILE* file = ::fopen(path, "rb");
+			if (!file)
+				return false;
+			char magic[sizeof(kBinaryMagic)] = {};
+			const size_t count = ::fread(magic, 1, sizeof(magic), file);
+			::fclose(file);
+			return count == sizeof(magic) && ::memcmp(magic, kBinaryMagic, sizeof(magic)) == 0;
+		}
+
 		Vec2f rotate_vec(const Vec2f& v, float degrees)
 		{
 			if (robotick::abs(degrees) < 1e-4f)
@@ -112,8 +227,10 @@ namespace robotick
 				return CanvasNodeType::Ellipse;
 			if (value == "rect")
 				return CanvasNodeType::Rect;
+			if (value == "plot")
+				return CanvasNodeType::Plot;
 
-			ROBOTICK_FATAL_EXIT("Unknown canvas node type '%s'. Supported: group, ellipse, rect.", value.c_str());
+			ROBOTICK_FATAL_EXIT("Unknown canvas node type '%s'. Supported: group, ellipse, rect, plot.", value.c_str());
 			return CanvasNodeType::Group;
 		}
 #endif
@@ -122,23 +239,430 @@ namespace robotick
 		{
 			return robotick::clamp(value, 0.0f, 1.0f);
 		}
+
+		Color scale_alpha(const Color& color, float opacity)
+		{
+			Color result = color;
+			const float alpha = static_cast<float>(color.a) * clamp01(opacity);
+			result.a = static_cast<uint8_t>(robotick::clamp(alpha, 0.0f, 255.0f));
+			return result;
+		}
 	} // namespace
 
+	void CanvasPlot::push(float value)
+	{
+		if (capacity == 0)
+			return;
+		samples[head] = value;
+		head = (head + 1) % capacity;
+		if (count < capacity)
+			++count;
+	}
+
 	CanvasScene::CanvasScene() = default;
 	CanvasScene::~CanvasScene() = default;
 
 	bool CanvasScene::load_from_file(const char* path)
 	{
-#if !defined(ROBOTICK_PLATFORM_LINUX)
-		(void)path;
-		ROBOTICK_WARNING("CanvasScene::load_from_file is not supported on this platform (yaml-cpp unavailable).");
-		return false;
-#else
 		if (root_ != nullptr || nodes_.size() > 0)
 		{
 			ROBOTICK_FATAL_EXIT("CanvasScene already loaded. Create a new CanvasScene for each scene.");
 		}
 
+		if (path && is_binary_scene_file(path))
+			return load_binary(path, 0);
+
+		return load_yaml(path);
+	}
+
+	bool CanvasScene::load_from_file(const char* path, const CanvasSceneCacheOptions& cache_options, bool* out_cache_hit)
+	{
+		if (out_cache_hit)
+			*out_cache_hit = false;
+
+		if (root_ != nullptr || nodes_.size() > 0)
+		{
+			ROBOTICK_FATAL_EXIT("CanvasScene already loaded. Create a new CanvasScene for each scene.");
+		}
+
+		const uint64_t source_key = compute_source_key(path);
+		if (source_key == 0)
+			return false;
+
+		char cache_path[512];
+		const bool has_cache_path = get_cache_path(path, cache_options, cache_path, sizeof(cache_path));
+		if (has_cache_path && load_binary(cache_path, source_key))
+		{
+			if (out_cache_hit)
+				*out_cache_hit = true;
+			return true;
+		}
+
+		if (!load_yaml(path))
+			return false;
+
+		if (has_cache_path)
+		{
+			if (cache_options.cache_dir && cache_options.cache_dir[0] != '\0')
+				::mkdir(cache_options.cache_dir, 0755);
+
+			// A missing cache only costs the next startup a YAML parse.
+			if (!save_binary(cache_path, source_key))
+				ROBOTICK_WARNING("CanvasScene: unable to write scene cache '%s'.", cache_path);
+		}
+		return true;
+	}
+
+	uint64_t CanvasScene::compute_source_key(const char* path)
+	{
+		FILE* file = path ? ::fopen(path, "rb") : nullptr;
+		if (!file)
+			return 0;
+
+		uint64_t hash = kFnvOffset;
+		// Version the key too, so a format change invalidates existing caches.
+		hash_bytes(hash, &kBinaryVersion, sizeof(kBinaryVersion));
+
+		uint8_t chunk[4096];
+		size_t count = 0;
+		while ((count = ::fread(chunk, 1, sizeof(chunk), file)) > 0)
+		{
+			hash_bytes(hash, chunk, count);
+		}
+		::fclose(file);
+		return (hash == 0) ? 1 : hash;
+	}
+
+	bool CanvasScene::get_cache_path(const char* scene_path, const CanvasSceneCacheOptions& cache_options, char* out_path, size_t out_path_size)
+	{
+		if (!scene_path || scene_path[0] == '\0' || !out_path || out_path_size == 0)
+			return false;
+
+		int written = 0;
+		if (cache_options.cache_dir && cache_options.cache_dir[0] != '\0')
+		{
+			// Scenes with the same file name in different folders must not share a cache entry.
+			const char* slash = ::strrchr(scene_path, '/');
+			const char* base_name = slash ? slash + 1 : scene_path;
+			uint64_t path_hash = kFnvOffset;
+			hash_bytes(path_hash, scene_path, ::strlen(scene_path));
+			written = ::snprintf(
+				out_path, out_path_size, "%s/%s.%08x.canvasb", cache_options.cache_dir, base_name, static_cast<unsigned>(path_hash & 0xffffffffu));
+		}
+		else
+		{
+			written = ::snprintf(out_path, out_path_size, "%s.canvasb", scene_path);
+		}
+
+		return written > 0 && static_cast<size_t>(written) < out_path_size;
+	}
+
+	bool CanvasScene::save_binary(const char* path, uint64_t source_key) const
+	{
+		if (!root_ || !path)
+			return false;
+
+		const size_t node_count = nodes_.size();
+		const size_t link_count = child_links_.size();
+		const size_t control_count = control_bindings_.size();
+		const size_t total_size =
+			sizeof(CanvasBinaryHeader) + node_count * sizeof(CanvasBinaryNode) + link_count * sizeof(uint32_t) + control_count * sizeof(CanvasBinaryControl);
+
+		HeapVector<uint8_t> blob;
+		blob.initialize(total_size);
+		::memset(blob.data(), 0, total_size);
+
+		CanvasBinaryHeader* header = reinterpret_cast<CanvasBinaryHeader*>(blob.data());
+		::memcpy(header->magic, kBinaryMagic, sizeof(kBinaryMagic));
+		header->version = kBinaryVersion;
+		header->node_count = static_cast<uint32_t>(node_count);
+		header->child_link_count = static_cast<uint32_t>(link_count);
+		header->control_count = static_cast<uint32_t>(control_count);
+		header->source_key = source_key;
+		header->logical_width = surface_.logical_width;
+		header->logical_height = surface_.logical_height;
+		header->output_width = surface_.output_width;
+		header->output_height = surface_.output_height;
+		copy_color(header->background, surface_.background);
+
+		CanvasBinaryNode* node_records = reinterpret_cast<CanvasBinaryNode*>(header + 1);
+		for (size_t i = 0; i < node_count; ++i)
+		{
+			const CanvasNode& node = nodes_[i];
+			CanvasBinaryNode& record = node_records[i];
+			copy_id(record.id, node.id.c_str());
+			record.type = static_cast<uint32_t>(node.type);
+			record.first_child_link = node.child_count > 0 ? static_cast<uint32_t>(node.children - child_links_.data()) : 0;
+			record.child_count = node.child_count;
+			record.translate[0] = node.translate.x;
+			record.translate[1] = node.translate.y;
+			record.rotate_deg = node.rotate_deg;
+			record.scale[0] = node.scale.x;
+			record.scale[1] = node.scale.y;
+			record.alpha = node.alpha;
+			record.ellipse_rx = node.ellipse_rx;
+			record.ellipse_ry = node.ellipse_ry;
+			record.rect_w = node.rect_w;
+			record.rect_h = node.rect_h;
+			copy_color(record.fill, node.fill);
+			record.visible = node.visible ? 1 : 0;
+			record.has_fill = node.has_fill ? 1 : 0;
+			record.plot_mode = static_cast<uint32_t>(node.plot.mode);
+			record.plot_capacity = node.plot.capacity;
+			record.plot_min = node.plot.value_min;
+			record.plot_max = node.plot.value_max;
+			record.plot_baseline = node.plot.baseline;
+		}
+
+		uint32_t* link_records = reinterpret_cast<uint32_t*>(node_records + node_count);
+		for (size_t i = 0; i < link_count; ++i)
+		{
+			link_records[i] = static_cast<uint32_t>(child_links_[i] - nodes_.data());
+		}
+
+		CanvasBinaryControl* control_records = reinterpret_cast<CanvasBinaryControl*>(link_records + link_count);
+		for (size_t i = 0; i < control_count; ++i)
+		{
+			const ControlBinding& binding = control_bindings_[i];
+			control_records[i].node_index = static_cast<uint32_t>(binding.node - nodes_.data());
+			control_records[i].property = static_cast<uint32_t>(binding.property);
+			copy_id(control_records[i].alias, control_aliases_[i]);
+		}
+
+		// Write to a temporary file and rename, so a concurrent loader never sees a partial scene.
+		char temp_path[520];
+		const int written = ::snprintf(temp_path, sizeof(temp_path), "%s.tmp", path);
+		if (written <= 0 || static_cast<size_t>(written) >= sizeof(temp_path))
+			return false;
+
+		FILE* file = ::fopen(temp_path, "wb");
+		if (!file)
+			return false;
+		const bool write_ok = ::fwrite(blob.data(), 1, total_size, file) == total_size;
+		const bool close_ok = ::fclose(file) == 0;
+		if (!write_ok || !close_ok || ::rename(temp_path, path) != 0)
+		{
+			::remove(temp_path);
+			return false;
+		}
+		return true;
+	}
+
+	bool CanvasScene::load_binary(const char* path, uint64_t expected_source_key)
+	{
+		FILE* file = ::fopen(path, "rb");
+		if (!file)
+			return false;
+
+		::fseek(file, 0, SEEK_END);
+		const long file_size = ::ftell(file);
+		::fseek(file, 0, SEEK_SET);
+		if (file_size < static_cast<long>(sizeof(CanvasBinaryHeader)))
+		{
+			::fclose(file);
+			return false;
+		}
+
+		// One read for the whole scene; everything below is validation and index-to-pointer fix-up.
+		HeapVector<uint8_t> blob;
+		blob.initialize(static_cast<size_t>(file_size));
+		const bool read_ok = ::fread(blob.data(), 1, blob.size(), file) == blob.size();
+		::fclose(file);
+		if (!read_ok)
+			return false;
+
+		const CanvasBinaryHeader* header = reinterpret_cast<const CanvasBinaryHeader*>(blob.data());
+		if (::memcmp(header->magic, kBinaryMagic, sizeof(kBinaryMagic)) != 0 || header->version != kBinaryVersion)
+			return false;
+		if (expected_source_key != 0 && header->source_key != expected_source_key)
+			return false;
+
+		const size_t node_count = header->node_count;
+		const size_t link_count = header->child_link_count;
+		const size_t control_count = header->control_count;
+		const size_t expected_size =
+			sizeof(CanvasBinaryHeader) + node_count * sizeof(CanvasBinaryNode) + link_count * sizeof(uint32_t) + control_count * sizeof(CanvasBinaryControl);
+		if (node_count == 0 || link_count != node_count - 1 || expected_size != blob.size())
+			return false;
+
+		const CanvasBinaryNode* node_records = reinterpret_cast<const CanvasBinaryNode*>(header + 1);
+		const uint32_t* link_records = reinterpret_cast<const uint32_t*>(node_records + node_count);
+		const CanvasBinaryControl* control_records = reinterpret_cast<const CanvasBinaryControl*>(link_records + link_count);
+
+		// Validate every index before touching scene state, so a bad file leaves the scene unloaded.
+		// The structure must pass the same checks parse_node_recursive()/populate_lookup() apply to YAML: non-empty unique ids,
+		// and a tree - every node but the root claimed as a child exactly once, with no cycles.
+		HeapVector<uint8_t> has_parent;
+		has_parent.initialize(node_count);
+		::memset(has_parent.data(), 0, node_count);
+		size_t claimed_child_count = 0;
+
+		for (size_t i = 0; i < node_count; ++i)
+		{
+			const CanvasBinaryNode& record = node_records[i];
+			if (record.type > static_cast<uint32_t>(CanvasNodeType::Plot) ||
+				static_cast<size_t>(record.first_child_link) + record.child_count > link_count)
+				return false;
+			if (record.type == static_cast<uint32_t>(CanvasNodeType::Plot) &&
+				(record.plot_capacity == 0 || record.plot_capacity > kMaxPlotCapacity || record.plot_mode > static_cast<uint32_t>(CanvasPlotMode::Area)))
+				return false;
+
+			const size_t id_length = ::strnlen(record.id, kBinaryIdSize);
+			if (id_length == 0)
+				return false;
+			for (size_t j = 0; j < i; ++j)
+			{
+				if (::strnlen(node_records[j].id, kBinaryIdSize) == id_length && ::memcmp(node_records[j].id, record.id, id_length) == 0)
+					return false;
+			}
+
+			// Children always come after their parent, which rules out cycles (and the root ever being a child).
+			for (uint32_t c = 0; c < record.child_count; ++c)
+			{
+				const uint32_t child_index = link_records[record.first_child_link + c];
+				if (child_index <= i || child_index >= node_count || has_parent[child_index] != 0)
+					return false;
+				has_parent[child_index] = 1;
+			}
+			claimed_child_count += record.child_count;
+		}
+
+		// No child was claimed twice, so this leaves no node but the root without a parent.
+		if (claimed_child_count != node_count - 1)
+			return false;
+		for (size_t i = 0; i < control_count; ++i)
+		{
+			const CanvasBinaryControl& control = control_records[i];
+			if (control.node_index >= node_count || control.property > static_cast<uint32_t>(ControlProperty::PlotSamples))
+				return false;
+			if (control.property >= static_cast<uint32_t>(ControlProperty::PlotPush) &&
+				node_records[control.node_index].type != static_cast<uint32_t>(CanvasNodeType::Plot))
+				return false;
+		}
+
+		surface_.logical_width = header->logical_width;
+		surface_.logical_height = header->logical_height;
+		surface_.output_width = header->output_width;
+		surface_.output_height = header->output_height;
+		surface_.background = to_color(header->background);
+
+		allocate_storage(node_count, control_count);
+
+		for (size_t i = 0; i < link_count; ++i)
+		{
+			child_links_[i] = &nodes_[link_records[i]];
+		}
+
+		for (size_t i = 0; i < node_count; ++i)
+		{
+			const CanvasBinaryNode& record = node_records[i];
+			CanvasNode& node = nodes_[i];
+			node.id.assign(record.id, ::strnlen(record.id, kBinaryIdSize));
+			node.type = static_cast<CanvasNodeType>(record.type);
+			node.translate = Vec2f(record.translate[0], record.translate[1]);
+			node.rotate_deg = record.rotate_deg;
+			node.scale = Vec2f(record.scale[0], record.scale[1]);
+			node.visible = record.visible != 0;
+			node.alpha = record.alpha;
+			node.has_fill = record.has_fill != 0;
+			node.fill = to_color(record.fill);
+			node.ellipse_rx = record.ellipse_rx;
+			node.ellipse_ry = record.ellipse_ry;
+			node.rect_w = record.rect_w;
+			node.rect_h = record.rect_h;
+			if (node.type == CanvasNodeType::Plot)
+			{
+				node.plot.mode = static_cast<CanvasPlotMode>(record.plot_mode);
+				node.plot.capacity = record.plot_capacity;
+				node.plot.value_min = record.plot_min;
+				node.plot.value_max = record.plot_max;
+				node.plot.baseline = record.plot_baseline;
+			}
+			node.children = record.child_count > 0 ? &child_links_[record.first_child_link] : nullptr;
+			node.child_count = record.child_count;
+
+			// Nodes are stored in pre-order, which is also lookup order; ids were checked for duplicates above.
+			node_lookup_[i].id = node.id.c_str();
+			node_lookup_[i].node = &node;
+		}
+
+		for (size_t i = 0; i < control_count; ++i)
+		{
+			ControlBinding& binding = control_bindings_[i];
+			binding.node = &nodes_[control_records[i].node_index];
+			binding.property = static_cast<ControlProperty>(control_records[i].property);
+			set_control_alias(i, control_records[i].alias);
+		}
+
+		allocate_plot_storage();
+
+		root_ = &nodes_[0];
+		source_path_ = path;
+		return true;
+	}
+
+	void CanvasScene::allocate_storage(size_t node_count, size_t control_count)
+	{
+		nodes_.initialize(node_count);
+		node_lookup_.initialize(node_count);
+		// Every node but the root is exactly one other node's child.
+		if (node_count > 1)
+			child_links_.initialize(node_count - 1);
+
+		if (control_count > 0)
+		{
+			control_bindings_.initialize(control_count);
+			control_aliases_.initialize(control_count);
+			alias_storage_.initialize(control_count);
+		}
+	}
+
+	void CanvasScene::allocate_plot_storage()
+	{
+		// One pool for every plot's ring, so plots add no per-node allocations either.
+		size_t total_capacity = 0;
+		uint32_t max_capacity = 0;
+		for (const CanvasNode& node : nodes_)
+		{
+			if (node.type != CanvasNodeType::Plot)
+				continue;
+			total_capacity += node.plot.capacity;
+			max_capacity = (node.plot.capacity > max_capacity) ? node.plot.capacity : max_capacity;
+		}
+
+		if (total_capacity == 0)
+			return;
+
+		plot_sample_pool_.initialize(total_capacity);
+		// Worst case per draw is two vertices per sample (min/max per column, or two corners per area rect).
+		plot_scratch_.initialize(2 * static_cast<size_t>(max_capacity));
+
+		size_t offset = 0;
+		for (CanvasNode& node : nodes_)
+		{
+			if (node.type != CanvasNodeType::Plot)
+				continue;
+			node.plot.samples = &plot_sample_pool_[offset];
+			node.plot.clear();
+			offset += node.plot.capacity;
+		}
+	}
+
+	void CanvasScene::set_control_alias(size_t index, const char* alias)
+	{
+		if (index >= alias_storage_.size())
+			return;
+		alias_storage_[index] = alias;
+		control_aliases_[index] = alias_storage_[index].c_str();
+	}
+
+	bool CanvasScene::load_yaml(const char* path)
+	{
+#if !defined(ROBOTICK_PLATFORM_LINUX)
+		(void)path;
+		ROBOTICK_WARNING("CanvasScene::load_from_file is not supported on this platform (yaml-cpp unavailable).");
+		return false;
+#else
 		YAML::Node root_yaml;
 		try
 		{
@@ -172,25 +696,19 @@ namespace robotick
 			ROBOTICK_FATAL_EXIT("Canvas scene must contain at least one node.");
 		}
 
-		nodes_.initialize(node_count);
-
-		node_lookup_.initialize(node_count);
-
-		const size_t control_count = count_controls(root_yaml["controls"]);
-		if (control_count > 0)
-		{
-			control_bindings_.initialize(control_count);
-			control_aliases_.initialize(control_count);
-		}
+		allocate_storage(node_count, count_controls(root_yaml["controls"]));
 
 		size_t next_node_index = 0;
-		root_ = parse_node_recursive(scene_node, next_node_index);
+		size_t next_link_index = 0;
+		root_ = parse_node_recursive(scene_node, next_node_index, next_link_index);
 
 		size_t next_lookup_index = 0;
 		populate_lookup(*root_, next_lookup_index);
 
 		parse_controls(root_yaml["controls"]);
 
+		allocate_plot_storage();
+
 		source_path_ = path;
 		return true;
 #endif
@@ -234,6 +752,13 @@ namespace robotick
 			case ControlProperty::Visible:
 				field.type_id = GET_TYPE_ID(bool);
 				break;
+			case ControlProperty::PlotPush:
+				field.type_id = GET_TYPE_ID(float);
+				break;
+			case ControlProperty::PlotAppend:
+			case ControlProperty::PlotSamples:
+				field.type_id = GET_TYPE_ID(CanvasPlotSamples);
+				break;
 			}
 
 			const TypeDescriptor* type_desc = field.find_type_descriptor();
@@ -294,6 +819,13 @@ namespace robotick
 			case ControlProperty::Alpha:
 				controls.set<float>(*binding.field, binding.node->alpha);
 				break;
+			case ControlProperty::PlotPush:
+				controls.set<float>(*binding.field, binding.node->plot.baseline);
+				break;
+			case ControlProperty::PlotAppend:
+			case ControlProperty::PlotSamples:
+				controls.set<CanvasPlotSamples>(*binding.field, CanvasPlotSamples{});
+				break;
 			}
 		}
 	}
@@ -334,6 +866,31 @@ namespace robotick
 			case ControlProperty::Alpha:
 				binding.node->alpha = controls.get<float>(*binding.field);
 				break;
+			case ControlProperty::PlotPush:
+				binding.node->plot.push(controls.get<float>(*binding.field));
+				break;
+			case ControlProperty::PlotAppend:
+			case ControlProperty::PlotSamples:
+			{
+				CanvasPlot& plot = binding.node->plot;
+				const CanvasPlotSamples& chunk = controls.get<CanvasPlotSamples>(*binding.field);
+				if (binding.property == ControlProperty::PlotAppend)
+				{
+					if (chunk.sequence == binding.last_sequence)
+						break;
+					binding.last_sequence = chunk.sequence;
+				}
+				else
+				{
+					plot.clear();
+				}
+
+				for (size_t i = 0; i < chunk.samples.size(); ++i)
+				{
+					plot.push(chunk.samples[i]);
+				}
+				break;
+			}
 			}
 		}
 	}
@@ -364,7 +921,7 @@ namespace robotick
 		surface_.background = parse_color(canvas_node["background"], surface_.background);
 	}
 
-	CanvasNode* CanvasScene::parse_node_recursive(const YAML::Node& yaml_node, size_t& next_index)
+	CanvasNode* CanvasScene::parse_node_recursive(const YAML::Node& yaml_node, size_t& next_index, size_t& next_link_index)
 	{
 		if (!yaml_node || !yaml_node.IsMap())
 			ROBOTICK_FATAL_EXIT("Each node entry must be a map.");
@@ -425,6 +982,38 @@ namespace robotick
 			node->rect_w = geo["w"].as<float>();
 			node->rect_h = geo["h"].as<float>();
 		}
+		else if (node->type == CanvasNodeType::Plot)
+		{
+			const YAML::Node geo = yaml_node["geometry"];
+			if (!geo || !geo.IsMap() || !geo["w"] || !geo["h"])
+				ROBOTICK_FATAL_EXIT("Plot node '%s' requires geometry map with w/h.", node->id.c_str());
+			node->rect_w = geo["w"].as<float>();
+			node->rect_h = geo["h"].as<float>();
+
+			CanvasPlot& plot = node->plot;
+			plot.capacity = 128;
+			if (const YAML::Node plot_node = yaml_node["plot"])
+			{
+				if (!plot_node.IsMap())
+					ROBOTICK_FATAL_EXIT("Plot node '%s' 'plot' must be a map.", node->id.c_str());
+
+				plot.capacity = plot_node["capacity"].as<uint32_t>(plot.capacity);
+				plot.value_min = plot_node["min"].as<float>(plot.value_min);
+				plot.value_max = plot_node["max"].as<float>(plot.value_max);
+				plot.baseline = plot_node["baseline"].as<float>(plot.value_min);
+
+				const std::string mode = plot_node["mode"].as<std::string>("line");
+				if (mode == "line")
+					plot.mode = CanvasPlotMode::Line;
+				else if (mode == "area")
+					plot.mode = CanvasPlotMode::Area;
+				else
+					ROBOTICK_FATAL_EXIT("Plot node '%s' mode '%s' unsupported. Supported: line, area.", node->id.c_str(), mode.c_str());
+			}
+
+			if (plot.capacity == 0 || plot.capacity > kMaxPlotCapacity)
+				ROBOTICK_FATAL_EXIT("Plot node '%s' capacity must be 1..%u.", node->id.c_str(), static_cast<unsigned>(kMaxPlotCapacity));
+		}
 
 		if (const YAML::Node children = yaml_node["children"])
 		{
@@ -434,11 +1023,19 @@ namespace robotick
 			const size_t child_count = children.size();
 			if (child_count > 0)
 			{
-				node->children.initialize(child_count);
+				if (next_link_index + child_count > child_links_.size())
+					ROBOTICK_FATAL_EXIT("Canvas child link allocation exhausted.");
+
+				// Reserve this node's run of links before recursing; grandchildren take the runs after it.
+				CanvasNode** links = &child_links_[next_link_index];
+				next_link_index += child_count;
+				node->children = links;
+				node->child_count = static_cast<uint32_t>(child_count);
+
 				size_t child_index = 0;
 				for (const YAML::Node& child_yaml : children)
 				{
-					node->children[child_index++] = parse_node_recursive(child_yaml, next_index);
+					links[child_index++] = parse_node_recursive(child_yaml, next_index, next_link_index);
 				}
 			}
 		}
@@ -466,9 +1063,9 @@ namespace robotick
 		entry.id = node.id.c_str();
 		entry.node = &node;
 
-		for (CanvasNode* child : node.children)
+		for (uint32_t i = 0; i < node.child_count; ++i)
 		{
-			populate_lookup(*child, next_index);
+			populate_lookup(*node.children[i], next_index);
 		}
 	}
 
@@ -502,12 +1099,7 @@ namespace robotick
 			parse_target(target_node.Scalar().c_str(), binding);
 
 			const auto alias_scalar = alias_node.Scalar();
-			FixedString64 alias_string(alias_scalar.c_str());
-			FixedString64& stored_alias = alias_storage_.push_back(alias_string);
-			if (index < control_aliases_.size())
-			{
-				control_aliases_[index] = stored_alias.c_str();
-			}
+			set_control_alias(index, alias_scalar.c_str());
 			++index;
 		}
 	}
@@ -532,6 +1124,13 @@ namespace robotick
 
 		out_binding.node = node;
 		out_binding.property = parse_property_path(property_path);
+
+		const bool is_plot_property = out_binding.property == ControlProperty::PlotPush || out_binding.property == ControlProperty::PlotAppend ||
+									  out_binding.property == ControlProperty::PlotSamples;
+		if (is_plot_property && node->type != CanvasNodeType::Plot)
+		{
+			ROBOTICK_FATAL_EXIT("CanvasWorkload control target '%s' is only valid on plot nodes.", target);
+		}
 	}
 #endif
 
@@ -555,6 +1154,12 @@ namespace robotick
 			return ControlProperty::Visible;
 		if (::strcmp(path, "alpha") == 0)
 			return ControlProperty::Alpha;
+		if (::strcmp(path, "push") == 0)
+			return ControlProperty::PlotPush;
+		if (::strcmp(path, "append") == 0)
+			return ControlProperty::PlotAppend;
+		if (::strcmp(path, "samples") == 0)
+			return ControlProperty::PlotSamples;
 
 		ROBOTICK_FATAL_EXIT("CanvasWorkload unsupported control target property '%s'.", path);
 		return ControlProperty::Translate;
@@ -614,11 +1219,128 @@ namespace robotick
 				const Vec2f p1(world_translate.x + half_w, world_translate.y + half_h);
 				renderer.draw_rect_filled(p0, p1, color);
 			}
+			else if (node.type == CanvasNodeType::Plot)
+			{
+				if (robotick::abs(world_rotation) > 1e-4f)
+				{
+					ROBOTICK_WARNING("CanvasWorkload plot node '%s' rotation is not supported; ignoring rotation.", node.id.c_str());
+				}
+
+				draw_plot(node, world_translate, world_scale, current_opacity, renderer);
+			}
 		}
 
-		for (CanvasNode* child : node.children)
+		for (uint32_t i = 0; i < node.child_count; ++i)
+		{
+			draw_node_recursive(*node.children[i], world_translate, world_scale, world_rotation, current_visible, current_opacity, renderer);
+		}
+	}
+
+	void CanvasScene::draw_plot(const CanvasNode& node, const Vec2f& center, const Vec2f& scale, float opacity, Renderer& renderer) const
+	{
+		const CanvasPlot& plot = node.plot;
+		if (plot.count == 0 || plot.samples == nullptr)
+			return;
+
+		const Color color = scale_alpha(node.fill, opacity);
+
+		const float width = node.rect_w * robotick::abs(scale.x);
+		const float height = node.rect_h * robotick::abs(scale.y);
+		const float left = center.x - 0.5f * width;
+		const float right = center.x + 0.5f * width;
+		const float bottom = center.y + 0.5f * height;
+
+		const float value_lo = (plot.value_min < plot.value_max) ? plot.value_min : plot.value_max;
+		const float value_hi = (plot.value_min < plot.value_max) ? plot.value_max : plot.value_min;
+		const float range = plot.value_max - plot.value_min;
+		const float y_per_value = (robotick::abs(range) > 1e-12f) ? height / range : 0.0f;
+		auto to_y = [&](float value) { return bottom - (robotick::clamp(value, value_lo, value_hi) - plot.value_min) * y_per_value; };
+
+		// Slots are evenly spaced with the newest sample on the right edge; a partly filled ring grows leftwards.
+		const float slot_dx = (plot.capacity > 1) ? width / static_cast<float>(plot.capacity - 1) : 0.0f;
+		const float first_x = right - static_cast<float>(plot.count - 1) * slot_dx;
+
+		// Decimate to at most one min/max pair per physical pixel column the trace covers.
+		const float covered_px = static_cast<float>(plot.count) * slot_dx * renderer.get_pixel_scale();
+		const uint32_t column_count = (covered_px >= 1.0f) ? static_cast<uint32_t>(covered_px) : 1;
+
+		Vec2f* vertices = plot_scratch_.data();
+		size_t vertex_count = 0;
+
+		if (plot.count <= column_count)
+		{
+			for (uint32_t i = 0; i < plot.count; ++i)
+			{
+				const float x = first_x + static_cast<float>(i) * slot_dx;
+				const float y = to_y(plot.sample(i));
+				if (plot.mode == CanvasPlotMode::Line)
+				{
+					vertices[vertex_count++] = Vec2f(x, y);
+				}
+				else
+				{
+					const float x0 = robotick::clamp(x - 0.5f * slot_dx, left, right);
+					const float x1 = robotick::clamp(x + 0.5f * slot_dx, left, right);
+					vertices[vertex_count++] = Vec2f(x0, y);
+					vertices[vertex_count++] = Vec2f(x1, to_y(plot.baseline));
+				}
+			}
+		}
+		else
+		{
+			const float column_dx = (right - first_x) / static_cast<float>(column_count);
+			for (uint32_t c = 0; c < column_count; ++c)
+			{
+				const uint32_t begin = static_cast<uint32_t>((static_cast<uint64_t>(c) * plot.count) / column_count);
+				const uint32_t end = static_cast<uint32_t>((static_cast<uint64_t>(c + 1) * plot.count) / column_count);
+
+				uint32_t min_index = begin;
+				uint32_t max_index = begin;
+				float min_value = plot.sample(begin);
+				float max_value = min_value;
+				for (uint32_t i = begin + 1; i < end; ++i)
+				{
+					const float value = plot.sample(i);
+					if (value < min_value)
+					{
+						min_value = value;
+						min_index = i;
+					}
+					if (value > max_value)
+					{
+						max_value = value;
+						max_index = i;
+					}
+				}
+
+				const float x0 = first_x + static_cast<float>(c) * column_dx;
+				if (plot.mode == CanvasPlotMode::Line)
+				{
+					// Keep the extremes in time order so the trace does not zig-zag backwards.
+					const float x = x0 + 0.5f * column_dx;
+					const bool min_first = min_index <= max_index;
+					vertices[vertex_count++] = Vec2f(x, to_y(min_first ? min_value : max_value));
+					vertices[vertex_count++] = Vec2f(x, to_y(min_first ? max_value : min_value));
+				}
+				else
+				{
+					const float top_value = (max_value > plot.baseline) ? max_value : plot.baseline;
+					const float bottom_value = (min_value < plot.baseline) ? min_value : plot.baseline;
+					vertices[vertex_count++] = Vec2f(x0, to_y(top_value));
+					vertices[vertex_count++] = Vec2f(x0 + column_dx, to_y(bottom_value));
+				}
+			}
+		}
+
+		if (plot.mode == CanvasPlotMode::Line)
+		{
+			if (vertex_count == 1)
+				vertices[vertex_count++] = vertices[0];
+			renderer.draw_polyline(vertices, vertex_count, color);
+		}
+		else
 		{
-			draw_node_recursive(*child, world_translate, world_scale, world_rotation, current_visible, current_opacity, renderer);
+			renderer.draw_rects_filled(vertices, vertex_count / 2, color);
 		}
 	}
 
@@ -0,0 +1,96 @@
+// Copyright Robotick contributors
+// SPDX-License-Identifier: Apache-2.0
+
+#include "robotick/systems/FrameChangeDetector.h"
+
+#include <cstring>
+
+namespace robotick
+{
+	namespace
+	{
+		// BT.601 luma in 8.8 fixed point.
+		inline uint8_t luma(uint32_t r, uint32_t g, uint32_t b)
+		{
+			return static_cast<uint8_t>((r * 77u + g * 150u + b * 29u) >> 8);
+		}
+
+		// Centre of grid cell i out of cells, in a dimension of size pixels.
+		inline int sample_coord(int i, int cells, int size)
+		{
+			return static_cast<int>(((2 * static_cast<int64_t>(i) + 1) * size) / (2 * cells));
+		}
+	} // namespace
+
+	float FrameChangeDetector::measure_bgr888(const uint8_t* pixels, int width, int height, size_t row_stride_bytes)
+	{
+		if (pixels == nullptr || width <= 0 || height <= 0)
+			return 0.0f;
+
+		for (int gy = 0; gy < kGridHeight; ++gy)
+		{
+			const uint8_t* row = pixels + static_cast<size_t>(sample_coord(gy, kGridHeight, height)) * row_stride_bytes;
+			for (int gx = 0; gx < kGridWidth; ++gx)
+			{
+				const uint8_t* px = row + static_cast<size_t>(sample_coord(gx, kGridWidth, width)) * 3;
+				current_[gy * kGridWidth + gx] = luma(px[2], px[1], px[0]);
+			}
+		}
+
+		has_current_ = true;
+		return score_current();
+	}
+
+	float FrameChangeDetector::measure_rgb565_be(const uint8_t* pixels, int width, int height, size_t row_stride_bytes)
+	{
+		if (pixels == nullptr || width <= 0 || height <= 0)
+			return 0.0f;
+
+		for (int gy = 0; gy < kGridHeight; ++gy)
+		{
+			const uint8_t* row = pixels + static_cast<size_t>(sample_coord(gy, kGridHeight, height)) * row_stride_bytes;
+			for (int gx = 0; gx < kGridWidth; ++gx)
+			{
+				const uint8_t* px = row + static_cast<size_t>(sample_coord(gx, kGridWidth, width)) * 2;
+				const uint32_t value = (static_cast<uint32_t>(px[0]) << 8) | px[1];
+				const uint32_t r = ((value >> 11) & 0x1F) << 3;
+				const uint32_t g = ((value >> 5) & 0x3F) << 2;
+				const uint32_t b = (value & 0x1F) << 3;
+				current_[gy * kGridWidth + gx] = luma(r, g, b);
+			}
+		}
+
+		has_current_ = true;
+		return score_current();
+	}
+
+	void FrameChangeDetector::accept()
+	{
+		if (!has_current_)
+			return;
+
+		::memcpy(reference_, current_, sizeof(reference_));
+		has_reference_ = true;
+	}
+
+	void FrameChangeDetector::reset()
+	{
+		has_reference_ = false;
+		has_current_ = false;
+	}
+
+	float FrameChangeDetector::score_current() const
+	{
+		if (!has_reference_)
+			return 255.0f;
+
+		uint32_t sad = 0;
+		for (int i = 0; i < kGridWidth * kGridHeight; ++i)
+		{
+			const int diff = static_cast<int>(current_[i]) - static_cast<int>(reference_[i]);
+			sad += static_cast<uint32_t>(diff < 0 ? -diff : diff);
+		}
+		return static_cast<float>(sad) / static_cast<float>(kGridWidth * kGridHeight);
+	}
+
+} // namespace robotick
@@ -0,0 +1,327 @@
+// Copyright Robotick contributors
+// SPDX-License-Identifier: Apache-2.0
+
+#include "robotick/systems/ImageFramePool.h"
+
+#include <cstring>
+
+namespace robotick
+{
+	ROBOTICK_REGISTER_ENUM_BEGIN(ImageFormat)
+	ROBOTICK_ENUM_VALUE("Unknown", ImageFormat::Unknown)
+	ROBOTICK_ENUM_VALUE("Jpeg", ImageFormat::Jpeg)
+	ROBOTICK_ENUM_VALUE("Png", ImageFormat::Png)
+	ROBOTICK_ENUM_VALUE("Rgb888", ImageFormat::Rgb888)
+	ROBOTICK_ENUM_VALUE("Rgba8888", ImageFormat::Rgba8888)
+	ROBOTICK_ENUM_VALUE("DepthMetresF32", ImageFormat::DepthMetresF32)
+	ROBOTICK_ENUM_VALUE("DepthMillimetresU16", ImageFormat::DepthMillimetresU16)
+	ROBOTICK_ENUM_VALUE("SegmentationU16", ImageFormat::SegmentationU16)
+	ROBOTICK_REGISTER_ENUM_END(ImageFormat)
+
+	ROBOTICK_REGISTER_STRUCT_BEGIN(ImageHandle)
+	ROBOTICK_STRUCT_FIELD(ImageHandle, uint16_t, pool_id)
+	ROBOTICK_STRUCT_FIELD(ImageHandle, uint16_t, slot)
+	ROBOTICK_STRUCT_FIELD(ImageHandle, uint32_t, generation)
+	ROBOTICK_STRUCT_FIELD(ImageHandle, uint32_t, size_bytes)
+	ROBOTICK_STRUCT_FIELD(ImageHandle, uint16_t, width)
+	ROBOTICK_STRUCT_FIELD(ImageHandle, uint16_t, height)
+	ROBOTICK_STRUCT_FIELD(ImageHandle, ImageFormat, format)
+	ROBOTICK_REGISTER_STRUCT_END(ImageHandle)
+
+	// ======================================================
+	// === ImageFramePool ===================================
+	// ======================================================
+
+	void ImageFramePool::initialize(uint16_t pool_id_in, uint32_t slot_count, size_t slot_capacity_bytes, uint32_t first_generation)
+	{
+		ROBOTICK_ASSERT_MSG(slots.size() == 0, "ImageFramePool::initialize() must only be called once");
+		ROBOTICK_ASSERT(pool_id_in != 0 && slot_count > 0 && slot_count <= UINT16_MAX && slot_capacity_bytes > 0);
+
+		pool_id = pool_id_in;
+		last_generation = first_generation;
+		slot_capacity = slot_capacity_bytes;
+		storage.initialize(static_cast<size_t>(slot_count) * slot_capacity_bytes);
+		slots.initialize(slot_count);
+	}
+
+	uint8_t* ImageFramePool::begin_write()
+	{
+		LockGuard lock(mutex);
+
+		if (writing_slot >= 0)
+		{
+			// An unfinished write is simply restarted.
+			return storage.data() + static_cast<size_t>(writing_slot) * slot_capacity;
+		}
+
+		// Round-robin from the slot after the last one written, so the frame recycled is the oldest free one.
+		for (size_t n = 0; n < slots.size(); ++n)
+		{
+			const size_t i = (next_write_slot + n) % slots.size();
+			Slot& slot = slots[i];
+			if (slot.ref_count != 0 || slot.is_writing)
+				continue;
+
+			// Invalidate any handle still naming this slot's previous frame before its bytes change.
+			slot.generation = ++last_generation;
+			slot.is_writing = true;
+			slot.handle = ImageHandle{};
+			writing_slot = static_cast<int32_t>(i);
+			next_write_slot = (i + 1) % slots.size();
+			return storage.data() + i * slot_capacity;
+		}
+
+		return nullptr;
+	}
+
+	ImageHandle ImageFramePool::publish(size_t size_bytes, ImageFormat format, uint16_t width, uint16_t height)
+	{
+		LockGuard lock(mutex);
+
+		if (writing_slot < 0)
+			return ImageHandle{};
+
+		Slot& slot = slots[static_cast<size_t>(writing_slot)];
+		slot.is_writing = false;
+		slot.ref_count = 1; // held as the latest frame
+
+		ImageHandle& handle = slot.handle;
+		handle.pool_id = pool_id;
+		handle.slot = static_cast<uint16_t>(writing_slot);
+		handle.generation = slot.generation;
+		handle.size_bytes = static_cast<uint32_t>(robotick::min(size_bytes, slot_capacity));
+		handle.width = width;
+		handle.height = height;
+		handle.format = format;
+
+		if (latest_slot >= 0)
+			--slots[static_cast<size_t>(latest_slot)].ref_count;
+
+		latest_slot = writing_slot;
+		writing_slot = -1;
+		return handle;
+	}
+
+	void ImageFramePool::cancel_write()
+	{
+		LockGuard lock(mutex);
+
+		if (writing_slot < 0)
+			return;
+
+		slots[static_cast<size_t>(writing_slot)].is_writing = false;
+		writing_slot = -1;
+	}
+
+	ImageFrameView ImageFramePool::acquire(const ImageHandle& handle)
+	{
+		ImageFrameView view;
+
+		LockGuard lock(mutex);
+		// An unheld frame is still readable until begin_write() claims its slot, which bumps the generation.
+		Slot* slot = find_slot(handle);
+		if (slot == nullptr)
+			return view;
+
+		++slot->ref_count;
+		view.data = storage.data() + static_cast<size_t>(handle.slot) * slot_capacity;
+		view.size = slot->handle.size_bytes;
+		view.handle = slot->handle;
+		return view;
+	}
+
+	void ImageFramePool::release(const ImageFrameView& view)
+	{
+		if (!view.is_valid())
+			return;
+
+		LockGuard lock(mutex);
+		Slot* slot = find_slot(view.handle);
+		if (slot != nullptr && slot->ref_count > 0)
+			--slot->ref_count;
+	}
+
+	ImageHandle ImageFramePool::get_latest() const
+	{
+		LockGuard lock(mutex);
+		return (latest_slot >= 0) ? slots[static_cast<size_t>(latest_slot)].handle : ImageHandle{};
+	}
+
+	uint32_t ImageFramePool::get_free_slot_count() const
+	{
+		LockGuard lock(mutex);
+		uint32_t count = 0;
+		for (size_t i = 0; i < slots.size(); ++i)
+		{
+			if (slots[i].ref_count == 0 && !slots[i].is_writing)
+				++count;
+		}
+		return count;
+	}
+
+	uint32_t ImageFramePool::get_ref_count(const ImageHandle& handle) const
+	{
+		LockGuard lock(mutex);
+		const Slot* slot = find_slot(handle);
+		return slot ? slot->ref_count : 0;
+	}
+
+	uint32_t ImageFramePool::get_last_generation() const
+	{
+		LockGuard lock(mutex);
+		return last_generation;
+	}
+
+	ImageFramePool::Slot* ImageFramePool::find_slot(const ImageHandle& handle)
+	{
+		if (handle.pool_id != pool_id || handle.slot >= slots.size())
+			return nullptr;
+
+		Slot& slot = slots[handle.slot];
+		return (slot.generation == handle.generation && !slot.is_writing) ? &slot : nullptr;
+	}
+
+	const ImageFramePool::Slot* ImageFramePool::find_slot(const ImageHandle& handle) const
+	{
+		return const_cast<ImageFramePool*>(this)->find_slot(handle);
+	}
+
+	// ======================================================
+	// === ScopedImageFrame =================================
+	// ======================================================
+
+	bool ScopedImageFrame::reset(const ImageHandle& handle)
+	{
+		if (pool != nullptr)
+		{
+			pool->release(view);
+			ImageFramePoolRegistry::get().release(pool);
+			pool = nullptr;
+		}
+		view = ImageFrameView{};
+
+		if (!handle.is_valid())
+			return false;
+
+		pool = ImageFramePoolRegistry::get().acquire(handle);
+		if (pool == nullptr)
+			return false;
+
+		view = pool->acquire(handle);
+		if (!view.is_valid())
+		{
+			ImageFramePoolRegistry::get().release(pool);
+			pool = nullptr;
+		}
+		return view.is_valid();
+	}
+
+	// ======================================================
+	// === ImageFramePoolRegistry ===========================
+	// ======================================================
+
+	ImageFramePoolRegistry& ImageFramePoolRegistry::get()
+	{
+		static ImageFramePoolRegistry registry;
+		return registry;
+	}
+
+	ImageFramePool* ImageFramePoolRegistry::acquire(const char* name, uint32_t slot_count, size_t slot_capacity_bytes)
+	{
+		ROBOTICK_ASSERT(name != nullptr && name[0] != '\0');
+
+		LockGuard lock(mutex_);
+
+		PoolEntry* free_entry = nullptr;
+		for (uint32_t i = 0; i < kMaxPools; ++i)
+		{
+			PoolEntry& entry = entries_[i];
+			if (entry.ref_count == 0)
+			{
+				free_entry = free_entry ? free_entry : &entry;
+				continue;
+			}
+			if (::strcmp(entry.name.c_str(), name) != 0)
+				continue;
+
+			ImageFramePool& pool = *entry.pool;
+			if (slot_capacity_bytes > pool.get_slot_capacity())
+			{
+				ROBOTICK_WARNING(
+					"ImageFramePoolRegistry - '%s' holds %zu-byte frames, requested %zu", name, pool.get_slot_capacity(), slot_capacity_bytes);
+				return nullptr;
+			}
+			++entry.ref_count;
+			return &pool;
+		}
+
+		if (free_entry == nullptr)
+		{
+			ROBOTICK_WARNING("ImageFramePoolRegistry capacity exceeded (%lu pools)", static_cast<unsigned long>(kMaxPools));
+			return nullptr;
+		}
+		if (slot_count == 0 || slot_capacity_bytes == 0)
+		{
+			ROBOTICK_WARNING("ImageFramePoolRegistry - cannot create '%s' without a slot count and capacity", name);
+			return nullptr;
+		}
+
+		free_entry->name = name;
+		free_entry->pool = std_approved::make_unique<ImageFramePool>();
+		free_entry->pool->initialize(static_cast<uint16_t>(free_entry - entries_ + 1), slot_count, slot_capacity_bytes, free_entry->last_generation);
+		free_entry->ref_count = 1;
+		return free_entry->pool.get();
+	}
+
+	void ImageFramePoolRegistry::release(ImageFramePool* pool)
+	{
+		if (pool == nullptr)
+			return;
+
+		LockGuard lock(mutex_);
+		for (uint32_t i = 0; i < kMaxPools; ++i)
+		{
+			PoolEntry& entry = entries_[i];
+			if (entry.ref_count == 0 || entry.pool.get() != pool)
+				continue;
+
+			if (--entry.ref_count == 0)
+			{
+				entry.last_generation = entry.pool->get_last_generation();
+				entry.pool.reset();
+				entry.name = "";
+			}
+			return;
+		}
+	}
+
+	ImageFramePool* ImageFramePoolRegistry::acquire(const ImageHandle& handle)
+	{
+		if (!handle.is_valid() || handle.pool_id > kMaxPools)
+			return nullptr;
+
+		LockGuard lock(mutex_);
+		PoolEntry& entry = entries_[handle.pool_id - 1];
+		if (entry.ref_count == 0)
+			return nullptr;
+
+		++entry.ref_count;
+		return entry.pool.get();
+	}
+
+	uint32_t ImageFramePoolRegistry::get_ref_count(const char* name) const
+	{
+		if (name == nullptr)
+			return 0;
+
+		LockGuard lock(mutex_);
+		for (uint32_t i = 0; i < kMaxPools; ++i)
+		{
+			const PoolEntry& entry = entries_[i];
+			if (entry.ref_count > 0 && ::strcmp(entry.name.c_str(), name) == 0)
+				return entry.ref_count;
+		}
+		return 0;
+	}
+
+} // namespace robotick
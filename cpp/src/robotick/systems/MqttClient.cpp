@@ -107,6 +107,18 @@ namespace robotick
 			destination.assign(static_cast<const char*>(src), size);
 			return destination.length() == size;
 		}
+
+		uint8_t to_publish_flag(uint8_t qos)
+		{
+			return (qos == 2) ? MQTT_PUBLISH_QOS_2 : (qos == 1 ? MQTT_PUBLISH_QOS_1 : MQTT_PUBLISH_QOS_0);
+		}
+
+		// Upper bound on a PUBLISH packet: fixed header (1 + up to 4 length bytes), topic length + topic,
+		// packet id, payload.
+		size_t max_publish_packet_size(size_t topic_size, size_t payload_size)
+		{
+			return 1 + 4 + 2 + topic_size + 2 + payload_size;
+		}
 	} // namespace
 
 	void MqttClient::on_publish(void** state, struct mqtt_response_publish* published)
@@ -204,6 +216,17 @@ namespace robotick
 		}
 	}
 
+	void MqttClient::set_store_and_forward(uint32_t max_topics, uint32_t drain_per_poll)
+	{
+		ROBOTICK_ASSERT_MSG(outbox.size() == 0, "MqttClient::set_store_and_forward() must only be called once");
+		if (max_topics == 0)
+			return;
+
+		LockGuard guard(operation_mutex);
+		outbox.initialize(max_topics);
+		outbox_drain_per_poll = (drain_per_poll > 0) ? drain_per_poll : 1;
+	}
+
 	void MqttClient::set_callback(Function<void(const char*, const char*)> cb)
 	{
 		message_callback = robotick::move(cb);
@@ -244,8 +267,14 @@ namespace robotick
 		return MqttOpResult::Error;
 	}
 
-	MqttOpResult MqttClient::publish(const char* topic, const char* payload, bool /*retained*/)
+	MqttOpResult MqttClient::publish(const char* topic, const char* payload, bool retained)
 	{
+		{
+			LockGuard guard(operation_mutex);
+			if (should_hold_publish(retained))
+				return store_in_outbox(topic, payload) ? MqttOpResult::Queued : MqttOpResult::Dropped;
+		}
+
 		if (!ensure_connected_or_drop(true))
 		{
 			return MqttOpResult::Dropped;
@@ -253,8 +282,7 @@ namespace robotick
 
 		const size_t payload_size = payload ? fixed_strlen(payload) : 0;
 		LockGuard guard(operation_mutex);
-		const uint8_t publish_flag =
-			(current_publish_qos == 2) ? MQTT_PUBLISH_QOS_2 : (current_publish_qos == 1 ? MQTT_PUBLISH_QOS_1 : MQTT_PUBLISH_QOS_0);
+		const uint8_t publish_flag = to_publish_flag(current_publish_qos);
 		if (check_result(mqtt_publish(&mqtt, topic, const_cast<char*>(payload), payload_size, publish_flag), "publish"))
 		{
 			check_result(mqtt_sync(&mqtt), "sync");
@@ -272,7 +300,14 @@ namespace robotick
 		}
 
 		LockGuard guard(operation_mutex);
-		check_result(mqtt_sync(&mqtt), "sync");
+		drain_outbox();
+		if (!check_result(mqtt_sync(&mqtt), "sync"))
+		{
+			// mqtt-c stays in its error state once the link has failed; drop the socket so we back off and reconnect
+			// (holding retained publishes in the outbox meanwhile, if enabled).
+			cleanup_socket();
+			schedule_backoff(now_ms());
+		}
 	}
 
 	bool MqttClient::attempt_connect(bool fatal)
@@ -464,6 +499,84 @@ namespace robotick
 		}
 	}
 
+	bool MqttClient::should_hold_publish(bool retained) const
+	{
+		// Once anything is held, newer publishes queue behind it so per-topic order is kept while draining.
+		return retained && outbox.size() > 0 && (!is_connected() || backpressure_stats.pending_publishes > 0);
+	}
+
+	bool MqttClient::store_in_outbox(const char* topic, const char* payload)
+	{
+		const size_t topic_size = topic ? fixed_strlen(topic) : 0;
+		const size_t payload_size = payload ? fixed_strlen(payload) : 0;
+
+		OutboxEntry* free_entry = nullptr;
+		for (size_t i = 0; i < outbox.size(); ++i)
+		{
+			OutboxEntry& entry = outbox[i];
+			if (!entry.pending)
+			{
+				free_entry = free_entry ? free_entry : &entry;
+				continue;
+			}
+			if (::strcmp(entry.topic.c_str(), topic ? topic : "") != 0)
+				continue;
+
+			// Only the latest value matters; it keeps the original place in the drain order.
+			entry.payload.assign(payload, payload_size);
+			backpressure_stats.queued_publishes++;
+			backpressure_stats.coalesced_publishes++;
+			return true;
+		}
+
+		if (free_entry == nullptr || topic_size >= free_entry->topic.capacity() || payload_size >= free_entry->payload.capacity())
+		{
+			record_backpressure(true);
+			return false;
+		}
+
+		free_entry->topic.assign(topic, topic_size);
+		free_entry->payload.assign(payload, payload_size);
+		free_entry->sequence = ++outbox_sequence;
+		free_entry->pending = true;
+		backpressure_stats.queued_publishes++;
+		backpressure_stats.pending_publishes++;
+		return true;
+	}
+
+	void MqttClient::drain_outbox()
+	{
+		for (uint32_t sent = 0; sent < outbox_drain_per_poll && backpressure_stats.pending_publishes > 0; ++sent)
+		{
+			OutboxEntry* oldest = nullptr;
+			for (size_t i = 0; i < outbox.size(); ++i)
+			{
+				OutboxEntry& entry = outbox[i];
+				if (entry.pending && (oldest == nullptr || static_cast<int32_t>(entry.sequence - oldest->sequence) < 0))
+					oldest = &entry;
+			}
+			if (oldest == nullptr)
+				break;
+
+			// Never let mqtt-c hit a full send buffer (its error is sticky): stop once QoS 1/2 messages awaiting
+			// acknowledgement have used the space, and carry on from here on the next poll.
+			const size_t packet_size = max_publish_packet_size(oldest->topic.length(), oldest->payload.length());
+			if (static_cast<size_t>(mqtt_mq_currsz(&mqtt.mq)) < packet_size)
+			{
+				mqtt_mq_clean(&mqtt.mq);
+				if (static_cast<size_t>(mqtt_mq_currsz(&mqtt.mq)) < packet_size)
+					break;
+			}
+
+			const uint8_t publish_flag = to_publish_flag(current_publish_qos);
+			if (!check_result(mqtt_publish(&mqtt, oldest->topic.c_str(), oldest->payload.str(), oldest->payload.length(), publish_flag), "publish"))
+				break;
+
+			oldest->pending = false;
+			backpressure_stats.pending_publishes--;
+		}
+	}
+
 	const MqttClient::BackpressureStats& MqttClient::get_backpressure_stats() const
 	{
 		return backpressure_stats;
@@ -8,6 +8,12 @@
 #include "robotick/framework/memory/Memory.h"
 #include "robotick/framework/memory/StdApproved.h"
 
+#include <cfloat>
+#include <climits>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+
 namespace robotick
 {
 	static const char* mqtt_op_result_str(MqttOpResult result)
@@ -16,6 +22,8 @@ namespace robotick
 		{
 		case MqttOpResult::Success:
 			return "success";
+		case MqttOpResult::Queued:
+			return "queued";
 		case MqttOpResult::Dropped:
 			return "dropped";
 		case MqttOpResult::Error:
@@ -40,6 +48,18 @@ namespace robotick
 			return true;
 		}
 
+		// FNV-1a over the payload text: last_published only needs to recognise an echo, not reproduce it.
+		uint64_t hash_payload(const char* payload)
+		{
+			uint64_t hash = 1469598103934665603ull;
+			for (const char* c = payload; *c != '\0'; ++c)
+			{
+				hash ^= static_cast<uint8_t>(*c);
+				hash *= 1099511628211ull;
+			}
+			return hash;
+		}
+
 		void replace_characters(FixedString512& str, char from, char to)
 		{
 			char* data = str.str();
@@ -49,6 +69,311 @@ namespace robotick
 					data[i] = to;
 			}
 		}
+
+		// ------------------------------------------------------------------
+		// Control payload decoding. Payloads are JSON text; scalars, strings and enums are decoded straight
+		// into the field, without building a json value first.
+		// ------------------------------------------------------------------
+
+		const char* skip_whitespace(const char* text)
+		{
+			while (*text == ' ' || *text == '\t' || *text == '\r' || *text == '\n')
+				++text;
+			return text;
+		}
+
+		bool is_digit(char c)
+		{
+			return c >= '0' && c <= '9';
+		}
+
+		// Returns the end of a JSON number starting at text, or nullptr if there isn't one.
+		// (strtod alone would also accept hex, "inf" and "nan", none of which are JSON.)
+		const char* scan_json_number(const char* text)
+		{
+			if (*text == '-')
+				++text;
+			if (*text == '0')
+				++text;
+			else if (is_digit(*text))
+			{
+				while (is_digit(*text))
+					++text;
+			}
+			else
+				return nullptr;
+
+			if (*text == '.')
+			{
+				++text;
+				if (!is_digit(*text))
+					return nullptr;
+				while (is_digit(*text))
+					++text;
+			}
+			if (*text == 'e' || *text == 'E')
+			{
+				++text;
+				if (*text == '+' || *text == '-')
+					++text;
+				if (!is_digit(*text))
+					return nullptr;
+				while (is_digit(*text))
+					++text;
+			}
+			return text;
+		}
+
+		bool parse_number(const char* payload, double& out)
+		{
+			const char* start = skip_whitespace(payload);
+			const char* end = scan_json_number(start);
+			if (!end || *skip_whitespace(end) != '\0')
+				return false;
+
+			out = ::strtod(start, nullptr);
+			return out != HUGE_VAL && out != -HUGE_VAL;
+		}
+
+		template <typename T> bool parse_integer(const char* payload, double min_value, double max_value, T& out)
+		{
+			// Accepts "3" and "3.0" (UIs often send every number as a double) but not "3.5".
+			double value = 0.0;
+			if (!parse_number(payload, value) || value < min_value || value > max_value || value != static_cast<double>(static_cast<int64_t>(value)))
+				return false;
+
+			out = static_cast<T>(value);
+			return true;
+		}
+
+		template <typename T> bool parse_real(const char* payload, double max_magnitude, T& out)
+		{
+			double value = 0.0;
+			if (!parse_number(payload, value) || value > max_magnitude || value < -max_magnitude)
+				return false;
+
+			out = static_cast<T>(value);
+			return true;
+		}
+
+		bool parse_bool(const char* payload, bool& out)
+		{
+			const char* start = skip_whitespace(payload);
+			const char* end = start;
+			if (::strncmp(start, "true", 4) == 0)
+			{
+				out = true;
+				end += 4;
+			}
+			else if (::strncmp(start, "false", 5) == 0)
+			{
+				out = false;
+				end += 5;
+			}
+			else if (*start == '0' || *start == '1')
+			{
+				out = (*start == '1');
+				end += 1;
+			}
+			else
+			{
+				return false;
+			}
+			return *skip_whitespace(end) == '\0';
+		}
+
+		bool parse_hex4(const char* text, uint32_t& out)
+		{
+			out = 0;
+			for (int i = 0; i < 4; ++i)
+			{
+				const char c = text[i];
+				uint32_t digit = 0;
+				if (c >= '0' && c <= '9')
+					digit = static_cast<uint32_t>(c - '0');
+				else if (c >= 'a' && c <= 'f')
+					digit = static_cast<uint32_t>(c - 'a' + 10);
+				else if (c >= 'A' && c <= 'F')
+					digit = static_cast<uint32_t>(c - 'A' + 10);
+				else
+					return false;
+				out = (out << 4) | digit;
+			}
+			return true;
+		}
+
+		size_t encode_utf8(uint32_t code_point, char* out)
+		{
+			if (code_point < 0x80)
+			{
+				out[0] = static_cast<char>(code_point);
+				return 1;
+			}
+			if (code_point < 0x800)
+			{
+				out[0] = static_cast<char>(0xC0 | (code_point >> 6));
+				out[1] = static_cast<char>(0x80 | (code_point & 0x3F));
+				return 2;
+			}
+			if (code_point < 0x10000)
+			{
+				out[0] = static_cast<char>(0xE0 | (code_point >> 12));
+				out[1] = static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+				out[2] = static_cast<char>(0x80 | (code_point & 0x3F));
+				return 3;
+			}
+			out[0] = static_cast<char>(0xF0 | (code_point >> 18));
+			out[1] = static_cast<char>(0x80 | ((code_point >> 12) & 0x3F));
+			out[2] = static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+			out[3] = static_cast<char>(0x80 | (code_point & 0x3F));
+			return 4;
+		}
+
+		// Decodes a JSON string literal (quotes and escapes) into out. Fails rather than truncates.
+		bool parse_json_string(const char* payload, char* out, size_t out_capacity)
+		{
+			const char* text = skip_whitespace(payload);
+			if (*text != '"')
+				return false;
+			++text;
+
+			size_t length = 0;
+			while (*text != '"')
+			{
+				char encoded[4] = {};
+				size_t encoded_length = 1;
+
+				const char c = *text++;
+				if (c == '\0' || static_cast<unsigned char>(c) < 0x20)
+					return false;
+
+				if (c != '\\')
+				{
+					encoded[0] = c;
+				}
+				else
+				{
+					const char escape = *text++;
+					switch (escape)
+					{
+					case '"':
+					case '\\':
+					case '/':
+						encoded[0] = escape;
+						break;
+					case 'b':
+						encoded[0] = '\b';
+						break;
+					case 'f':
+						encoded[0] = '\f';
+						break;
+					case 'n':
+						encoded[0] = '\n';
+						break;
+					case 'r':
+						encoded[0] = '\r';
+						break;
+					case 't':
+						encoded[0] = '\t';
+						break;
+					case 'u':
+					{
+						uint32_t code_point = 0;
+						if (!parse_hex4(text, code_point))
+							return false;
+						text += 4;
+
+						if (code_point >= 0xD800 && code_point <= 0xDBFF)
+						{
+							uint32_t low = 0;
+							if (text[0] != '\\' || text[1] != 'u' || !parse_hex4(text + 2, low) || low < 0xDC00 || low > 0xDFFF)
+								return false;
+							text += 6;
+							code_point = 0x10000 + ((code_point - 0xD800) << 10) + (low - 0xDC00);
+						}
+						else if (code_point >= 0xDC00 && code_point <= 0xDFFF)
+						{
+							return false;
+						}
+						encoded_length = encode_utf8(code_point, encoded);
+						break;
+					}
+					default:
+						return false;
+					}
+				}
+
+				if (length + encoded_length >= out_capacity)
+					return false;
+				::memcpy(out + length, encoded, encoded_length);
+				length += encoded_length;
+			}
+
+			out[length] = '\0';
+			return *skip_whitespace(text + 1) == '\0';
+		}
+
+		template <typename FixedStringType> bool parse_string(const char* payload, FixedStringType& out)
+		{
+			FixedStringType decoded;
+			if (!parse_json_string(payload, decoded.data, decoded.capacity()))
+				return false;
+
+			out = decoded;
+			return true;
+		}
+
+		bool decode_control_payload(const char* payload, const TypeId& type, const TypeDescriptor& type_desc, void* dst)
+		{
+			if (type == GET_TYPE_ID(int))
+				return parse_integer(payload, INT_MIN, INT_MAX, *static_cast<int*>(dst));
+			if (type == GET_TYPE_ID(uint8_t))
+				return parse_integer(payload, 0, UINT8_MAX, *static_cast<uint8_t*>(dst));
+			if (type == GET_TYPE_ID(uint16_t))
+				return parse_integer(payload, 0, UINT16_MAX, *static_cast<uint16_t*>(dst));
+			if (type == GET_TYPE_ID(uint32_t))
+				return parse_integer(payload, 0, UINT32_MAX, *static_cast<uint32_t*>(dst));
+			if (type == GET_TYPE_ID(float))
+				return parse_real(payload, FLT_MAX, *static_cast<float*>(dst));
+			if (type == GET_TYPE_ID(double))
+				return parse_real(payload, DBL_MAX, *static_cast<double*>(dst));
+			if (type == GET_TYPE_ID(bool))
+				return parse_bool(payload, *static_cast<bool*>(dst));
+			if (type == GET_TYPE_ID(FixedString8))
+				return parse_string(payload, *static_cast<FixedString8*>(dst));
+			if (type == GET_TYPE_ID(FixedString16))
+				return parse_string(payload, *static_cast<FixedString16*>(dst));
+			if (type == GET_TYPE_ID(FixedString32))
+				return parse_string(payload, *static_cast<FixedString32*>(dst));
+			if (type == GET_TYPE_ID(FixedString64))
+				return parse_string(payload, *static_cast<FixedString64*>(dst));
+			if (type == GET_TYPE_ID(FixedString128))
+				return parse_string(payload, *static_cast<FixedString128*>(dst));
+			if (type == GET_TYPE_ID(FixedString256))
+				return parse_string(payload, *static_cast<FixedString256*>(dst));
+			if (type == GET_TYPE_ID(FixedString512))
+				return parse_string(payload, *static_cast<FixedString512*>(dst));
+			if (type == GET_TYPE_ID(FixedString1024))
+				return parse_string(payload, *static_cast<FixedString1024*>(dst));
+
+			if (type_desc.get_enum_desc() != nullptr)
+			{
+				// Enums are published by name, as a JSON string.
+				FixedString128 enum_name;
+				return parse_string(payload, enum_name) && type_desc.from_string(enum_name.c_str(), dst);
+			}
+
+			// Structured values: normalise through nlohmann::json and let the type parse the result.
+			try
+			{
+				const std_approved::string value_str = nlohmann::json::parse(payload).dump();
+				return type_desc.from_string(value_str.c_str(), dst);
+			}
+			catch (...)
+			{
+				return false;
+			}
+		}
 	} // namespace
 
 	MqttFieldSync::MqttFieldSync(const char* root_ns, PublisherFn in_publisher)
@@ -74,28 +399,19 @@ namespace robotick
 					FixedString512 control_prefix;
 					control_prefix.format("%s/control/", root.c_str());
 
-					if (!topic_starts_with(topic, control_prefix.c_str()))
-						return;
-
-					nlohmann::json incoming;
-					try
-					{
-						incoming = nlohmann::json::parse(payload);
-					}
-					catch (...)
-					{
-						ROBOTICK_WARNING("MqttFieldSync - Ignoring malformed JSON from topic: %s", topic ? topic : "(null)");
+					if (!topic_starts_with(topic, control_prefix.c_str()) || !payload)
 						return;
-					}
 
+					// The payload is kept as raw text here and decoded once, into the field, by apply_control_updates().
 					FixedString256 topic_key;
-					topic_key.assign(topic, topic ? fixed_strlen(topic) : 0);
+					topic_key.assign(topic, fixed_strlen(topic));
 
-					auto* previous = last_published.find(topic_key);
-					if (previous && *previous == incoming)
+					// Our own retained control publishes are echoed back by the broker - skip them.
+					const uint64_t* previous_hash = last_published.find(topic_key);
+					if (previous_hash && *previous_hash == hash_payload(payload))
 						return;
 
-					queue_control_topic(topic, incoming);
+					queue_control_topic(topic, payload);
 				});
 		}
 		catch (...)
@@ -109,15 +425,32 @@ namespace robotick
 		return starts_with(topic, prefix);
 	}
 
-	void MqttFieldSync::queue_control_topic(const char* topic, const nlohmann::json& value)
+	void MqttFieldSync::queue_control_topic(const char* topic, const char* payload)
 	{
-		store_topic(updated_topics, topic, value);
+		store_topic(updated_topics, topic, payload);
 	}
 
-	void MqttFieldSync::store_topic(TopicMap& table, const char* topic, const nlohmann::json& value)
+	bool MqttFieldSync::store_topic(TopicMap& table, const char* topic, const char* payload)
 	{
+		const size_t topic_length = topic ? fixed_strlen(topic) : 0;
+		const size_t payload_length = payload ? fixed_strlen(payload) : 0;
+
+		// A shortened topic could name another field, and a shortened payload is not valid JSON - drop either.
 		FixedString256 key;
-		key.assign(topic, topic ? fixed_strlen(topic) : 0);
+		FixedString1024 value;
+		if (topic_length >= key.capacity() || payload_length >= value.capacity())
+		{
+			metrics.oversize_skips++;
+			ROBOTICK_WARNING("MqttFieldSync - skipping topic '%.64s' (%zu chars) with a %zu-char payload: limits are %zu and %zu chars",
+				topic ? topic : "",
+				topic_length,
+				payload_length,
+				key.capacity() - 1,
+				value.capacity() - 1);
+			return false;
+		}
+		key.assign(topic, topic_length);
+		value.assign(payload, payload_length);
 
 		if (auto* existing = table.find(key))
 		{
@@ -127,6 +460,24 @@ namespace robotick
 		{
 			table.insert(key, value);
 		}
+		return true;
+	}
+
+	void MqttFieldSync::store_published_topic(const char* topic, const char* payload)
+	{
+		// Published topics come from root and field paths, which publish_fields() has already checked for length.
+		FixedString256 key;
+		key.assign(topic, fixed_strlen(topic));
+
+		const uint64_t hash = hash_payload(payload);
+		if (uint64_t* existing = last_published.find(key))
+		{
+			*existing = hash;
+		}
+		else
+		{
+			last_published.insert(key, hash);
+		}
 	}
 
 	MqttOpResult MqttFieldSync::subscribe_and_sync_startup()
@@ -162,7 +513,7 @@ namespace robotick
 		const size_t prefix_len = control_prefix.length();
 
 		updated_topics.for_each(
-			[&](const FixedString256& topic_key, nlohmann::json& json_value)
+			[&](const FixedString256& topic_key, FixedString1024& payload)
 			{
 				const char* topic_cstr = topic_key.c_str();
 				if (!topic_starts_with(topic_cstr, control_prefix.c_str()))
@@ -186,11 +537,10 @@ namespace robotick
 					return;
 				}
 
-				const std_approved::string value_str = json_value.dump();
-				if (!type_desc->from_string(value_str.c_str(), info.ptr))
+				if (!decode_control_payload(payload.c_str(), info.descriptor->type_id, *type_desc, info.ptr))
 				{
 					ROBOTICK_WARNING(
-						"MqttFieldSync::apply_control_updates() - failed to parse value '%s' for field '%s'", value_str.c_str(), path.c_str());
+						"MqttFieldSync::apply_control_updates() - failed to parse value '%s' for field '%s'", payload.c_str(), path.c_str());
 					return;
 				}
 			});
@@ -270,20 +620,37 @@ namespace robotick
 						return;
 
 					nlohmann::json value = serialize(view.field_ptr, type);
+					const std_approved::string dumped = value.dump();
 
 					FixedString512 state_topic;
 					state_topic.format("%s/state/%s", root.c_str(), path_so_far.c_str());
-					store_topic(last_published, state_topic.c_str(), value);
 
+					// Topics and payloads are bounded by the fixed strings used here and by MqttClient. A shortened topic
+					// could name another field and a shortened payload is invalid JSON, so the field is skipped instead.
+					FixedString256 topic_key;
 					FixedString1024 payload;
-					const std_approved::string dumped = value.dump();
+					const bool publishes_control = publish_control && !is_struct_read_only;
+					const size_t longest_topic_length = state_topic.length() + (publishes_control ? sizeof("control") - sizeof("state") : 0);
+					if (longest_topic_length >= topic_key.capacity() || dumped.size() >= payload.capacity())
+					{
+						// Publishing runs every tick, so only the first skip is logged; the metric counts them all.
+						metrics.oversize_skips++;
+						ROBOTICK_WARNING_ONCE("MqttFieldSync - not publishing '%s': %zu-char topic (limit %zu), %zu-char payload (limit %zu)",
+							path_so_far.c_str(),
+							longest_topic_length,
+							topic_key.capacity() - 1,
+							dumped.size(),
+							payload.capacity() - 1);
+						return;
+					}
 					payload.assign(dumped.c_str(), dumped.size());
+					store_published_topic(state_topic.c_str(), payload.c_str());
 
 					if (mqtt_ptr)
 					{
 						const MqttOpResult pub_res = mqtt_ptr->publish(state_topic.c_str(), payload.c_str(), true);
 						metrics.last_state_result = pub_res;
-						if (pub_res != MqttOpResult::Success)
+						if (pub_res != MqttOpResult::Success && pub_res != MqttOpResult::Queued)
 						{
 							metrics.state_publish_failures++;
 							ROBOTICK_WARNING(
@@ -297,17 +664,17 @@ namespace robotick
 						publisher(relative_topic.c_str(), payload.c_str(), true);
 					}
 
-					if (publish_control && !is_struct_read_only)
+					if (publishes_control)
 					{
 						FixedString512 control_topic;
 						control_topic.format("%s/control/%s", root.c_str(), path_so_far.c_str());
-						store_topic(last_published, control_topic.c_str(), value);
+						store_published_topic(control_topic.c_str(), payload.c_str());
 
 						if (mqtt_ptr)
 						{
 							const MqttOpResult control_res = mqtt_ptr->publish(control_topic.c_str(), payload.c_str(), true);
 							metrics.last_control_result = control_res;
-							if (control_res != MqttOpResult::Success)
+							if (control_res != MqttOpResult::Success && control_res != MqttOpResult::Queued)
 							{
 								metrics.control_publish_failures++;
 								ROBOTICK_WARNING("MqttFieldSync - Failed to publish control topic %s (%s)",
@@ -380,7 +747,7 @@ namespace robotick
 	{
 	}
 
-	void MqttFieldSync::queue_control_topic(const char*, const nlohmann::json&)
+	void MqttFieldSync::queue_control_topic(const char*, const char*)
 	{
 	}
 
@@ -389,7 +756,12 @@ namespace robotick
 		return nlohmann::json();
 	}
 
-	void MqttFieldSync::store_topic(TopicMap&, const char*, const nlohmann::json&)
+	bool MqttFieldSync::store_topic(TopicMap&, const char*, const char*)
+	{
+		return false;
+	}
+
+	void MqttFieldSync::store_published_topic(const char*, const char*)
 	{
 	}
 
@@ -0,0 +1,459 @@
+// Copyright Robotick contributors
+// SPDX-License-Identifier: Apache-2.0
+
+#include "robotick/systems/MuJoCoModelCache.h"
+
+#include "robotick/api.h"
+#include "robotick/framework/memory/StdApproved.h"
+#include "robotick/framework/strings/FixedString.h"
+
+#if defined(ROBOTICK_PLATFORM_DESKTOP) || defined(ROBOTICK_PLATFORM_LINUX)
+
+#include <cstdio>
+#include <cstring>
+#include <mujoco/mujoco.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace robotick
+{
+	namespace
+	{
+		constexpr uint64_t kFnvOffset = 1469598103934665603ull;
+		constexpr uint64_t kFnvPrime = 1099511628211ull;
+		constexpr int kMaxIncludeDepth = 8;
+
+		void hash_bytes(uint64_t& hash, const void* data, size_t size)
+		{
+			const uint8_t* bytes = static_cast<const uint8_t*>(data);
+			for (size_t i = 0; i < size; ++i)
+			{
+				hash ^= bytes[i];
+				hash *= kFnvPrime;
+			}
+		}
+
+		void hash_string(uint64_t& hash, const char* text) { hash_bytes(hash, text, ::strlen(text) + 1); }
+
+		// Hash a file's contents (streamed); a missing file still changes the key so it can't alias an existing one.
+		bool hash_file(uint64_t& hash, const char* path)
+		{
+			hash_string(hash, path);
+
+			FILE* file = ::fopen(path, "rb");
+			if (file == nullptr)
+			{
+				hash_string(hash, "<missing>");
+				return false;
+			}
+
+			uint8_t chunk[16384];
+			size_t count = 0;
+			while ((count = ::fread(chunk, 1, sizeof(chunk), file)) > 0)
+			{
+				hash_bytes(hash, chunk, count);
+			}
+			::fclose(file);
+			return true;
+		}
+
+		bool read_text_file(const char* path, std_approved::vector<char>& out)
+		{
+			FILE* file = ::fopen(path, "rb");
+			if (file == nullptr)
+			{
+				return false;
+			}
+
+			out.clear();
+			char chunk[16384];
+			size_t count = 0;
+			while ((count = ::fread(chunk, 1, sizeof(chunk), file)) > 0)
+			{
+				out.insert(out.end(), chunk, chunk + count);
+			}
+			::fclose(file);
+			out.push_back('\0');
+			return true;
+		}
+
+		void get_directory(const char* path, FixedString512& out)
+		{
+			const char* slash = ::strrchr(path, '/');
+			if (slash == nullptr)
+			{
+				out = ".";
+				return;
+			}
+			out.assign(path, static_cast<size_t>(slash - path));
+		}
+
+		void join_path(const char* dir, const char* relative, FixedString512& out)
+		{
+			if (relative[0] == '/' || dir == nullptr || dir[0] == '\0')
+			{
+				out = relative;
+				return;
+			}
+			out.format("%s/%s", dir, relative);
+		}
+
+		enum class AssetDir : uint8_t
+		{
+			Model,
+			Mesh,
+			Texture
+		};
+
+		struct AssetReference
+		{
+			FixedString256 file;
+			AssetDir dir = AssetDir::Model;
+		};
+
+		struct ScanContext
+		{
+			FixedString512 model_dir;
+			FixedString256 meshdir;
+			FixedString256 texturedir;
+			FixedString256 assetdir;
+			std_approved::vector<AssetReference> assets;
+			uint64_t hash = kFnvOffset;
+		};
+
+		bool tag_is(const char* name, size_t name_length, const char* expected)
+		{
+			return ::strlen(expected) == name_length && ::strncmp(name, expected, name_length) == 0;
+		}
+
+		void scan_mjcf_file(ScanContext& context, const char* path, int depth);
+
+		// Walk the tags of one MJCF file: note <compiler> asset dirs, queue file-backed assets, recurse into <include>.
+		void scan_mjcf_text(ScanContext& context, const char* text, int depth)
+		{
+			const char* cursor = text;
+			while ((cursor = ::strchr(cursor, '<')) != nullptr)
+			{
+				if (::strncmp(cursor, "<!--", 4) == 0)
+				{
+					const char* end = ::strstr(cursor + 4, "-->");
+					if (end == nullptr)
+						return;
+					cursor = end + 3;
+					continue;
+				}
+
+				++cursor;
+				if (*cursor == '/' || *cursor == '?' || *cursor == '!')
+					continue;
+
+				const char* name = cursor;
+				while (*cursor && *cursor != '>' && *cursor != '/' && *cursor != ' ' && *cursor != '\t' && *cursor != '\r' && *cursor != '\n')
+					++cursor;
+				const size_t name_length = static_cast<size_t>(cursor - name);
+
+				const bool is_compiler = tag_is(name, name_length, "compiler");
+				const bool is_include = tag_is(name, name_length, "include");
+				const AssetDir asset_dir = (tag_is(name, name_length, "mesh") || tag_is(name, name_length, "skin")) ? AssetDir::Mesh
+										 : (tag_is(name, name_length, "texture") || tag_is(name, name_length, "hfield")) ? AssetDir::Texture
+																														   : AssetDir::Model;
+
+				// Attributes: key="value" or key='value' until the end of the tag.
+				while (*cursor && *cursor != '>')
+				{
+					while (*cursor == ' ' || *cursor == '\t' || *cursor == '\r' || *cursor == '\n' || *cursor == '/')
+						++cursor;
+					const char* key = cursor;
+					while (*cursor && *cursor != '=' && *cursor != '>' && *cursor != ' ')
+						++cursor;
+					if (*cursor != '=')
+						continue;
+					const size_t key_length = static_cast<size_t>(cursor - key);
+					++cursor;
+					const char quote = *cursor;
+					if (quote != '"' && quote != '\'')
+						continue;
+					const char* value = ++cursor;
+					while (*cursor && *cursor != quote)
+						++cursor;
+					if (*cursor == '\0')
+						return;
+					FixedString256 attribute_value;
+					attribute_value.assign(value, static_cast<size_t>(cursor - value));
+					++cursor;
+
+					if (is_compiler)
+					{
+						if (tag_is(key, key_length, "meshdir"))
+							context.meshdir = attribute_value.c_str();
+						else if (tag_is(key, key_length, "texturedir"))
+							context.texturedir = attribute_value.c_str();
+						else if (tag_is(key, key_length, "assetdir"))
+							context.assetdir = attribute_value.c_str();
+					}
+					else if (key_length >= 4 && ::strncmp(key, "file", 4) == 0 && !attribute_value.empty())
+					{
+						// "file" plus cube-map faces (fileright, fileup, ...).
+						if (is_include)
+						{
+							// Includes resolve relative to the main model directory.
+							FixedString512 include_path;
+							join_path(context.model_dir.c_str(), attribute_value.c_str(), include_path);
+							scan_mjcf_file(context, include_path.c_str(), depth + 1);
+						}
+						else
+						{
+							AssetReference reference;
+							reference.file = attribute_value.c_str();
+							reference.dir = asset_dir;
+							context.assets.push_back(reference);
+						}
+					}
+				}
+			}
+		}
+
+		void scan_mjcf_file(ScanContext& context, const char* path, int depth)
+		{
+			if (depth > kMaxIncludeDepth)
+			{
+				ROBOTICK_WARNING("MuJoCoModelCache - include depth exceeded at '%s'", path);
+				return;
+			}
+
+			std_approved::vector<char> text;
+			hash_string(context.hash, path);
+			if (!read_text_file(path, text))
+			{
+				hash_string(context.hash, "<missing>");
+				return;
+			}
+			hash_bytes(context.hash, text.data(), text.size());
+			scan_mjcf_text(context, text.data(), depth);
+		}
+
+		void resolve_asset_dir(const ScanContext& context, AssetDir dir, FixedString512& out)
+		{
+			const char* specific = (dir == AssetDir::Mesh) ? context.meshdir.c_str() : (dir == AssetDir::Texture) ? context.texturedir.c_str() : "";
+			const char* relative = (specific[0] != '\0') ? specific : context.assetdir.c_str();
+			if (dir == AssetDir::Model || relative[0] == '\0')
+			{
+				out = context.model_dir.c_str();
+				return;
+			}
+			join_path(context.model_dir.c_str(), relative, out);
+		}
+
+	} // namespace
+
+	uint64_t MuJoCoModelCache::compute_content_key(const char* model_path)
+	{
+		if (model_path == nullptr || model_path[0] == '\0')
+		{
+			return 0;
+		}
+
+		ScanContext context;
+		get_directory(model_path, context.model_dir);
+
+		std_approved::vector<char> text;
+		if (!read_text_file(model_path, text))
+		{
+			return 0;
+		}
+		hash_string(context.hash, model_path);
+		hash_bytes(context.hash, text.data(), text.size());
+		scan_mjcf_text(context, text.data(), 0);
+
+		// Assets are hashed after the scan so <compiler> dirs declared anywhere (including in includes) apply.
+		for (const AssetReference& reference : context.assets)
+		{
+			FixedString512 dir;
+			FixedString512 asset_path;
+			resolve_asset_dir(context, reference.dir, dir);
+			join_path(dir.c_str(), reference.file.c_str(), asset_path);
+			hash_file(context.hash, asset_path.c_str());
+		}
+
+		return (context.hash == 0) ? 1 : context.hash;
+	}
+
+	bool MuJoCoModelCache::get_cache_paths(
+		const char* model_path, const MuJoCoModelCacheOptions& options, char* mjb_path, size_t mjb_path_size, char* key_path, size_t key_path_size)
+	{
+		if (model_path == nullptr || model_path[0] == '\0')
+		{
+			return false;
+		}
+
+		int written = 0;
+		if (options.cache_dir == nullptr || options.cache_dir[0] == '\0')
+		{
+			written = ::snprintf(mjb_path, mjb_path_size, "%s.mjb", model_path);
+		}
+		else
+		{
+			// Shared cache dirs may hold several models with the same file name: disambiguate by path.
+			const char* slash = ::strrchr(model_path, '/');
+			const char* base_name = slash ? slash + 1 : model_path;
+			uint64_t path_hash = kFnvOffset;
+			hash_string(path_hash, model_path);
+			written = ::snprintf(mjb_path, mjb_path_size, "%s/%s.%08x.mjb", options.cache_dir, base_name, static_cast<unsigned>(path_hash & 0xffffffffu));
+		}
+		if (written <= 0 || static_cast<size_t>(written) >= mjb_path_size)
+		{
+			return false;
+		}
+
+		written = ::snprintf(key_path, key_path_size, "%s.key", mjb_path);
+		return written > 0 && static_cast<size_t>(written) < key_path_size;
+	}
+
+	namespace
+	{
+		bool read_key_file(const char* key_path, FixedString64& out)
+		{
+			FILE* file = ::fopen(key_path, "rb");
+			if (file == nullptr)
+			{
+				return false;
+			}
+			char buffer[64] = {0};
+			const size_t count = ::fread(buffer, 1, sizeof(buffer) - 1, file);
+			::fclose(file);
+			out.assign(buffer, count);
+			return count > 0;
+		}
+
+		bool write_file_atomically(const char* path, const char* contents)
+		{
+			FixedString512 temp_path;
+			temp_path.format("%s.tmp%d", path, static_cast<int>(::getpid()));
+			FILE* file = ::fopen(temp_path.c_str(), "wb");
+			if (file == nullptr)
+			{
+				return false;
+			}
+			const size_t length = ::strlen(contents);
+			const bool ok = ::fwrite(contents, 1, length, file) == length;
+			::fclose(file);
+			if (!ok || ::rename(temp_path.c_str(), path) != 0)
+			{
+				::remove(temp_path.c_str());
+				return false;
+			}
+			return true;
+		}
+
+		void store_in_cache(const ::mjModel* model, const char* mjb_path, const char* key_path, const char* key, const char* cache_dir)
+		{
+			if (cache_dir != nullptr && cache_dir[0] != '\0')
+			{
+				::mkdir(cache_dir, 0755); // EEXIST is fine
+			}
+
+			// Drop the key first so a reader never pairs the old key with a half-replaced model.
+			::remove(key_path);
+
+			FixedString512 temp_path;
+			temp_path.format("%s.tmp%d", mjb_path, static_cast<int>(::getpid()));
+			mj_saveModel(model, temp_path.c_str(), nullptr, 0);
+			if (::rename(temp_path.c_str(), mjb_path) != 0)
+			{
+				::remove(temp_path.c_str());
+				ROBOTICK_WARNING("MuJoCoModelCache - could not write '%s'", mjb_path);
+				return;
+			}
+
+			if (!write_file_atomically(key_path, key))
+			{
+				ROBOTICK_WARNING("MuJoCoModelCache - could not write '%s'", key_path);
+			}
+		}
+	} // namespace
+
+	::mjModel* MuJoCoModelCache::load(const char* model_path, const MuJoCoModelCacheOptions& options, char* error, int error_size, bool* out_cache_hit)
+	{
+		return load_with_key(model_path, compute_content_key(model_path), options, error, error_size, out_cache_hit);
+	}
+
+	::mjModel* MuJoCoModelCache::load_with_key(
+		const char* model_path, uint64_t content_key, const MuJoCoModelCacheOptions& options, char* error, int error_size, bool* out_cache_hit)
+	{
+		if (out_cache_hit)
+		{
+			*out_cache_hit = false;
+		}
+
+		char mjb_path[512];
+		char key_path[512];
+		const bool can_cache = content_key != 0 && get_cache_paths(model_path, options, mjb_path, sizeof(mjb_path), key_path, sizeof(key_path));
+
+		FixedString64 key;
+		if (can_cache)
+		{
+			uint64_t version_hash = kFnvOffset;
+			hash_string(version_hash, mj_versionString());
+			key.format("%016llx-%016llx", static_cast<unsigned long long>(content_key), static_cast<unsigned long long>(version_hash));
+
+			FixedString64 cached_key;
+			if (read_key_file(key_path, cached_key) && cached_key == key)
+			{
+				mjModel* model = mj_loadModel(mjb_path, nullptr);
+				if (model != nullptr)
+				{
+					if (out_cache_hit)
+					{
+						*out_cache_hit = true;
+					}
+					return model;
+				}
+				ROBOTICK_WARNING("MuJoCoModelCache - '%s' is unreadable, recompiling", mjb_path);
+			}
+		}
+
+		mjModel* model = mj_loadXML(model_path, nullptr, error, error_size);
+		if (model != nullptr && can_cache)
+		{
+			store_in_cache(model, mjb_path, key_path, key.c_str(), options.cache_dir);
+		}
+		return model;
+	}
+
+} // namespace robotick
+
+#else // #if defined(ROBOTICK_PLATFORM_DESKTOP) || defined(ROBOTICK_PLATFORM_LINUX)
+
+namespace robotick
+{
+	::mjModel* MuJoCoModelCache::load(const char*, const MuJoCoModelCacheOptions&, char*, int, bool* out_cache_hit)
+	{
+		if (out_cache_hit)
+		{
+			*out_cache_hit = false;
+		}
+		return nullptr;
+	}
+
+	::mjModel* MuJoCoModelCache::load_with_key(const char*, uint64_t, const MuJoCoModelCacheOptions&, char*, int, bool* out_cache_hit)
+	{
+		if (out_cache_hit)
+		{
+			*out_cache_hit = false;
+		}
+		return nullptr;
+	}
+
+	uint64_t MuJoCoModelCache::compute_content_key(const char*)
+	{
+		return 0;
+	}
+
+	bool MuJoCoModelCache::get_cache_paths(const char*, const MuJoCoModelCacheOptions&, char*, size_t, char*, size_t)
+	{
+		return false;
+	}
+
+} // namespace robotick
+
+#endif // #if defined(ROBOTICK_PLATFORM_DESKTOP) || defined(ROBOTICK_PLATFORM_LINUX)
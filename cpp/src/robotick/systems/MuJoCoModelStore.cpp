@@ -0,0 +1,206 @@
+// Copyright Robotick contributors
+// SPDX-License-Identifier: Apache-2.0
+
+#include "robotick/systems/MuJoCoModelStore.h"
+
+#include "robotick/api.h"
+#include "robotick/systems/MuJoCoModelCache.h"
+
+#if defined(ROBOTICK_PLATFORM_DESKTOP) || defined(ROBOTICK_PLATFORM_LINUX)
+
+#include <mujoco/mujoco.h>
+
+#include <cstdio>
+#include <cstring>
+
+namespace robotick
+{
+	MuJoCoModelStore& MuJoCoModelStore::get()
+	{
+		static MuJoCoModelStore store;
+		return store;
+	}
+
+	const mjModel* MuJoCoModelStore::acquire(const char* model_path, const MuJoCoModelCacheOptions* cache_options, char* error, int error_size)
+	{
+		if (!model_path || model_path[0] == '\0')
+			return nullptr;
+
+		// Hashed once here and handed to the cache, which would otherwise hash the same files again.
+		const uint64_t content_key = MuJoCoModelCache::compute_content_key(model_path);
+
+		ModelEntry* loading_entry = nullptr;
+		{
+			UniqueLock lock(mutex_);
+
+			ModelEntry* free_entry = nullptr;
+			for (uint32_t i = 0; i < kMaxModels; ++i)
+			{
+				ModelEntry& entry = entries_[i];
+				if (entry.ref_count == 0)
+				{
+					free_entry = free_entry ? free_entry : &entry;
+					continue;
+				}
+				// An unreadable model (content_key 0) is never shared; loading it will report the error.
+				if (content_key != 0 && entry.content_key == content_key && ::strcmp(entry.path.c_str(), model_path) == 0)
+				{
+					++entry.ref_count;
+					loaded_cv_.wait(lock,
+						[&entry]
+						{
+							return !entry.is_loading;
+						});
+					if (entry.model)
+						return entry.model;
+
+					if (error && error_size > 0)
+						::snprintf(error, static_cast<size_t>(error_size), "shared load of '%s' failed", model_path);
+					release_failed_entry(entry);
+					return nullptr;
+				}
+			}
+
+			if (free_entry == nullptr)
+			{
+				ROBOTICK_WARNING("MuJoCoModelStore capacity exceeded (%lu models)", static_cast<unsigned long>(kMaxModels));
+				return nullptr;
+			}
+
+			// Reserve the entry so later requests for this model find it and wait, then compile unlocked.
+			loading_entry = free_entry;
+			loading_entry->path = model_path;
+			loading_entry->content_key = content_key;
+			loading_entry->model = nullptr;
+			loading_entry->ref_count = 1;
+			loading_entry->is_timestep_set = false;
+			loading_entry->is_loading = true;
+		}
+
+		mjModel* model = cache_options ? MuJoCoModelCache::load_with_key(model_path, content_key, *cache_options, error, error_size)
+									   : mj_loadXML(model_path, nullptr, error, error_size);
+
+		LockGuard lock(mutex_);
+		loading_entry->model = model;
+		loading_entry->is_loading = false;
+		if (!model)
+			release_failed_entry(*loading_entry);
+		loaded_cv_.notify_all();
+		return model;
+	}
+
+	void MuJoCoModelStore::release(const mjModel* model)
+	{
+		if (!model)
+			return;
+
+		LockGuard lock(mutex_);
+		ModelEntry* entry = find_entry(model);
+		if (!entry)
+			return;
+
+		if (--entry->ref_count == 0)
+		{
+			mj_deleteModel(entry->model);
+			entry->model = nullptr;
+			entry->path.clear();
+			entry->content_key = 0;
+		}
+	}
+
+	bool MuJoCoModelStore::try_set_shared_timestep(const mjModel* model, double timestep)
+	{
+		LockGuard lock(mutex_);
+		ModelEntry* entry = find_entry(model);
+		if (!entry)
+			return false;
+
+		if (entry->is_timestep_set)
+			return entry->model->opt.timestep == timestep;
+
+		entry->model->opt.timestep = timestep;
+		entry->is_timestep_set = true;
+		return true;
+	}
+
+	uint32_t MuJoCoModelStore::get_ref_count(const mjModel* model) const
+	{
+		LockGuard lock(mutex_);
+		const ModelEntry* entry = find_entry(model);
+		return entry ? entry->ref_count : 0;
+	}
+
+	uint32_t MuJoCoModelStore::get_num_models() const
+	{
+		LockGuard lock(mutex_);
+		uint32_t count = 0;
+		for (uint32_t i = 0; i < kMaxModels; ++i)
+		{
+			if (entries_[i].ref_count > 0 && entries_[i].model != nullptr)
+				++count;
+		}
+		return count;
+	}
+
+	void MuJoCoModelStore::release_failed_entry(ModelEntry& entry)
+	{
+		// Every waiter on a failed load holds a reference; the last one out frees the slot.
+		if (--entry.ref_count == 0)
+		{
+			entry.path.clear();
+			entry.content_key = 0;
+		}
+	}
+
+	MuJoCoModelStore::ModelEntry* MuJoCoModelStore::find_entry(const mjModel* model)
+	{
+		for (uint32_t i = 0; i < kMaxModels; ++i)
+		{
+			if (entries_[i].ref_count > 0 && entries_[i].model == model)
+				return &entries_[i];
+		}
+		return nullptr;
+	}
+
+	const MuJoCoModelStore::ModelEntry* MuJoCoModelStore::find_entry(const mjModel* model) const
+	{
+		return const_cast<MuJoCoModelStore*>(this)->find_entry(model);
+	}
+} // namespace robotick
+
+#else
+
+namespace robotick
+{
+	MuJoCoModelStore& MuJoCoModelStore::get()
+	{
+		static MuJoCoModelStore store;
+		return store;
+	}
+
+	const mjModel* MuJoCoModelStore::acquire(const char*, const MuJoCoModelCacheOptions*, char*, int)
+	{
+		return nullptr;
+	}
+
+	void MuJoCoModelStore::release(const mjModel*)
+	{
+	}
+
+	bool MuJoCoModelStore::try_set_shared_timestep(const mjModel*, double)
+	{
+		return false;
+	}
+
+	uint32_t MuJoCoModelStore::get_ref_count(const mjModel*) const
+	{
+		return 0;
+	}
+
+	uint32_t MuJoCoModelStore::get_num_models() const
+	{
+		return 0;
+	}
+} // namespace robotick
+
+#endif
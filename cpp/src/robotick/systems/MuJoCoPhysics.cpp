@@ -5,6 +5,8 @@
 
 #include "robotick/api.h"
 #include "robotick/systems/MuJoCoCallbacks.h"
+#include "robotick/systems/MuJoCoModelCache.h"
+#include "robotick/systems/MuJoCoModelStore.h"
 
 #if defined(ROBOTICK_PLATFORM_DESKTOP) || defined(ROBOTICK_PLATFORM_LINUX)
 
@@ -35,20 +37,101 @@ namespace robotick
 			return false;
 		}
 
+		return adopt_model(model, false);
+	}
+
+	bool MuJoCoPhysics::load_from_xml(const char* model_path, const MuJoCoModelCacheOptions& cache_options)
+	{
+		if (!model_path || model_path[0] == '\0')
+			return false;
+
+		mujoco_callbacks::install();
+
+		unload();
+
+		char error[512] = {0};
+		bool cache_hit = false;
+		mjModel* model = MuJoCoModelCache::load(model_path, cache_options, error, sizeof(error), &cache_hit);
+		if (!model)
+		{
+			ROBOTICK_WARNING("MuJoCoPhysics::load_from_xml failed: %s", error);
+			return false;
+		}
+
+		ROBOTICK_INFO("MuJoCoPhysics - %s '%s'", cache_hit ? "loaded cached model for" : "compiled", model_path);
+		return adopt_model(model, false);
+	}
+
+	bool MuJoCoPhysics::load_shared_from_xml(const char* model_path, const MuJoCoModelCacheOptions* cache_options)
+	{
+		if (!model_path || model_path[0] == '\0')
+			return false;
+
+		mujoco_callbacks::install();
+
+		unload();
+
+		char error[512] = {0};
+		const mjModel* model = MuJoCoModelStore::get().acquire(model_path, cache_options, error, sizeof(error));
+		if (!model)
+		{
+			ROBOTICK_WARNING("MuJoCoPhysics::load_shared_from_xml failed: %s", error);
+			return false;
+		}
+
+		// The store owns the model; this instance only ever mutates it through model_mutable() / set_timestep().
+		return adopt_model(const_cast<mjModel*>(model), true);
+	}
+
+	bool MuJoCoPhysics::adopt_model(::mjModel* model, bool is_shared)
+	{
 		// Pre-allocate the primary simulation state buffer.
 		mjData* data = mj_makeData(model);
 		if (!data)
 		{
-			mj_deleteModel(model);
+			if (is_shared)
+				MuJoCoModelStore::get().release(model);
+			else
+				mj_deleteModel(model);
 			return false;
 		}
 
 		LockGuard lock(mutex_);
 		model_ = model;
 		data_ = data;
+		model_shared_ = is_shared;
+		++state_revision_;
 		return true;
 	}
 
+	mjModel* MuJoCoPhysics::model_mutable()
+	{
+		if (model_ && model_shared_)
+		{
+			// mjData only depends on the model's sizes, which a copy preserves.
+			mjModel* own_model = mj_copyModel(nullptr, model_);
+			if (!own_model)
+			{
+				ROBOTICK_FATAL_EXIT("MuJoCoPhysics::model_mutable - failed to copy shared model");
+			}
+			MuJoCoModelStore::get().release(model_);
+			model_ = own_model;
+			model_shared_ = false;
+		}
+		return model_;
+	}
+
+	void MuJoCoPhysics::set_timestep(double timestep)
+	{
+		if (!model_ || model_->opt.timestep == timestep)
+			return;
+
+		if (model_shared_ && MuJoCoModelStore::get().try_set_shared_timestep(model_, timestep))
+			return;
+
+		model_mutable()->opt.timestep = timestep;
+	}
+
 	void MuJoCoPhysics::unload()
 	{
 		LockGuard lock(mutex_);
@@ -59,8 +142,12 @@ namespace robotick
 		}
 		if (model_)
 		{
-			mj_deleteModel(model_);
+			if (model_shared_)
+				MuJoCoModelStore::get().release(model_);
+			else
+				mj_deleteModel(model_);
 			model_ = nullptr;
+			model_shared_ = false;
 		}
 	}
 
@@ -68,14 +155,20 @@ namespace robotick
 	{
 		LockGuard lock(mutex_);
 		if (model_ && data_)
+		{
 			mj_forward(model_, data_);
+			++state_revision_;
+		}
 	}
 
 	void MuJoCoPhysics::step()
 	{
 		LockGuard lock(mutex_);
 		if (model_ && data_)
+		{
 			mj_step(model_, data_);
+			++state_revision_;
+		}
 	}
 
 	bool MuJoCoPhysics::alloc_render_snapshot(::mjData*& data_out, const ::mjModel*& model_out, double& time_out) const
@@ -111,7 +204,13 @@ namespace robotick
 		destroy_snapshot(data_out);
 	}
 
-	bool MuJoCoPhysics::copy_render_snapshot(::mjData* dst, const ::mjModel*& model_out, double& time_out) const
+	uint64_t MuJoCoPhysics::state_revision() const
+	{
+		LockGuard lock(mutex_);
+		return state_revision_;
+	}
+
+	bool MuJoCoPhysics::copy_render_snapshot(::mjData* dst, const ::mjModel*& model_out, double& time_out, uint64_t* revision_out) const
 	{
 		if (!dst)
 			return false;
@@ -126,6 +225,8 @@ namespace robotick
 		mj_copyData(dst, model_, data_);
 		model_out = model_;
 		time_out = data_->time;
+		if (revision_out)
+			*revision_out = state_revision_;
 		return true;
 	}
 
@@ -151,6 +252,30 @@ namespace robotick
 		return false;
 	}
 
+	bool MuJoCoPhysics::load_from_xml(const char*, const MuJoCoModelCacheOptions&)
+	{
+		return false;
+	}
+
+	bool MuJoCoPhysics::load_shared_from_xml(const char*, const MuJoCoModelCacheOptions*)
+	{
+		return false;
+	}
+
+	bool MuJoCoPhysics::adopt_model(::mjModel*, bool)
+	{
+		return false;
+	}
+
+	::mjModel* MuJoCoPhysics::model_mutable()
+	{
+		return model_;
+	}
+
+	void MuJoCoPhysics::set_timestep(double)
+	{
+	}
+
 	void MuJoCoPhysics::unload()
 	{
 	}
@@ -172,10 +297,15 @@ namespace robotick
 	{
 	}
 
-	bool MuJoCoPhysics::copy_render_snapshot(::mjData*, const ::mjModel*&, double&) const
+	bool MuJoCoPhysics::copy_render_snapshot(::mjData*, const ::mjModel*&, double&, uint64_t*) const
 	{
 		return false;
 	}
+
+	uint64_t MuJoCoPhysics::state_revision() const
+	{
+		return 0;
+	}
 } // namespace robotick
 
 #endif
@@ -90,16 +90,6 @@ namespace robotick
 		height_ = height;
 		model_ = model;
 
-		mjModel* mutable_model = const_cast<mjModel*>(model_);
-		if (mutable_model)
-		{
-			if (mutable_model->vis.global.offwidth < width_)
-				mutable_model->vis.global.offwidth = width_;
-			if (mutable_model->vis.global.offheight < height_)
-				mutable_model->vis.global.offheight = height_;
-			mutable_model->vis.quality.offsamples = 0;
-		}
-
 		if (!init_gl_context())
 			return false;
 
@@ -114,7 +104,24 @@ namespace robotick
 		mjv_defaultOption(option_);
 		mjv_defaultCamera(camera_);
 		mjr_defaultContext(context_);
-		mjr_makeContext(model_, context_, mjFONTSCALE_100);
+
+		// The model may be shared (MuJoCoModelStore) and read by other threads, so the offscreen settings go on
+		// a private copy that only sizes the context - mjr_makeContext keeps no reference to it.
+		mjModel* context_model = mj_copyModel(nullptr, model_);
+		if (!context_model)
+		{
+			ROBOTICK_WARNING("MuJoCoRenderContext: could not copy the model to create the render context.");
+			shutdown();
+			return false;
+		}
+		if (context_model->vis.global.offwidth < width_)
+			context_model->vis.global.offwidth = width_;
+		if (context_model->vis.global.offheight < height_)
+			context_model->vis.global.offheight = height_;
+		context_model->vis.quality.offsamples = 0;
+
+		mjr_makeContext(context_model, context_, mjFONTSCALE_100);
+		mj_deleteModel(context_model);
 		mjr_resizeOffscreen(width_, height_, context_);
 
 		update_viewport(width_, height_);
@@ -171,23 +178,91 @@ namespace robotick
 		bool use_window_buffer)
 	{
 		out_size = 0;
+		if (!out_rgb || out_capacity == 0)
+		{
+			ROBOTICK_WARNING("MuJoCoRenderContext: render_to_rgb called with no output buffer.");
+			return false;
+		}
+
+		(void)use_window_buffer;
+
+		MuJoCoRenderTargets targets;
+		targets.rgb = out_rgb;
+		targets.rgb_capacity = out_capacity;
+		if (!render_frame(model, data, camera_name, targets, out_width, out_height))
+			return false;
+
+		out_size = static_cast<size_t>(out_width * out_height * 3);
+		return true;
+	}
+
+	bool MuJoCoRenderContext::render_frame(
+		const mjModel* model, const mjData* data, const char* camera_name, const MuJoCoRenderTargets& targets, int& out_width, int& out_height)
+	{
 		out_width = 0;
 		out_height = 0;
-		if (!model || !data || !out_rgb || out_capacity == 0)
+		if (!model || !data)
 		{
-			ROBOTICK_WARNING("MuJoCoRenderContext: render_to_rgb called with null model/data.");
+			ROBOTICK_WARNING("MuJoCoRenderContext: render_frame called with null model/data.");
 			return false;
 		}
 
+		if (!prepare_viewport_and_camera(model, camera_name))
+			return false;
+
+		const size_t pixel_count = static_cast<size_t>(viewport_->width * viewport_->height);
+		if (targets.rgb && targets.rgb_capacity < pixel_count * 3)
+		{
+			ROBOTICK_WARNING("MuJoCoRenderContext: output RGB buffer capacity %zu is smaller than required %zu.", targets.rgb_capacity, pixel_count * 3);
+			return false;
+		}
+		if (targets.depth && targets.depth_capacity < pixel_count)
+		{
+			ROBOTICK_WARNING("MuJoCoRenderContext: output depth buffer capacity %zu is smaller than required %zu.", targets.depth_capacity, pixel_count);
+			return false;
+		}
+		if (targets.segmentation && targets.segmentation_capacity < pixel_count)
+		{
+			ROBOTICK_WARNING("MuJoCoRenderContext: output segmentation buffer capacity %zu is smaller than required %zu.",
+				targets.segmentation_capacity,
+				pixel_count);
+			return false;
+		}
+
+		// Build the scene once; every target below is read from it.
+		mjv_updateScene(model, const_cast<mjData*>(data), option_, nullptr, camera_, mjCAT_ALL, scene_);
+		mjr_render(*viewport_, scene_, context_);
+
+		// Re-bind the buffer before readback to avoid stale state.
+		mjr_setBuffer(mjFB_OFFSCREEN, context_);
+
+		if (targets.rgb || targets.depth)
+		{
+			// One readback covers colour and depth of the same pass.
+			mjr_readPixels(targets.rgb, targets.depth, *viewport_, context_);
+			if (targets.depth)
+				linearize_depth(model, targets.depth, pixel_count);
+		}
+
+		if (targets.segmentation)
+			read_segmentation(targets.segmentation, pixel_count);
+
+		out_width = viewport_->width;
+		out_height = viewport_->height;
+		return true;
+	}
+
+	bool MuJoCoRenderContext::prepare_viewport_and_camera(const mjModel* model, const char* camera_name)
+	{
 		if (!init(model, width_ > 0 ? width_ : 640, height_ > 0 ? height_ : 480))
 		{
-			ROBOTICK_WARNING("MuJoCoRenderContext: init failed in render_to_rgb.");
+			ROBOTICK_WARNING("MuJoCoRenderContext: init failed in render_frame.");
 			return false;
 		}
 
 		if (!eglMakeCurrent(egl_display_, egl_surface_, egl_surface_, egl_context_))
 		{
-			ROBOTICK_WARNING("MuJoCoRenderContext: eglMakeCurrent failed in render_to_rgb.");
+			ROBOTICK_WARNING("MuJoCoRenderContext: eglMakeCurrent failed in render_frame.");
 			return false;
 		}
 
@@ -241,26 +316,57 @@ namespace robotick
 			mjv_defaultCamera(camera_);
 		}
 
-		mjv_updateScene(model, const_cast<mjData*>(data), option_, nullptr, camera_, mjCAT_ALL, scene_);
-		mjr_render(*viewport_, scene_, context_);
-
-		// Re-bind the buffer before readback to avoid stale state.
-		(void)use_window_buffer;
-		mjr_setBuffer(mjFB_OFFSCREEN, context_);
+		return true;
+	}
 
-		const size_t byte_count = static_cast<size_t>(viewport_->width * viewport_->height * 3);
-		if (out_capacity < byte_count)
+	void MuJoCoRenderContext::linearize_depth(const mjModel* model, float* depth, size_t pixel_count) const
+	{
+		// The GL depth buffer is non-linear in [0, 1]; invert the perspective projection MuJoCo used
+		// (clip planes are fractions of the model extent). Background pixels resolve to zfar.
+		const float extent = static_cast<float>(model->stat.extent);
+		const float znear = model->vis.map.znear * extent;
+		const float zfar = model->vis.map.zfar * extent;
+		const float near_over_far = znear / zfar;
+
+		for (size_t i = 0; i < pixel_count; ++i)
 		{
-			ROBOTICK_WARNING("MuJoCoRenderContext: output RGB buffer capacity %zu is smaller than required %zu.", out_capacity, byte_count);
-			return false;
+			depth[i] = znear / (1.0f - depth[i] * (1.0f - near_over_far));
 		}
+	}
 
-		mjr_readPixels(out_rgb, nullptr, *viewport_, context_);
-		out_width = viewport_->width;
-		out_height = viewport_->height;
-		out_size = byte_count;
+	void MuJoCoRenderContext::read_segmentation(int32_t* out_ids, size_t pixel_count)
+	{
+		const size_t byte_count = pixel_count * 3;
+		if (segment_rgb_.size() < byte_count)
+			segment_rgb_.resize(byte_count);
+
+		// Re-render the already-built scene with flat per-geom id colours (segid + 1, 0 = background).
+		const mjtByte prev_segment = scene_->flags[mjRND_SEGMENT];
+		const mjtByte prev_idcolor = scene_->flags[mjRND_IDCOLOR];
+		scene_->flags[mjRND_SEGMENT] = 1;
+		scene_->flags[mjRND_IDCOLOR] = 1;
+		mjr_render(*viewport_, scene_, context_);
+		mjr_setBuffer(mjFB_OFFSCREEN, context_);
+		mjr_readPixels(segment_rgb_.data(), nullptr, *viewport_, context_);
+		scene_->flags[mjRND_SEGMENT] = prev_segment;
+		scene_->flags[mjRND_IDCOLOR] = prev_idcolor;
 
-		return true;
+		const int32_t geom_count = static_cast<int32_t>(scene_->ngeom);
+		for (size_t i = 0; i < pixel_count; ++i)
+		{
+			const uint8_t* rgb = &segment_rgb_[i * 3];
+			const int32_t segid = static_cast<int32_t>(rgb[0]) | (static_cast<int32_t>(rgb[1]) << 8) | (static_cast<int32_t>(rgb[2]) << 16);
+
+			int32_t geom_id = -1;
+			// segid is the scene geom index + 1; only model geoms (not decor/tendons/sites) map to an id.
+			if (segid > 0 && segid <= geom_count)
+			{
+				const mjvGeom& geom = scene_->geoms[segid - 1];
+				if (geom.objtype == mjOBJ_GEOM)
+					geom_id = geom.objid;
+			}
+			out_ids[i] = geom_id;
+		}
 	}
 
 	bool MuJoCoRenderContext::debug_clear_and_read_blue(
@@ -90,7 +90,8 @@ namespace robotick
 		return entry.physics->alloc_render_snapshot(data_out, model_out, time_out);
 	}
 
-	bool MuJoCoSceneRegistry::copy_render_snapshot(uint32_t scene_id, ::mjData* dst, const ::mjModel*& model_out, double& time_out) const
+	bool MuJoCoSceneRegistry::copy_render_snapshot(
+		uint32_t scene_id, ::mjData* dst, const ::mjModel*& model_out, double& time_out, uint64_t* revision_out) const
 	{
 		uint32_t index = 0;
 		if (!decode_handle(scene_id, index))
@@ -101,7 +102,22 @@ namespace robotick
 		if (!entry.active || entry.physics == nullptr)
 			return false;
 
-		return entry.physics->copy_render_snapshot(dst, model_out, time_out);
+		return entry.physics->copy_render_snapshot(dst, model_out, time_out, revision_out);
+	}
+
+	bool MuJoCoSceneRegistry::get_state_revision(uint32_t scene_id, uint64_t& revision_out) const
+	{
+		uint32_t index = 0;
+		if (!decode_handle(scene_id, index))
+			return false;
+
+		LockGuard lock(mutex_);
+		const SceneEntry& entry = entries_[index];
+		if (!entry.active || entry.physics == nullptr)
+			return false;
+
+		revision_out = entry.physics->state_revision();
+		return true;
 	}
 
 	void MuJoCoSceneRegistry::destroy_render_snapshot(::mjData*& data_out) const
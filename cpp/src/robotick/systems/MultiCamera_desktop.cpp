@@ -0,0 +1,251 @@
+// Copyright Robotick contributors
+// SPDX-License-Identifier: Apache-2.0
+
+#include "robotick/systems/MultiCamera.h"
+
+#include "robotick/api.h"
+
+#if defined(ROBOTICK_PLATFORM_DESKTOP)
+
+#include "robotick/framework/time/Clock.h"
+
+#include <cstring>
+#include <opencv2/opencv.hpp>
+#include <vector>
+
+namespace robotick
+{
+	struct MultiCamera::Impl
+	{
+		cv::VideoCapture captures[kMaxCameras];
+		cv::Mat frames[kMaxCameras];
+		uint64_t grab_offset_ns[kMaxCameras] = {};
+		uint64_t grab_time_ns[kMaxCameras] = {};
+		decltype(Clock::now()) clock_start = Clock::now();
+		uint32_t camera_count = 0;
+		bool has_set = false;
+
+		// One encode buffer for every camera; grows to the largest frame seen, then stays.
+		// OpenCV only exposes STL vector-based encoders (no fixed buffer hook), so keep STL here and copy out afterward.
+		std_approved::vector<uchar> jpeg_scratch;
+
+		void close_all()
+		{
+			for (uint32_t i = 0; i < kMaxCameras; ++i)
+			{
+				if (captures[i].isOpened())
+					captures[i].release();
+			}
+			camera_count = 0;
+			has_set = false;
+		}
+	};
+
+	MultiCamera::MultiCamera()
+	{
+		impl = new MultiCamera::Impl();
+	}
+
+	MultiCamera::~MultiCamera()
+	{
+		impl->close_all();
+		delete impl;
+	}
+
+	bool MultiCamera::setup(const int* camera_indices, uint32_t camera_count)
+	{
+		impl->close_all();
+
+		if (camera_indices == nullptr || camera_count == 0 || camera_count > kMaxCameras)
+			return false;
+
+		for (uint32_t i = 0; i < camera_count; ++i)
+		{
+			cv::VideoCapture& capture = impl->captures[i];
+			if (camera_indices[i] < 0 || !capture.open(camera_indices[i], cv::CAP_V4L2))
+			{
+				ROBOTICK_WARNING("MultiCamera failed to open camera index %i", camera_indices[i]);
+				impl->close_all();
+				return false;
+			}
+
+			capture.set(cv::CAP_PROP_FRAME_WIDTH, 640);
+			capture.set(cv::CAP_PROP_FRAME_HEIGHT, 480);
+			capture.set(cv::CAP_PROP_FOURCC, cv::VideoWriter::fourcc('M', 'J', 'P', 'G'));
+			// Keep at most one queued frame so a grab returns the newest exposure, not a stale one.
+			capture.set(cv::CAP_PROP_BUFFERSIZE, 1);
+		}
+
+		impl->camera_count = camera_count;
+		reset_clock();
+		return true;
+	}
+
+	uint32_t MultiCamera::get_camera_count() const
+	{
+		return impl->camera_count;
+	}
+
+	bool MultiCamera::capture()
+	{
+		impl->has_set = false;
+		if (impl->camera_count == 0)
+			return false;
+
+		// Phase 1: grab only (dequeue the latest buffer on each device); nothing slow between grabs.
+		const auto start_time = Clock::now();
+		for (uint32_t i = 0; i < impl->camera_count; ++i)
+		{
+			if (!impl->captures[i].grab())
+				return false;
+			const auto grab_time = Clock::now();
+			impl->grab_offset_ns[i] = static_cast<uint64_t>(Clock::to_nanoseconds(grab_time - start_time).count());
+			impl->grab_time_ns[i] = static_cast<uint64_t>(Clock::to_nanoseconds(grab_time - impl->clock_start).count());
+		}
+
+		// Phase 2: retrieve (decode) each grabbed frame.
+		for (uint32_t i = 0; i < impl->camera_count; ++i)
+		{
+			if (!impl->captures[i].retrieve(impl->frames[i]))
+				return false;
+		}
+
+		impl->has_set = true;
+		return true;
+	}
+
+	uint64_t MultiCamera::get_grab_offset_ns(uint32_t camera) const
+	{
+		return (camera < impl->camera_count) ? impl->grab_offset_ns[camera] : 0;
+	}
+
+	uint64_t MultiCamera::get_grab_time_ns(uint32_t camera) const
+	{
+		return (camera < impl->camera_count) ? impl->grab_time_ns[camera] : 0;
+	}
+
+	void MultiCamera::reset_clock()
+	{
+		impl->clock_start = Clock::now();
+	}
+
+	uint64_t MultiCamera::get_skew_ns() const
+	{
+		if (impl->camera_count == 0)
+			return 0;
+
+		uint64_t min_ns = impl->grab_offset_ns[0];
+		uint64_t max_ns = impl->grab_offset_ns[0];
+		for (uint32_t i = 1; i < impl->camera_count; ++i)
+		{
+			min_ns = robotick::min(min_ns, impl->grab_offset_ns[i]);
+			max_ns = robotick::max(max_ns, impl->grab_offset_ns[i]);
+		}
+		return max_ns - min_ns;
+	}
+
+	bool MultiCamera::encode_jpeg(uint32_t camera, uint8_t* dst_buffer, size_t dst_capacity, size_t& out_size_used)
+	{
+		out_size_used = 0;
+		if (!impl->has_set || camera >= impl->camera_count || dst_buffer == nullptr)
+			return false;
+
+		if (!cv::imencode(".jpg", impl->frames[camera], impl->jpeg_scratch))
+			return false;
+
+		if (impl->jpeg_scratch.size() > dst_capacity)
+		{
+			ROBOTICK_WARNING("MultiCamera - camera %u JPEG (%zu bytes) exceeds buffer (%zu bytes)",
+				static_cast<unsigned>(camera),
+				impl->jpeg_scratch.size(),
+				dst_capacity);
+			return false;
+		}
+
+		::memcpy(dst_buffer, impl->jpeg_scratch.data(), impl->jpeg_scratch.size());
+		out_size_used = impl->jpeg_scratch.size();
+		return true;
+	}
+
+	void MultiCamera::print_available_cameras()
+	{
+		for (int camera_index = 0; camera_index < 10; ++camera_index)
+		{
+			cv::VideoCapture test(camera_index);
+			if (test.isOpened())
+			{
+				ROBOTICK_INFO("Camera available: id='%i'", camera_index);
+				test.release();
+			}
+		}
+		ROBOTICK_INFO("Specify camera_indices in config to select.");
+	}
+
+} // namespace robotick
+
+#else // #if defined(ROBOTICK_PLATFORM_DESKTOP)
+
+namespace robotick
+{
+	struct MultiCamera::Impl
+	{
+	};
+
+	MultiCamera::MultiCamera()
+	{
+		impl = new Impl();
+	}
+
+	MultiCamera::~MultiCamera()
+	{
+		delete impl;
+	}
+
+	bool MultiCamera::setup(const int*, uint32_t)
+	{
+		return false;
+	}
+
+	uint32_t MultiCamera::get_camera_count() const
+	{
+		return 0;
+	}
+
+	bool MultiCamera::capture()
+	{
+		return false;
+	}
+
+	uint64_t MultiCamera::get_grab_offset_ns(uint32_t) const
+	{
+		return 0;
+	}
+
+	uint64_t MultiCamera::get_grab_time_ns(uint32_t) const
+	{
+		return 0;
+	}
+
+	void MultiCamera::reset_clock()
+	{
+	}
+
+	uint64_t MultiCamera::get_skew_ns() const
+	{
+		return 0;
+	}
+
+	bool MultiCamera::encode_jpeg(uint32_t, uint8_t*, size_t, size_t& out_size_used)
+	{
+		out_size_used = 0;
+		return false;
+	}
+
+	void MultiCamera::print_available_cameras()
+	{
+		ROBOTICK_INFO("MultiCamera is only available on desktop platforms");
+	}
+
+} // namespace robotick
+
+#endif // #if defined(ROBOTICK_PLATFORM_DESKTOP)
@@ -4,18 +4,40 @@
 #if defined(ROBOTICK_PLATFORM_DESKTOP) || defined(ROBOTICK_PLATFORM_LINUX)
 
 #include "robotick/api.h"
+#include "robotick/framework/memory/StdApproved.h"
 #include "robotick/framework/system/PlatformEvents.h"
 #include "robotick/systems/Renderer.h"
 
 #include <SDL2/SDL.h>
-#include <SDL2/SDL2_gfxPrimitives.h>
 #include <SDL2/SDL_ttf.h>
 
 #include <opencv2/opencv.hpp>
-#include <vector>
+#include <cmath>
 
 namespace robotick
 {
+	namespace
+	{
+		// Pending geometry is flushed early past this many vertices, bounding the batch buffers.
+		constexpr size_t kMaxBatchVertices = 16384;
+
+		// Max distance (px) between a tessellated ellipse edge and the true curve.
+		constexpr float kEllipseTolerancePx = 0.35f;
+		constexpr int kEllipseMinSegments = 8;
+		constexpr int kEllipseMaxSegments = 256;
+
+		int get_ellipse_segment_count(const float radius_px)
+		{
+			if (radius_px <= kEllipseTolerancePx)
+				return kEllipseMinSegments;
+
+			// Chord sagitta r * (1 - cos(pi / n)) <= tolerance.
+			const float max_step = 2.0f * ::acosf(1.0f - kEllipseTolerancePx / radius_px);
+			const int segments = static_cast<int>(::ceilf(2.0f * robotick::kPi / max_step));
+			return robotick::clamp(segments, kEllipseMinSegments, kEllipseMaxSegments);
+		}
+	} // namespace
+
 	struct Renderer::RendererImpl
 	{
 		SDL_Window* window = nullptr;
@@ -23,9 +45,90 @@ namespace robotick
 		SDL_Texture* blit_texture = nullptr;
 		int blit_tex_w = 0;
 		int blit_tex_h = 0;
+
+		// Fit rectangle for image blits, recomputed only when the viewport mapping changes.
+		SDL_Rect blit_dst{0, 0, 0, 0};
+		float blit_dst_scale = 0.0f;
+		float blit_dst_logical_w = 0.0f;
+		float blit_dst_logical_h = 0.0f;
+		int blit_dst_offset_x = 0;
+		int blit_dst_offset_y = 0;
+
 		TTF_Font* font = nullptr;
 		int current_font_size = 0;
 		bool texture_only = false;
+
+		// Pixel-space scratch for batched draws; grows to the largest batch seen, then stays.
+		std_approved::vector<SDL_Point> point_scratch;
+
+		// Filled shapes accumulate here as indexed triangles and go to SDL in one SDL_RenderGeometry call
+		// when anything else needs the render target (text, images, lines, present, capture).
+		std_approved::vector<SDL_Vertex> batch_vertices;
+		std_approved::vector<int> batch_indices;
+
+		// Reserve room for vertex_count more vertices, flushing first if the batch would grow past its cap.
+		int begin_batch(const size_t vertex_count)
+		{
+			if (!batch_vertices.empty() && batch_vertices.size() + vertex_count > kMaxBatchVertices)
+				flush_batch();
+			return static_cast<int>(batch_vertices.size());
+		}
+
+		void add_vertex(const float x, const float y, const SDL_Color& color)
+		{
+			SDL_Vertex vertex;
+			vertex.position = SDL_FPoint{x, y};
+			vertex.color = color;
+			vertex.tex_coord = SDL_FPoint{0.0f, 0.0f};
+			batch_vertices.push_back(vertex);
+		}
+
+		void add_triangle(const int i0, const int i1, const int i2)
+		{
+			batch_indices.push_back(i0);
+			batch_indices.push_back(i1);
+			batch_indices.push_back(i2);
+		}
+
+		void add_rect(const float x0, const float y0, const float x1, const float y1, const SDL_Color& color)
+		{
+			const int base = begin_batch(4);
+			add_vertex(x0, y0, color);
+			add_vertex(x1, y0, color);
+			add_vertex(x1, y1, color);
+			add_vertex(x0, y1, color);
+			add_triangle(base, base + 1, base + 2);
+			add_triangle(base, base + 2, base + 3);
+		}
+
+		void flush_batch()
+		{
+			if (batch_indices.empty() || !renderer)
+			{
+				discard_batch();
+				return;
+			}
+
+			// Geometry without a texture blends with the renderer's draw blend mode; BLEND is exact for opaque colours too.
+			SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+			if (SDL_RenderGeometry(renderer,
+					nullptr,
+					batch_vertices.data(),
+					static_cast<int>(batch_vertices.size()),
+					batch_indices.data(),
+					static_cast<int>(batch_indices.size())) != 0)
+			{
+				ROBOTICK_WARNING("SDL_RenderGeometry failed: %s", SDL_GetError());
+			}
+			discard_batch();
+		}
+
+		// Keeps capacity, so steady-state frames do not reallocate.
+		void discard_batch()
+		{
+			batch_vertices.clear();
+			batch_indices.clear();
+		}
 	};
 
 	static bool sdl_video_owned = false;
@@ -134,6 +237,8 @@ namespace robotick
 	{
 		if (impl)
 		{
+			impl->discard_batch();
+
 			if (impl->font)
 			{
 				TTF_CloseFont(impl->font);
@@ -192,6 +297,8 @@ namespace robotick
 	{
 		if (!impl || !impl->renderer)
 			return;
+		// Anything still batched would be painted over anyway.
+		impl->discard_batch();
 		SDL_SetRenderDrawColor(impl->renderer, color.r, color.g, color.b, color.a);
 		SDL_RenderClear(impl->renderer);
 	}
@@ -201,6 +308,8 @@ namespace robotick
 		if (!impl || !impl->renderer)
 			return;
 
+		impl->flush_batch();
+
 		Uint32 win_id = impl->window ? SDL_GetWindowID(impl->window) : 0;
 		SDL_Window* win = win_id ? SDL_GetWindowFromID(win_id) : nullptr;
 		const Uint32 flags = win ? SDL_GetWindowFlags(win) : 0;
@@ -225,6 +334,8 @@ namespace robotick
 		if (!impl || !impl->renderer || !dst || capacity == 0)
 			return false;
 
+		impl->flush_batch();
+
 		SDL_Surface* surface = SDL_CreateRGBSurfaceWithFormat(0, physical_w, physical_h, 32, SDL_PIXELFORMAT_ABGR8888);
 		if (!surface)
 			return false;
@@ -260,14 +371,31 @@ namespace robotick
 		if (!impl || !impl->renderer)
 			return;
 
-		SDL_SetRenderDrawColor(impl->renderer, color.r, color.g, color.b, color.a);
+		const float cx_px = center.x * scale + offset_x;
+		const float cy_px = center.y * scale + offset_y;
+		const float rx_px = rx * scale;
+		const float ry_px = ry * scale;
+		if (rx_px <= 0.0f || ry_px <= 0.0f)
+			return;
 
-		const int cx_px = to_px_x(center.x);
-		const int cy_px = to_px_y(center.y);
-		const int rx_px = to_px_w(rx);
-		const int ry_px = to_px_h(ry);
+		// Triangle fan around the centre; segment count follows the larger radius so edges stay smooth at any size.
+		const int segments = get_ellipse_segment_count(rx_px > ry_px ? rx_px : ry_px);
+		const SDL_Color sdl_color = {color.r, color.g, color.b, color.a};
 
-		filledEllipseRGBA(impl->renderer, cx_px, cy_px, rx_px, ry_px, color.r, color.g, color.b, color.a);
+		const int base = impl->begin_batch(static_cast<size_t>(segments) + 1);
+		impl->add_vertex(cx_px, cy_px, sdl_color);
+
+		const float step = 2.0f * robotick::kPi / static_cast<float>(segments);
+		for (int i = 0; i < segments; ++i)
+		{
+			const float angle = step * static_cast<float>(i);
+			impl->add_vertex(cx_px + rx_px * ::cosf(angle), cy_px + ry_px * ::sinf(angle), sdl_color);
+		}
+
+		for (int i = 0; i < segments; ++i)
+		{
+			impl->add_triangle(base, base + 1 + i, base + 1 + ((i + 1) % segments));
+		}
 	}
 
 	void Renderer::draw_triangle_filled(const Vec2f& p0, const Vec2f& p1, const Vec2f& p2, const Color& color)
@@ -275,22 +403,63 @@ namespace robotick
 		if (!impl || !impl->renderer)
 			return;
 
-		const int x0 = to_px_x(p0.x);
-		const int y0 = to_px_y(p0.y);
-		const int x1 = to_px_x(p1.x);
-		const int y1 = to_px_y(p1.y);
-		const int x2 = to_px_x(p2.x);
-		const int y2 = to_px_y(p2.y);
-
-		filledTrigonRGBA(impl->renderer, x0, y0, x1, y1, x2, y2, color.r, color.g, color.b, color.a);
+		const SDL_Color sdl_color = {color.r, color.g, color.b, color.a};
+		const int base = impl->begin_batch(3);
+		impl->add_vertex(p0.x * scale + offset_x, p0.y * scale + offset_y, sdl_color);
+		impl->add_vertex(p1.x * scale + offset_x, p1.y * scale + offset_y, sdl_color);
+		impl->add_vertex(p2.x * scale + offset_x, p2.y * scale + offset_y, sdl_color);
+		impl->add_triangle(base, base + 1, base + 2);
 	}
 
 	void Renderer::draw_rect_filled(const Vec2f& p0, const Vec2f& p1, const Color& color)
 	{
-		const Vec2f top_right = {p1.x, p0.y};
-		const Vec2f bottom_left = {p0.x, p1.y};
-		draw_triangle_filled(p0, top_right, p1, color);
-		draw_triangle_filled(p0, p1, bottom_left, color);
+		if (!impl || !impl->renderer)
+			return;
+
+		const SDL_Color sdl_color = {color.r, color.g, color.b, color.a};
+		impl->add_rect(p0.x * scale + offset_x, p0.y * scale + offset_y, p1.x * scale + offset_x, p1.y * scale + offset_y, sdl_color);
+	}
+
+	void Renderer::draw_polyline(const Vec2f* points, size_t count, const Color& color)
+	{
+		if (!points || count < 2 || !impl || !impl->renderer)
+			return;
+
+		// Lines are not part of the triangle batch; draw what is queued first to keep painter's order.
+		impl->flush_batch();
+
+		if (impl->point_scratch.size() < count)
+			impl->point_scratch.resize(count);
+
+		SDL_Point* px_points = impl->point_scratch.data();
+		for (size_t i = 0; i < count; ++i)
+		{
+			px_points[i].x = to_px_x(points[i].x);
+			px_points[i].y = to_px_y(points[i].y);
+		}
+
+		SDL_SetRenderDrawBlendMode(impl->renderer, color.a < 255 ? SDL_BLENDMODE_BLEND : SDL_BLENDMODE_NONE);
+		SDL_SetRenderDrawColor(impl->renderer, color.r, color.g, color.b, color.a);
+		SDL_RenderDrawLines(impl->renderer, px_points, static_cast<int>(count));
+	}
+
+	void Renderer::draw_rects_filled(const Vec2f* rect_corners, size_t rect_count, const Color& color)
+	{
+		if (!rect_corners || rect_count == 0 || !impl || !impl->renderer)
+			return;
+
+		const SDL_Color sdl_color = {color.r, color.g, color.b, color.a};
+		for (size_t i = 0; i < rect_count; ++i)
+		{
+			const Vec2f& p0 = rect_corners[2 * i];
+			const Vec2f& p1 = rect_corners[2 * i + 1];
+			const float x0 = (p0.x < p1.x ? p0.x : p1.x) * scale + offset_x;
+			const float y0 = (p0.y < p1.y ? p0.y : p1.y) * scale + offset_y;
+			const float x1 = (p0.x < p1.x ? p1.x : p0.x) * scale + offset_x;
+			const float y1 = (p0.y < p1.y ? p1.y : p0.y) * scale + offset_y;
+			// Never let a thin column vanish: every rect covers at least one pixel.
+			impl->add_rect(x0, y0, (x1 - x0 >= 1.0f) ? x1 : x0 + 1.0f, (y1 - y0 >= 1.0f) ? y1 : y0 + 1.0f, sdl_color);
+		}
 	}
 
 	void Renderer::draw_text(const char* text, const Vec2f& pos, const float size, const TextAlign align, const Color& color)
@@ -298,6 +467,8 @@ namespace robotick
 		if (!text || !*text || !impl || !impl->renderer)
 			return;
 
+		impl->flush_batch();
+
 		const int font_size = static_cast<int>(size * scale);
 		if (!impl->font || impl->current_font_size != font_size)
 		{
@@ -370,7 +541,9 @@ namespace robotick
 		if (!pixels || w <= 0 || h <= 0 || !impl || !impl->renderer)
 			return;
 
-		// (Re)create the cached texture if size changed
+		impl->flush_batch();
+
+		// Reuse the streaming texture across calls; (re)create it only when the image size changes
 		if (!impl->blit_texture || impl->blit_tex_w != w || impl->blit_tex_h != h)
 		{
 			if (impl->blit_texture)
@@ -388,36 +561,48 @@ namespace robotick
 			impl->blit_tex_h = h;
 		}
 
-		// Upload pixels
+		// Upload pixels: incoming is tightly-packed RGBA8888, so one copy covers the image unless the texture rows are padded.
 		void* tex_pixels = nullptr;
 		int pitch = 0;
-		if (SDL_LockTexture(impl->blit_texture, nullptr, &tex_pixels, &pitch) == 0)
+		if (SDL_LockTexture(impl->blit_texture, nullptr, &tex_pixels, &pitch) != 0)
 		{
-			// incoming is tightly-packed RGBA8888
-			const uint8_t* src = pixels;
-			uint8_t* dst = static_cast<uint8_t*>(tex_pixels);
+			ROBOTICK_WARNING("draw_image_rgba8888_fit: SDL_LockTexture failed: %s", SDL_GetError());
+			return;
+		}
 
+		const size_t row_bytes = static_cast<size_t>(w) * 4;
+		uint8_t* dst_pixels = static_cast<uint8_t*>(tex_pixels);
+		if (static_cast<size_t>(pitch) == row_bytes)
+		{
+			::memcpy(dst_pixels, pixels, row_bytes * static_cast<size_t>(h));
+		}
+		else
+		{
 			for (int y = 0; y < h; ++y)
 			{
-				::memcpy(dst + y * pitch, src + y * (w * 4), static_cast<size_t>(w * 4));
+				::memcpy(dst_pixels + static_cast<size_t>(y) * static_cast<size_t>(pitch), pixels + static_cast<size_t>(y) * row_bytes, row_bytes);
 			}
-			SDL_UnlockTexture(impl->blit_texture);
 		}
-		else
+		SDL_UnlockTexture(impl->blit_texture);
+
+		// Fit to the viewport region inside the window
+		if (impl->blit_dst_scale != scale || impl->blit_dst_logical_w != logical_w || impl->blit_dst_logical_h != logical_h ||
+			impl->blit_dst_offset_x != offset_x || impl->blit_dst_offset_y != offset_y)
 		{
-			ROBOTICK_WARNING("draw_image_rgba8888_fit: SDL_LockTexture failed: %s", SDL_GetError());
-			return;
+			impl->blit_dst = SDL_Rect{
+				offset_x,
+				offset_y,
+				static_cast<int>(logical_w * scale),
+				static_cast<int>(logical_h * scale),
+			};
+			impl->blit_dst_scale = scale;
+			impl->blit_dst_logical_w = logical_w;
+			impl->blit_dst_logical_h = logical_h;
+			impl->blit_dst_offset_x = offset_x;
+			impl->blit_dst_offset_y = offset_y;
 		}
 
-		// Fit to the viewport region inside the window
-		const SDL_Rect dst{
-			offset_x,
-			offset_y,
-			static_cast<int>(logical_w * scale),
-			static_cast<int>(logical_h * scale),
-		};
-
-		SDL_RenderCopy(impl->renderer, impl->blit_texture, nullptr, &dst);
+		SDL_RenderCopy(impl->renderer, impl->blit_texture, nullptr, &impl->blit_dst);
 	}
 } // namespace robotick
 
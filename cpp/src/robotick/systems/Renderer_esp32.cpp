@@ -152,6 +152,46 @@ namespace robotick
 		impl->canvas->fillRect(x0, y0, w, h, impl->canvas->color565(color.r, color.g, color.b));
 	}
 
+	void Renderer::draw_polyline(const Vec2f* points, size_t count, const Color& color)
+	{
+		if (!points || count < 2 || !impl || !impl->canvas)
+			return;
+
+		const uint32_t c = impl->canvas->color565(color.r, color.g, color.b);
+		int prev_x = to_px_x(points[0].x);
+		int prev_y = to_px_y(points[0].y);
+		impl->canvas->startWrite();
+		for (size_t i = 1; i < count; ++i)
+		{
+			const int x = to_px_x(points[i].x);
+			const int y = to_px_y(points[i].y);
+			impl->canvas->drawLine(prev_x, prev_y, x, y, c);
+			prev_x = x;
+			prev_y = y;
+		}
+		impl->canvas->endWrite();
+	}
+
+	void Renderer::draw_rects_filled(const Vec2f* rect_corners, size_t rect_count, const Color& color)
+	{
+		if (!rect_corners || rect_count == 0 || !impl || !impl->canvas)
+			return;
+
+		const uint32_t c = impl->canvas->color565(color.r, color.g, color.b);
+		impl->canvas->startWrite();
+		for (size_t i = 0; i < rect_count; ++i)
+		{
+			const Vec2f& p0 = rect_corners[2 * i];
+			const Vec2f& p1 = rect_corners[2 * i + 1];
+			const int x0 = to_px_x(p0.x < p1.x ? p0.x : p1.x);
+			const int y0 = to_px_y(p0.y < p1.y ? p0.y : p1.y);
+			const int x1 = to_px_x(p0.x < p1.x ? p1.x : p0.x);
+			const int y1 = to_px_y(p0.y < p1.y ? p1.y : p0.y);
+			impl->canvas->fillRect(x0, y0, (x1 > x0) ? (x1 - x0) : 1, (y1 > y0) ? (y1 - y0) : 1, c);
+		}
+		impl->canvas->endWrite();
+	}
+
 	void Renderer::draw_text(const char* text, const Vec2f& pos, const float size, const TextAlign align, const Color& color)
 	{
 		if (!text || !*text || !impl || !impl->canvas)
@@ -260,6 +300,14 @@ namespace robotick
 	{
 	}
 
+	void Renderer::draw_polyline(const Vec2f*, size_t, const Color&)
+	{
+	}
+
+	void Renderer::draw_rects_filled(const Vec2f*, size_t, const Color&)
+	{
+	}
+
 	void Renderer::draw_text(const char*, const Vec2f&, const float, const TextAlign, const Color&)
 	{
 	}
@@ -0,0 +1,173 @@
+// Copyright Robotick contributors
+// SPDX-License-Identifier: Apache-2.0
+
+#if defined(ROBOTICK_PLATFORM_DESKTOP) || defined(ROBOTICK_PLATFORM_LINUX)
+
+#include "robotick/systems/SharedTelemetryWriter.h"
+
+#include "robotick/api.h"
+
+#include <cstddef>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace robotick
+{
+	namespace
+	{
+		// Padding between fields of the same struct is copied along with them, so that a whole struct is one memcpy.
+		constexpr size_t kMaxRunGapBytes = 16;
+
+		// External readers (robotick.telemetry in Python) hard-code this layout.
+		static_assert(sizeof(RobotickSharedTelemetryHeader) == 64, "shared telemetry header layout changed");
+		static_assert(sizeof(RobotickSharedTelemetryField) == 128, "shared telemetry field layout changed");
+		static_assert(offsetof(RobotickSharedTelemetryHeader, sequence) == 32, "shared telemetry header layout changed");
+		static_assert(offsetof(RobotickSharedTelemetryHeader, timestamp_ns) == 40, "shared telemetry header layout changed");
+
+		constexpr uint32_t align_up(uint32_t value, uint32_t alignment)
+		{
+			return (value + alignment - 1) & ~(alignment - 1);
+		}
+	} // namespace
+
+	SharedTelemetryWriter::~SharedTelemetryWriter()
+	{
+		close();
+	}
+
+	bool SharedTelemetryWriter::open(const char* segment_name, const SharedTelemetryField* fields, uint32_t field_count)
+	{
+		ROBOTICK_ASSERT_MSG(runs.size() == 0, "SharedTelemetryWriter::open() must only be called once");
+
+		if (segment_name == nullptr || segment_name[0] == '\0' || (field_count > 0 && fields == nullptr))
+			return false;
+
+		// POSIX shm names are "/name".
+		if (segment_name[0] == '/')
+			name = segment_name;
+		else
+			name.format("/%s", segment_name);
+
+		// Lay out the snapshot, mirroring the source spacing within each run so it can be copied as a block.
+		runs.initialize(robotick::max(field_count, 1u));
+		HeapVector<uint32_t> offsets;
+		offsets.initialize(robotick::max(field_count, 1u));
+
+		uint32_t data_size = 0;
+		for (uint32_t i = 0; i < field_count; ++i)
+		{
+			const SharedTelemetryField& field = fields[i];
+			const uint8_t* src = static_cast<const uint8_t*>(field.src);
+
+			CopyRun* run = (run_count > 0) ? &runs[run_count - 1] : nullptr;
+			const uint8_t* run_end = run ? run->src + run->size : nullptr;
+			if (run != nullptr && src >= run_end && static_cast<size_t>(src - run_end) <= kMaxRunGapBytes)
+			{
+				offsets[i] = run->dst_offset + static_cast<uint32_t>(src - run->src);
+				run->size = static_cast<uint32_t>(src + field.size - run->src);
+			}
+			else
+			{
+				run = &runs[run_count++];
+				run->src = src;
+				run->dst_offset = align_up(data_size, 8);
+				run->size = field.size;
+				offsets[i] = run->dst_offset;
+			}
+			data_size = robotick::max(data_size, run->dst_offset + run->size);
+		}
+
+		const uint32_t fields_offset = align_up(sizeof(RobotickSharedTelemetryHeader), 64);
+		const uint32_t data_offset = align_up(fields_offset + field_count * static_cast<uint32_t>(sizeof(RobotickSharedTelemetryField)), 64);
+		segment_size = data_offset + robotick::max(data_size, 1u);
+
+		// Replace rather than reuse a segment left behind by a previous run; readers of the old one see it detach.
+		::shm_unlink(name.c_str());
+		const int fd = ::shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0644);
+		if (fd < 0)
+		{
+			ROBOTICK_WARNING("SharedTelemetryWriter - shm_open('%s') failed", name.c_str());
+			return false;
+		}
+
+		void* mapped = MAP_FAILED;
+		if (::ftruncate(fd, static_cast<off_t>(segment_size)) == 0)
+			mapped = ::mmap(nullptr, segment_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+		::close(fd);
+
+		if (mapped == MAP_FAILED)
+		{
+			ROBOTICK_WARNING("SharedTelemetryWriter - failed to size or map '%s' (%zu bytes)", name.c_str(), segment_size);
+			::shm_unlink(name.c_str());
+			return false;
+		}
+
+		uint8_t* segment = static_cast<uint8_t*>(mapped);
+		RobotickSharedTelemetryField* descriptors = reinterpret_cast<RobotickSharedTelemetryField*>(segment + fields_offset);
+		for (uint32_t i = 0; i < field_count; ++i)
+		{
+			RobotickSharedTelemetryField& descriptor = descriptors[i];
+			::strncpy(descriptor.path, fields[i].path.c_str(), sizeof(descriptor.path) - 1);
+			descriptor.offset = offsets[i];
+			descriptor.size = fields[i].size;
+			descriptor.kind = static_cast<uint8_t>(fields[i].kind);
+		}
+
+		data = segment + data_offset;
+
+		// ftruncate() zero-fills, so only the non-zero header fields need setting. The magic goes last: readers
+		// ignore the segment until it is there.
+		RobotickSharedTelemetryHeader* new_header = reinterpret_cast<RobotickSharedTelemetryHeader*>(segment);
+		new_header->version = ROBOTICK_SHARED_TELEMETRY_VERSION;
+		new_header->header_size = sizeof(RobotickSharedTelemetryHeader);
+		new_header->flags = ROBOTICK_SHARED_TELEMETRY_FLAG_WRITER_ATTACHED;
+		new_header->writer_pid = static_cast<uint32_t>(::getpid());
+		new_header->field_count = field_count;
+		new_header->fields_offset = fields_offset;
+		new_header->data_offset = data_offset;
+		new_header->data_size = data_size;
+		__atomic_store_n(&new_header->magic, ROBOTICK_SHARED_TELEMETRY_MAGIC, __ATOMIC_RELEASE);
+
+		header = new_header;
+		return true;
+	}
+
+	void SharedTelemetryWriter::close()
+	{
+		if (header == nullptr)
+			return;
+
+		__atomic_fetch_and(&header->flags, ~ROBOTICK_SHARED_TELEMETRY_FLAG_WRITER_ATTACHED, __ATOMIC_RELEASE);
+		::munmap(header, segment_size);
+		::shm_unlink(name.c_str());
+
+		header = nullptr;
+		data = nullptr;
+	}
+
+	void SharedTelemetryWriter::publish(uint64_t timestamp_ns)
+	{
+		if (header == nullptr)
+			return;
+
+		// Seqlock write: odd while copying. We are the only writer, so a plain read of the current value is fine.
+		const uint32_t sequence = header->sequence;
+		__atomic_store_n(&header->sequence, sequence + 1, __ATOMIC_RELAXED);
+		__atomic_thread_fence(__ATOMIC_RELEASE);
+
+		for (uint32_t i = 0; i < run_count; ++i)
+		{
+			const CopyRun& run = runs[i];
+			::memcpy(data + run.dst_offset, run.src, run.size);
+		}
+		header->timestamp_ns = timestamp_ns;
+		header->publish_count++;
+
+		__atomic_store_n(&header->sequence, sequence + 2, __ATOMIC_RELEASE);
+	}
+
+} // namespace robotick
+
+#endif // ROBOTICK_PLATFORM_DESKTOP || ROBOTICK_PLATFORM_LINUX
@@ -0,0 +1,115 @@
+// Copyright Robotick contributors
+// SPDX-License-Identifier: Apache-2.0
+
+#include "robotick/systems/WorkloadCpuStats.h"
+
+#include <cstring>
+
+#if defined(ROBOTICK_PLATFORM_DESKTOP) || defined(ROBOTICK_PLATFORM_LINUX)
+#include <sys/resource.h>
+#include <time.h>
+#endif
+
+namespace robotick
+{
+	bool sample_thread_cpu(ThreadCpuSample& out)
+	{
+#if defined(ROBOTICK_PLATFORM_DESKTOP) || defined(ROBOTICK_PLATFORM_LINUX)
+		timespec cpu_time{};
+		if (::clock_gettime(CLOCK_THREAD_CPUTIME_ID, &cpu_time) != 0)
+			return false;
+
+		out.cpu_ns = static_cast<uint64_t>(cpu_time.tv_sec) * 1000000000ull + static_cast<uint64_t>(cpu_time.tv_nsec);
+
+#if defined(RUSAGE_THREAD)
+		rusage usage{};
+		if (::getrusage(RUSAGE_THREAD, &usage) == 0)
+		{
+			out.voluntary_switches = static_cast<uint64_t>(usage.ru_nvcsw);
+			out.involuntary_switches = static_cast<uint64_t>(usage.ru_nivcsw);
+		}
+#endif
+		return true;
+#else
+		(void)out;
+		return false;
+#endif
+	}
+
+	void WorkloadCpuStats::record_tick(uint64_t tick_wall_ns, const ThreadCpuSample& before, const ThreadCpuSample& after)
+	{
+		tick_count.fetch_add(1);
+		wall_ns.fetch_add(tick_wall_ns);
+		cpu_ns.fetch_add(after.cpu_ns - before.cpu_ns);
+		voluntary_switches.fetch_add(after.voluntary_switches - before.voluntary_switches);
+		involuntary_switches.fetch_add(after.involuntary_switches - before.involuntary_switches);
+	}
+
+	WorkloadCpuTotals WorkloadCpuStats::get_totals() const
+	{
+		WorkloadCpuTotals totals;
+		totals.tick_count = tick_count.load();
+		totals.wall_ns = wall_ns.load();
+		totals.cpu_ns = cpu_ns.load();
+		totals.voluntary_switches = voluntary_switches.load();
+		totals.involuntary_switches = involuntary_switches.load();
+		return totals;
+	}
+
+	// ======================================================
+	// === WorkloadCpuStatsRegistry =========================
+	// ======================================================
+
+	WorkloadCpuStatsRegistry& WorkloadCpuStatsRegistry::get()
+	{
+		static WorkloadCpuStatsRegistry registry;
+		return registry;
+	}
+
+	void WorkloadCpuStatsRegistry::add_reporter()
+	{
+		LockGuard lock(mutex_);
+		num_reporters_++;
+		enabled_.set(true);
+	}
+
+	void WorkloadCpuStatsRegistry::remove_reporter()
+	{
+		LockGuard lock(mutex_);
+		ROBOTICK_ASSERT(num_reporters_ > 0);
+		num_reporters_--;
+		enabled_.set(num_reporters_ > 0);
+	}
+
+	WorkloadCpuStats* WorkloadCpuStatsRegistry::find_or_add(const char* name)
+	{
+		ROBOTICK_ASSERT(name != nullptr && name[0] != '\0');
+
+		LockGuard lock(mutex_);
+
+		const uint32_t count = count_.load();
+		for (uint32_t i = 0; i < count; ++i)
+		{
+			if (::strcmp(entries_[i].name.c_str(), name) == 0)
+				return &entries_[i];
+		}
+
+		if (count >= kMaxWorkloads)
+		{
+			ROBOTICK_WARNING(
+				"WorkloadCpuStatsRegistry capacity exceeded (%lu workloads) - '%s' not tracked", static_cast<unsigned long>(kMaxWorkloads), name);
+			return nullptr;
+		}
+
+		entries_[count].name = name;
+		count_.store(count + 1);
+		return &entries_[count];
+	}
+
+	const WorkloadCpuStats& WorkloadCpuStatsRegistry::get_entry(uint32_t index) const
+	{
+		ROBOTICK_ASSERT(index < count_.load());
+		return entries_[index];
+	}
+
+} // namespace robotick
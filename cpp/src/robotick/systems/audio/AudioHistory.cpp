@@ -0,0 +1,233 @@
+// Copyright Robotick contributors
+// SPDX-License-Identifier: Apache-2.0
+
+#include "robotick/systems/audio/AudioHistory.h"
+
+#include <cstring>
+
+namespace robotick
+{
+	// ======================================================
+	// === AudioHistorySpan =================================
+	// ======================================================
+
+	void AudioHistorySpan::copy_to(float* dst) const
+	{
+		if (first_count > 0)
+			::memcpy(dst, first, first_count * sizeof(float));
+		if (second_count > 0)
+			::memcpy(dst + first_count, second, second_count * sizeof(float));
+	}
+
+	// ======================================================
+	// === AudioHistory =====================================
+	// ======================================================
+
+	void AudioHistory::initialize(size_t capacity_samples_in, uint32_t sample_rate_in)
+	{
+		ROBOTICK_ASSERT_MSG(ring.size() == 0, "AudioHistory::initialize() must only be called once");
+		ROBOTICK_ASSERT(capacity_samples_in > 0 && sample_rate_in > 0);
+
+		capacity_samples = capacity_samples_in;
+		sample_rate = sample_rate_in;
+		ring.initialize(capacity_samples + write_chunk_samples);
+		::memset(ring.data(), 0, ring.size() * sizeof(float));
+		total_written.store(0);
+	}
+
+	void AudioHistory::write(const float* samples, size_t count)
+	{
+		if (samples == nullptr || count == 0 || ring.size() == 0)
+			return;
+
+		const size_t ring_size = ring.size();
+		uint64_t total = total_written.load();
+
+		// Publish one chunk at a time so a reader never sees a slot change under a span it was given.
+		while (count > 0)
+		{
+			const size_t chunk = (count > write_chunk_samples) ? write_chunk_samples : count;
+			const size_t write_index = static_cast<size_t>(total % ring_size);
+			const size_t first_count = robotick::min(chunk, ring_size - write_index);
+
+			::memcpy(ring.data() + write_index, samples, first_count * sizeof(float));
+			if (chunk > first_count)
+				::memcpy(ring.data(), samples + first_count, (chunk - first_count) * sizeof(float));
+
+			total += chunk;
+			total_written.store(total);
+
+			samples += chunk;
+			count -= chunk;
+		}
+	}
+
+	AudioHistorySpan AudioHistory::make_span(uint64_t start_sample, size_t count) const
+	{
+		AudioHistorySpan span;
+		span.start_sample = start_sample;
+		if (count == 0)
+			return span;
+
+		const size_t ring_size = ring.size();
+		const size_t start_index = static_cast<size_t>(start_sample % ring_size);
+		span.first = ring.data() + start_index;
+		span.first_count = robotick::min(count, ring_size - start_index);
+		if (count > span.first_count)
+		{
+			span.second = ring.data();
+			span.second_count = count - span.first_count;
+		}
+		return span;
+	}
+
+	AudioHistorySpan AudioHistory::get_latest(size_t num_samples) const
+	{
+		const uint64_t total = total_written.load();
+		const uint64_t available = robotick::min(total, static_cast<uint64_t>(capacity_samples));
+		const size_t count = static_cast<size_t>(robotick::min(static_cast<uint64_t>(num_samples), available));
+		return make_span(total - count, count);
+	}
+
+	void AudioHistory::attach(AudioHistoryCursor& cursor) const
+	{
+		cursor.next_sample = total_written.load();
+		cursor.dropped_samples = 0;
+		cursor.is_attached = true;
+	}
+
+	AudioHistorySpan AudioHistory::read(AudioHistoryCursor& cursor, size_t max_samples) const
+	{
+		if (!cursor.is_attached)
+			attach(cursor);
+
+		const uint64_t total = total_written.load();
+		const uint64_t oldest = (total > capacity_samples) ? total - capacity_samples : 0;
+		if (cursor.next_sample < oldest)
+		{
+			cursor.dropped_samples += oldest - cursor.next_sample;
+			cursor.next_sample = oldest;
+		}
+
+		const size_t count = static_cast<size_t>(robotick::min(static_cast<uint64_t>(max_samples), total - cursor.next_sample));
+		const AudioHistorySpan span = make_span(cursor.next_sample, count);
+		cursor.next_sample += count;
+		return span;
+	}
+
+	bool AudioHistory::is_intact(const AudioHistorySpan& span) const
+	{
+		// Slots for samples older than (total - capacity) may be rewritten by an in-flight chunk.
+		return total_written.load() - span.start_sample <= capacity_samples;
+	}
+
+	size_t AudioHistory::seconds_to_samples(float seconds) const
+	{
+		if (seconds <= 0.0f)
+			return 0;
+		return static_cast<size_t>(seconds * static_cast<float>(sample_rate) + 0.5f);
+	}
+
+	// ======================================================
+	// === AudioHistoryRegistry =============================
+	// ======================================================
+
+	AudioHistoryRegistry& AudioHistoryRegistry::get()
+	{
+		static AudioHistoryRegistry registry;
+		return registry;
+	}
+
+	AudioHistory* AudioHistoryRegistry::acquire(const char* name, float capacity_sec, uint32_t sample_rate)
+	{
+		ROBOTICK_ASSERT(name != nullptr && name[0] != '\0');
+
+		LockGuard lock(mutex_);
+
+		HistoryEntry* free_entry = nullptr;
+		for (uint32_t i = 0; i < kMaxHistories; ++i)
+		{
+			HistoryEntry& entry = entries_[i];
+			if (entry.ref_count == 0)
+			{
+				free_entry = free_entry ? free_entry : &entry;
+				continue;
+			}
+			if (::strcmp(entry.name.c_str(), name) != 0)
+				continue;
+
+			AudioHistory& history = *entry.history;
+			if (sample_rate != 0 && sample_rate != history.get_sample_rate())
+			{
+				ROBOTICK_WARNING("AudioHistoryRegistry - '%s' is %u Hz, requested %u Hz",
+					name,
+					static_cast<unsigned>(history.get_sample_rate()),
+					static_cast<unsigned>(sample_rate));
+				return nullptr;
+			}
+			if (history.seconds_to_samples(capacity_sec) > history.get_capacity())
+			{
+				ROBOTICK_WARNING("AudioHistoryRegistry - '%s' holds %.2fs, requested %.2fs; using existing size",
+					name,
+					static_cast<double>(history.get_capacity()) / static_cast<double>(history.get_sample_rate()),
+					static_cast<double>(capacity_sec));
+			}
+			++entry.ref_count;
+			return &history;
+		}
+
+		if (free_entry == nullptr)
+		{
+			ROBOTICK_WARNING("AudioHistoryRegistry capacity exceeded (%lu histories)", static_cast<unsigned long>(kMaxHistories));
+			return nullptr;
+		}
+		if (sample_rate == 0 || capacity_sec <= 0.0f)
+		{
+			ROBOTICK_WARNING("AudioHistoryRegistry - cannot create '%s' without a sample rate and capacity", name);
+			return nullptr;
+		}
+
+		free_entry->name = name;
+		free_entry->history = std_approved::make_unique<AudioHistory>();
+		free_entry->history->initialize(static_cast<size_t>(capacity_sec * static_cast<float>(sample_rate) + 0.5f), sample_rate);
+		free_entry->ref_count = 1;
+		return free_entry->history.get();
+	}
+
+	void AudioHistoryRegistry::release(AudioHistory* history)
+	{
+		if (history == nullptr)
+			return;
+
+		LockGuard lock(mutex_);
+		for (uint32_t i = 0; i < kMaxHistories; ++i)
+		{
+			HistoryEntry& entry = entries_[i];
+			if (entry.ref_count == 0 || entry.history.get() != history)
+				continue;
+
+			if (--entry.ref_count == 0)
+			{
+				entry.history.reset();
+				entry.name = "";
+			}
+			return;
+		}
+	}
+
+	uint32_t AudioHistoryRegistry::get_ref_count(const char* name) const
+	{
+		if (name == nullptr)
+			return 0;
+
+		LockGuard lock(mutex_);
+		for (uint32_t i = 0; i < kMaxHistories; ++i)
+		{
+			const HistoryEntry& entry = entries_[i];
+			if (entry.ref_count > 0 && ::strcmp(entry.name.c_str(), name) == 0)
+				return entry.ref_count;
+		}
+		return 0;
+	}
+
+} // namespace robotick
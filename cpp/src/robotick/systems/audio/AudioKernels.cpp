@@ -0,0 +1,471 @@
+// Copyright Robotick contributors
+// SPDX-License-Identifier: Apache-2.0
+
+#include "robotick/systems/audio/AudioKernels.h"
+
+#include <cmath>
+#include <cstring>
+
+// Backend selection follows the compile-time baseline of the target (no runtime dispatch):
+// - AVX2 adds an 8-wide main loop on top of the SSE2 path for the arithmetic kernels.
+// - SSE2 is always present on x86-64 and handles the (de)interleave shuffles plus 4-wide remainders.
+// - NEON is used on AArch64 (it relies on the A64-only round-to-nearest and maxnm/minnm intrinsics).
+// Every kernel finishes with a scalar tail, which is also the full implementation elsewhere (e.g. ESP32).
+#if defined(__AVX2__)
+#define ROBOTICK_AUDIO_KERNELS_AVX2 1
+#include <immintrin.h>
+#endif
+
+#if defined(__SSE2__)
+#define ROBOTICK_AUDIO_KERNELS_SSE2 1
+#include <emmintrin.h>
+#include <xmmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#define ROBOTICK_AUDIO_KERNELS_NEON 1
+#include <arm_neon.h>
+#endif
+
+namespace robotick
+{
+	namespace
+	{
+		constexpr float kInt16ToFloat = 1.0f / 32768.0f;
+		constexpr float kFloatToInt16 = 32767.0f;
+
+		// Ordering matches SSE max/min and NEON maxnm/minnm, so NaN resolves to min_value on every path.
+		inline float clamp_sample(float value, float min_value, float max_value)
+		{
+			value = (value > min_value) ? value : min_value;
+			return (value < max_value) ? value : max_value;
+		}
+
+		inline int16_t quantize_sample(float value)
+		{
+			// lrintf rounds to nearest-even under the default rounding mode, matching cvtps/vcvtn.
+			return static_cast<int16_t>(lrintf(clamp_sample(value, -1.0f, 1.0f) * kFloatToInt16));
+		}
+	} // namespace
+
+	const char* AudioKernels::get_backend_name()
+	{
+#if defined(ROBOTICK_AUDIO_KERNELS_AVX2)
+		return "avx2";
+#elif defined(ROBOTICK_AUDIO_KERNELS_SSE2)
+		return "sse2";
+#elif defined(ROBOTICK_AUDIO_KERNELS_NEON)
+		return "neon";
+#else
+		return "scalar";
+#endif
+	}
+
+	void AudioKernels::apply_gain(float* samples, size_t count, float gain)
+	{
+		copy_with_gain(samples, samples, count, gain);
+	}
+
+	void AudioKernels::copy_with_gain(const float* src, float* dst, size_t count, float gain)
+	{
+		size_t i = 0;
+#if defined(ROBOTICK_AUDIO_KERNELS_AVX2)
+		const __m256 gain8 = _mm256_set1_ps(gain);
+		for (; i + 8 <= count; i += 8)
+		{
+			_mm256_storeu_ps(dst + i, _mm256_mul_ps(_mm256_loadu_ps(src + i), gain8));
+		}
+#endif
+#if defined(ROBOTICK_AUDIO_KERNELS_SSE2)
+		const __m128 gain4 = _mm_set1_ps(gain);
+		for (; i + 4 <= count; i += 4)
+		{
+			_mm_storeu_ps(dst + i, _mm_mul_ps(_mm_loadu_ps(src + i), gain4));
+		}
+#elif defined(ROBOTICK_AUDIO_KERNELS_NEON)
+		const float32x4_t gain4 = vdupq_n_f32(gain);
+		for (; i + 4 <= count; i += 4)
+		{
+			vst1q_f32(dst + i, vmulq_f32(vld1q_f32(src + i), gain4));
+		}
+#endif
+		for (; i < count; ++i)
+		{
+			dst[i] = src[i] * gain;
+		}
+	}
+
+	void AudioKernels::mix_into(const float* src, float* dst, size_t count, float gain)
+	{
+		size_t i = 0;
+#if defined(ROBOTICK_AUDIO_KERNELS_AVX2)
+		const __m256 gain8 = _mm256_set1_ps(gain);
+		for (; i + 8 <= count; i += 8)
+		{
+			const __m256 scaled = _mm256_mul_ps(_mm256_loadu_ps(src + i), gain8);
+			_mm256_storeu_ps(dst + i, _mm256_add_ps(_mm256_loadu_ps(dst + i), scaled));
+		}
+#endif
+#if defined(ROBOTICK_AUDIO_KERNELS_SSE2)
+		const __m128 gain4 = _mm_set1_ps(gain);
+		for (; i + 4 <= count; i += 4)
+		{
+			const __m128 scaled = _mm_mul_ps(_mm_loadu_ps(src + i), gain4);
+			_mm_storeu_ps(dst + i, _mm_add_ps(_mm_loadu_ps(dst + i), scaled));
+		}
+#elif defined(ROBOTICK_AUDIO_KERNELS_NEON)
+		const float32x4_t gain4 = vdupq_n_f32(gain);
+		for (; i + 4 <= count; i += 4)
+		{
+			vst1q_f32(dst + i, vmlaq_f32(vld1q_f32(dst + i), vld1q_f32(src + i), gain4));
+		}
+#endif
+		for (; i < count; ++i)
+		{
+			dst[i] += src[i] * gain;
+		}
+	}
+
+	void AudioKernels::average(const float* a, const float* b, float* dst, size_t count)
+	{
+		size_t i = 0;
+#if defined(ROBOTICK_AUDIO_KERNELS_AVX2)
+		const __m256 half8 = _mm256_set1_ps(0.5f);
+		for (; i + 8 <= count; i += 8)
+		{
+			_mm256_storeu_ps(dst + i, _mm256_mul_ps(half8, _mm256_add_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i))));
+		}
+#endif
+#if defined(ROBOTICK_AUDIO_KERNELS_SSE2)
+		const __m128 half4 = _mm_set1_ps(0.5f);
+		for (; i + 4 <= count; i += 4)
+		{
+			_mm_storeu_ps(dst + i, _mm_mul_ps(half4, _mm_add_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i))));
+		}
+#elif defined(ROBOTICK_AUDIO_KERNELS_NEON)
+		const float32x4_t half4 = vdupq_n_f32(0.5f);
+		for (; i + 4 <= count; i += 4)
+		{
+			vst1q_f32(dst + i, vmulq_f32(half4, vaddq_f32(vld1q_f32(a + i), vld1q_f32(b + i))));
+		}
+#endif
+		for (; i < count; ++i)
+		{
+			dst[i] = 0.5f * (a[i] + b[i]);
+		}
+	}
+
+	void AudioKernels::clip(float* samples, size_t count, float min_value, float max_value)
+	{
+		size_t i = 0;
+#if defined(ROBOTICK_AUDIO_KERNELS_AVX2)
+		const __m256 lo8 = _mm256_set1_ps(min_value);
+		const __m256 hi8 = _mm256_set1_ps(max_value);
+		for (; i + 8 <= count; i += 8)
+		{
+			_mm256_storeu_ps(samples + i, _mm256_min_ps(_mm256_max_ps(_mm256_loadu_ps(samples + i), lo8), hi8));
+		}
+#endif
+#if defined(ROBOTICK_AUDIO_KERNELS_SSE2)
+		const __m128 lo4 = _mm_set1_ps(min_value);
+		const __m128 hi4 = _mm_set1_ps(max_value);
+		for (; i + 4 <= count; i += 4)
+		{
+			_mm_storeu_ps(samples + i, _mm_min_ps(_mm_max_ps(_mm_loadu_ps(samples + i), lo4), hi4));
+		}
+#elif defined(ROBOTICK_AUDIO_KERNELS_NEON)
+		const float32x4_t lo4 = vdupq_n_f32(min_value);
+		const float32x4_t hi4 = vdupq_n_f32(max_value);
+		for (; i + 4 <= count; i += 4)
+		{
+			vst1q_f32(samples + i, vminnmq_f32(vmaxnmq_f32(vld1q_f32(samples + i), lo4), hi4));
+		}
+#endif
+		for (; i < count; ++i)
+		{
+			samples[i] = clamp_sample(samples[i], min_value, max_value);
+		}
+	}
+
+	void AudioKernels::int16_to_float(const int16_t* src, float* dst, size_t count)
+	{
+		size_t i = 0;
+#if defined(ROBOTICK_AUDIO_KERNELS_AVX2)
+		const __m256 scale8 = _mm256_set1_ps(kInt16ToFloat);
+		for (; i + 8 <= count; i += 8)
+		{
+			const __m256i widened = _mm256_cvtepi16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i)));
+			_mm256_storeu_ps(dst + i, _mm256_mul_ps(_mm256_cvtepi32_ps(widened), scale8));
+		}
+#endif
+#if defined(ROBOTICK_AUDIO_KERNELS_SSE2)
+		const __m128 scale4 = _mm_set1_ps(kInt16ToFloat);
+		for (; i + 4 <= count; i += 4)
+		{
+			const __m128i packed = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(src + i));
+			const __m128i widened = _mm_srai_epi32(_mm_unpacklo_epi16(packed, packed), 16); // sign-extend
+			_mm_storeu_ps(dst + i, _mm_mul_ps(_mm_cvtepi32_ps(widened), scale4));
+		}
+#elif defined(ROBOTICK_AUDIO_KERNELS_NEON)
+		const float32x4_t scale4 = vdupq_n_f32(kInt16ToFloat);
+		for (; i + 4 <= count; i += 4)
+		{
+			const int32x4_t widened = vmovl_s16(vld1_s16(src + i));
+			vst1q_f32(dst + i, vmulq_f32(vcvtq_f32_s32(widened), scale4));
+		}
+#endif
+		for (; i < count; ++i)
+		{
+			dst[i] = static_cast<float>(src[i]) * kInt16ToFloat;
+		}
+	}
+
+	void AudioKernels::float_to_int16(const float* src, int16_t* dst, size_t count)
+	{
+		size_t i = 0;
+#if defined(ROBOTICK_AUDIO_KERNELS_SSE2)
+		const __m128 lo4 = _mm_set1_ps(-1.0f);
+		const __m128 hi4 = _mm_set1_ps(1.0f);
+		const __m128 scale4 = _mm_set1_ps(kFloatToInt16);
+		for (; i + 8 <= count; i += 8)
+		{
+			const __m128 a = _mm_mul_ps(_mm_min_ps(_mm_max_ps(_mm_loadu_ps(src + i), lo4), hi4), scale4);
+			const __m128 b = _mm_mul_ps(_mm_min_ps(_mm_max_ps(_mm_loadu_ps(src + i + 4), lo4), hi4), scale4);
+			const __m128i packed = _mm_packs_epi32(_mm_cvtps_epi32(a), _mm_cvtps_epi32(b));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), packed);
+		}
+#elif defined(ROBOTICK_AUDIO_KERNELS_NEON)
+		const float32x4_t lo4 = vdupq_n_f32(-1.0f);
+		const float32x4_t hi4 = vdupq_n_f32(1.0f);
+		const float32x4_t scale4 = vdupq_n_f32(kFloatToInt16);
+		for (; i + 4 <= count; i += 4)
+		{
+			const float32x4_t scaled = vmulq_f32(vminnmq_f32(vmaxnmq_f32(vld1q_f32(src + i), lo4), hi4), scale4);
+			vst1_s16(dst + i, vqmovn_s32(vcvtnq_s32_f32(scaled)));
+		}
+#endif
+		for (; i < count; ++i)
+		{
+			dst[i] = quantize_sample(src[i]);
+		}
+	}
+
+	void AudioKernels::interleave_stereo(const float* left, const float* right, float* dst_lr, size_t frames)
+	{
+		size_t i = 0;
+#if defined(ROBOTICK_AUDIO_KERNELS_SSE2) || defined(ROBOTICK_AUDIO_KERNELS_NEON)
+		// A missing channel reads from a static block of silence without advancing.
+		static const float silence[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+		const size_t left_stride = left ? 4 : 0;
+		const size_t right_stride = right ? 4 : 0;
+		const float* l = left ? left : silence;
+		const float* r = right ? right : silence;
+#endif
+#if defined(ROBOTICK_AUDIO_KERNELS_SSE2)
+		for (; i + 4 <= frames; i += 4, l += left_stride, r += right_stride)
+		{
+			const __m128 l4 = _mm_loadu_ps(l);
+			const __m128 r4 = _mm_loadu_ps(r);
+			_mm_storeu_ps(dst_lr + 2 * i, _mm_unpacklo_ps(l4, r4));
+			_mm_storeu_ps(dst_lr + 2 * i + 4, _mm_unpackhi_ps(l4, r4));
+		}
+#elif defined(ROBOTICK_AUDIO_KERNELS_NEON)
+		for (; i + 4 <= frames; i += 4, l += left_stride, r += right_stride)
+		{
+			float32x4x2_t lr;
+			lr.val[0] = vld1q_f32(l);
+			lr.val[1] = vld1q_f32(r);
+			vst2q_f32(dst_lr + 2 * i, lr);
+		}
+#endif
+		for (; i < frames; ++i)
+		{
+			dst_lr[2 * i + 0] = left ? left[i] : 0.0f;
+			dst_lr[2 * i + 1] = right ? right[i] : 0.0f;
+		}
+	}
+
+	void AudioKernels::interleave(const float* const* planar, size_t num_channels, float* dst, size_t frames)
+	{
+		if (num_channels == 0 || frames == 0)
+			return;
+
+		if (num_channels == 1)
+		{
+			if (planar[0])
+				::memmove(dst, planar[0], frames * sizeof(float));
+			else
+				::memset(dst, 0, frames * sizeof(float));
+			return;
+		}
+
+		if (num_channels == 2)
+		{
+			interleave_stereo(planar[0], planar[1], dst, frames);
+			return;
+		}
+
+		size_t i = 0;
+#if defined(ROBOTICK_AUDIO_KERNELS_SSE2) || defined(ROBOTICK_AUDIO_KERNELS_NEON)
+		if (num_channels == 4)
+		{
+			static const float silence[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+			const float* c[4];
+			size_t stride[4];
+			for (size_t ch = 0; ch < 4; ++ch)
+			{
+				c[ch] = planar[ch] ? planar[ch] : silence;
+				stride[ch] = planar[ch] ? 4 : 0;
+			}
+
+			for (; i + 4 <= frames; i += 4)
+			{
+#if defined(ROBOTICK_AUDIO_KERNELS_SSE2)
+				__m128 r0 = _mm_loadu_ps(c[0]);
+				__m128 r1 = _mm_loadu_ps(c[1]);
+				__m128 r2 = _mm_loadu_ps(c[2]);
+				__m128 r3 = _mm_loadu_ps(c[3]);
+				_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+				_mm_storeu_ps(dst + 4 * i + 0, r0);
+				_mm_storeu_ps(dst + 4 * i + 4, r1);
+				_mm_storeu_ps(dst + 4 * i + 8, r2);
+				_mm_storeu_ps(dst + 4 * i + 12, r3);
+#else
+				float32x4x4_t quad;
+				quad.val[0] = vld1q_f32(c[0]);
+				quad.val[1] = vld1q_f32(c[1]);
+				quad.val[2] = vld1q_f32(c[2]);
+				quad.val[3] = vld1q_f32(c[3]);
+				vst4q_f32(dst + 4 * i, quad);
+#endif
+				for (size_t ch = 0; ch < 4; ++ch)
+					c[ch] += stride[ch];
+			}
+		}
+#endif
+		for (size_t ch = 0; ch < num_channels; ++ch)
+		{
+			const float* src = planar[ch];
+			float* out = dst + ch;
+			for (size_t frame = i; frame < frames; ++frame)
+			{
+				out[frame * num_channels] = src ? src[frame] : 0.0f;
+			}
+		}
+	}
+
+	void AudioKernels::deinterleave_stereo(const float* src_lr, float* left, float* right, size_t frames)
+	{
+		size_t i = 0;
+#if defined(ROBOTICK_AUDIO_KERNELS_SSE2)
+		if (left && right)
+		{
+			for (; i + 4 <= frames; i += 4)
+			{
+				const __m128 a = _mm_loadu_ps(src_lr + 2 * i);
+				const __m128 b = _mm_loadu_ps(src_lr + 2 * i + 4);
+				_mm_storeu_ps(left + i, _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0)));
+				_mm_storeu_ps(right + i, _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1)));
+			}
+		}
+#elif defined(ROBOTICK_AUDIO_KERNELS_NEON)
+		if (left && right)
+		{
+			for (; i + 4 <= frames; i += 4)
+			{
+				const float32x4x2_t lr = vld2q_f32(src_lr + 2 * i);
+				vst1q_f32(left + i, lr.val[0]);
+				vst1q_f32(right + i, lr.val[1]);
+			}
+		}
+#endif
+		for (; i < frames; ++i)
+		{
+			if (left)
+				left[i] = src_lr[2 * i + 0];
+			if (right)
+				right[i] = src_lr[2 * i + 1];
+		}
+	}
+
+	void AudioKernels::duplicate_mono_to_stereo(const float* mono, float* dst_lr, size_t frames)
+	{
+		size_t i = 0;
+#if defined(ROBOTICK_AUDIO_KERNELS_SSE2)
+		for (; i + 4 <= frames; i += 4)
+		{
+			const __m128 m4 = _mm_loadu_ps(mono + i);
+			_mm_storeu_ps(dst_lr + 2 * i, _mm_unpacklo_ps(m4, m4));
+			_mm_storeu_ps(dst_lr + 2 * i + 4, _mm_unpackhi_ps(m4, m4));
+		}
+#elif defined(ROBOTICK_AUDIO_KERNELS_NEON)
+		for (; i + 4 <= frames; i += 4)
+		{
+			float32x4x2_t mm;
+			mm.val[0] = vld1q_f32(mono + i);
+			mm.val[1] = mm.val[0];
+			vst2q_f32(dst_lr + 2 * i, mm);
+		}
+#endif
+		for (; i < frames; ++i)
+		{
+			dst_lr[2 * i + 0] = mono[i];
+			dst_lr[2 * i + 1] = mono[i];
+		}
+	}
+
+	void AudioKernels::mix_stereo_to_mono(const float* src_lr, float* mono, size_t frames)
+	{
+		size_t i = 0;
+#if defined(ROBOTICK_AUDIO_KERNELS_SSE2)
+		const __m128 half4 = _mm_set1_ps(0.5f);
+		for (; i + 4 <= frames; i += 4)
+		{
+			const __m128 a = _mm_loadu_ps(src_lr + 2 * i);
+			const __m128 b = _mm_loadu_ps(src_lr + 2 * i + 4);
+			const __m128 l4 = _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0));
+			const __m128 r4 = _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1));
+			_mm_storeu_ps(mono + i, _mm_mul_ps(half4, _mm_add_ps(l4, r4)));
+		}
+#elif defined(ROBOTICK_AUDIO_KERNELS_NEON)
+		const float32x4_t half4 = vdupq_n_f32(0.5f);
+		for (; i + 4 <= frames; i += 4)
+		{
+			const float32x4x2_t lr = vld2q_f32(src_lr + 2 * i);
+			vst1q_f32(mono + i, vmulq_f32(half4, vaddq_f32(lr.val[0], lr.val[1])));
+		}
+#endif
+		for (; i < frames; ++i)
+		{
+			mono[i] = 0.5f * (src_lr[2 * i + 0] + src_lr[2 * i + 1]);
+		}
+	}
+
+	void AudioKernels::mix_planar_to_mono(const float* const* planar, size_t num_channels, float* mono, size_t frames)
+	{
+		if (num_channels == 0 || frames == 0)
+			return;
+
+		if (num_channels == 2 && planar[0] && planar[1])
+		{
+			average(planar[0], planar[1], mono, frames);
+			return;
+		}
+
+		const float gain = 1.0f / static_cast<float>(num_channels);
+		bool has_source = false;
+		for (size_t ch = 0; ch < num_channels; ++ch)
+		{
+			if (!planar[ch])
+				continue;
+
+			if (has_source)
+				mix_into(planar[ch], mono, frames, gain);
+			else
+				copy_with_gain(planar[ch], mono, frames, gain);
+			has_source = true;
+		}
+
+		if (!has_source)
+			::memset(mono, 0, frames * sizeof(float));
+	}
+
+} // namespace robotick
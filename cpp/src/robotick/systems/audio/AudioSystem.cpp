@@ -17,6 +17,27 @@ namespace robotick
 	ROBOTICK_ENUM_VALUE("NoData", AudioQueueResult::NoData)
 	ROBOTICK_ENUM_VALUE("Error", AudioQueueResult::Error)
 	ROBOTICK_REGISTER_ENUM_END(AudioQueueResult)
+
+	ROBOTICK_REGISTER_ENUM_BEGIN(AudioSampleFormat)
+	ROBOTICK_ENUM_VALUE("Float32", AudioSampleFormat::Float32)
+	ROBOTICK_ENUM_VALUE("Int16", AudioSampleFormat::Int16)
+	ROBOTICK_REGISTER_ENUM_END(AudioSampleFormat)
+
+	const char* AudioSystem::describe_queue_result(AudioQueueResult result)
+	{
+		switch (result)
+		{
+		case AudioQueueResult::Success:
+			return "success";
+		case AudioQueueResult::Dropped:
+			return "dropped";
+		case AudioQueueResult::NoData:
+			return "no_data";
+		case AudioQueueResult::Error:
+		default:
+			return "error";
+		}
+	}
 } // namespace robotick
 
 #if defined(ROBOTICK_PLATFORM_DESKTOP) || defined(ROBOTICK_PLATFORM_LINUX)
@@ -24,6 +45,7 @@ namespace robotick
 #include "robotick/api.h"
 #include "robotick/framework/concurrency/Sync.h"
 #include "robotick/framework/containers/HeapVector.h"
+#include "robotick/systems/audio/AudioKernels.h"
 
 #include <SDL2/SDL.h>
 #include <cstdint>
@@ -49,12 +71,23 @@ namespace robotick
 		SDL_AudioSpec obtained_output_spec{};
 		SDL_AudioSpec obtained_input_spec{};
 
-		HeapVector<float> stereo_scratch;
-		HeapVector<float> mono_scratch;
+		AudioDeviceConfig requested_config{};
+
+		HeapVector<float> interleave_scratch;	// kScratchChunkFrames * max_output_channels
+		HeapVector<float> planar_scratch;		// kScratchChunkFrames * 2 (mono mix-down / stereo split)
+		HeapVector<int16_t> output_pcm_scratch;	// kScratchChunkFrames * max_output_channels (Int16 devices)
+		HeapVector<int16_t> input_pcm_scratch;	// kScratchChunkFrames (Int16 mic)
 		uint32_t max_queued_bytes = 0;
 		AudioBackpressureStrategy strategy = AudioBackpressureStrategy::DropNewest;
 		AudioBackpressureStats stats{};
 
+		// Test capture (set_output_capture_for_test): stands in for the output device, collecting what would be queued.
+		float* capture_buffer = nullptr;
+		size_t capture_capacity = 0;
+		size_t capture_count = 0;
+
+		bool has_output() const { return output_device != 0 || capture_buffer != nullptr; }
+
 		void cleanup()
 		{
 			if (output_device != 0)
@@ -98,48 +131,86 @@ namespace robotick
 				return false;
 			}
 
-			const size_t stereo_samples = kScratchChunkFrames * 2;
-			if (stereo_scratch.size() == 0)
-				stereo_scratch.initialize(stereo_samples);
-			if (mono_scratch.size() == 0)
-				mono_scratch.initialize(kScratchChunkFrames);
+			allocate_scratch();
 
 			initialized = true;
 			return true;
 		}
 
+		void allocate_scratch()
+		{
+			if (interleave_scratch.size() == 0)
+				interleave_scratch.initialize(kScratchChunkFrames * AudioSystem::max_output_channels);
+			if (planar_scratch.size() == 0)
+				planar_scratch.initialize(kScratchChunkFrames * 2);
+			if (output_pcm_scratch.size() == 0)
+				output_pcm_scratch.initialize(kScratchChunkFrames * AudioSystem::max_output_channels);
+			if (input_pcm_scratch.size() == 0)
+				input_pcm_scratch.initialize(kScratchChunkFrames);
+		}
+
+		static bool is_supported_format(SDL_AudioFormat format) { return format == AUDIO_F32SYS || format == AUDIO_S16SYS; }
+
+		static AudioDeviceInfo describe_spec(const SDL_AudioSpec& spec)
+		{
+			AudioDeviceInfo info;
+			info.sample_rate = static_cast<uint32_t>(spec.freq);
+			info.buffer_frames = spec.samples;
+			info.channels = spec.channels;
+			info.format = (spec.format == AUDIO_S16SYS) ? AudioSampleFormat::Int16 : AudioSampleFormat::Float32;
+			return info;
+		}
+
+		// Open one device from requested_config, letting the driver change only what the config allows.
+		SDL_AudioDeviceID open_device(bool is_capture, uint8_t channels, SDL_AudioSpec& obtained_spec)
+		{
+			SDL_AudioSpec desired{};
+			desired.freq = static_cast<int>(requested_config.sample_rate);
+			desired.format = (requested_config.format == AudioSampleFormat::Int16) ? AUDIO_S16SYS : AUDIO_F32SYS;
+			desired.channels = channels;
+			desired.samples = requested_config.buffer_frames;
+			desired.callback = nullptr; // queue mode
+
+			int allowed_changes = 0;
+			if (requested_config.allow_rate_change)
+				allowed_changes |= SDL_AUDIO_ALLOW_FREQUENCY_CHANGE;
+			if (requested_config.allow_buffer_change)
+				allowed_changes |= SDL_AUDIO_ALLOW_SAMPLES_CHANGE;
+			if (requested_config.allow_channel_change && !is_capture) // mic stays mono; SDL down-mixes
+				allowed_changes |= SDL_AUDIO_ALLOW_CHANNELS_CHANGE;
+			if (requested_config.allow_format_change)
+				allowed_changes |= SDL_AUDIO_ALLOW_FORMAT_CHANGE;
+
+			const int iscapture = is_capture ? 1 : 0;
+			SDL_AudioDeviceID device = SDL_OpenAudioDevice(nullptr, iscapture, &desired, &obtained_spec, allowed_changes);
+			if (device != 0 && !is_supported_format(obtained_spec.format))
+			{
+				// Driver picked a format we don't convert ourselves - reopen and let SDL convert instead.
+				SDL_CloseAudioDevice(device);
+				device = SDL_OpenAudioDevice(nullptr, iscapture, &desired, &obtained_spec, allowed_changes & ~SDL_AUDIO_ALLOW_FORMAT_CHANGE);
+			}
+			return device;
+		}
+
 		bool open_devices()
 		{
 			// --- Output device (speaker) ---
-			SDL_AudioSpec desired_output{};
-			desired_output.freq = 44100;
-			desired_output.format = AUDIO_F32SYS;
-			desired_output.channels = 2; // stereo output
-			desired_output.samples = 256;
-			desired_output.callback = nullptr; // queue mode
-
-			output_device = SDL_OpenAudioDevice(nullptr, 0, &desired_output, &obtained_output_spec, SDL_AUDIO_ALLOW_ANY_CHANGE);
+			output_device = open_device(false, requested_config.output_channels, obtained_output_spec);
 			if (output_device == 0)
 				return false;
 
-			if (obtained_output_spec.channels != 1 && obtained_output_spec.channels != 2)
+			if (obtained_output_spec.channels == 0 || obtained_output_spec.channels > AudioSystem::max_output_channels)
 			{
-				ROBOTICK_WARNING("AudioSystem::open_devices - unsupported output channel count (%u); only mono/stereo supported",
-					static_cast<unsigned int>(obtained_output_spec.channels));
+				ROBOTICK_WARNING("AudioSystem::open_devices - unsupported output channel count (%u); at most %u supported",
+					static_cast<unsigned int>(obtained_output_spec.channels),
+					static_cast<unsigned int>(AudioSystem::max_output_channels));
 				return false;
 			}
 
 			SDL_PauseAudioDevice(output_device, 0);
 
 			// --- Input device (microphone) ---
-			SDL_AudioSpec desired_input{};
-			desired_input.freq = 44100;
-			desired_input.format = AUDIO_F32SYS;
-			desired_input.channels = 1; // keep mic simple/mono for now
-			desired_input.samples = 256;
-			desired_input.callback = nullptr;
-
-			input_device = SDL_OpenAudioDevice(nullptr, 1, &desired_input, &obtained_input_spec, SDL_AUDIO_ALLOW_ANY_CHANGE);
+			input_device = open_device(true, 1, obtained_input_spec); // keep mic simple/mono for now
 			if (input_device == 0)
 				return false;
 
@@ -153,7 +224,8 @@ namespace robotick
 			SDL_PauseAudioDevice(input_device, 0);
 
 			const double queue_seconds = (obtained_output_spec.freq > 0) ? 1.5 : 0.0;
-			const double bytes_per_second = static_cast<double>(obtained_output_spec.freq * obtained_output_spec.channels * sizeof(float));
+			const double bytes_per_second =
+				static_cast<double>(obtained_output_spec.freq * obtained_output_spec.channels * output_bytes_per_sample());
 			const double max_bytes = queue_seconds * bytes_per_second;
 			if (max_bytes > 0.0 && max_bytes < static_cast<double>(UINT32_MAX))
 			{
@@ -164,20 +236,66 @@ namespace robotick
 				max_queued_bytes = 0;
 			}
 
+			if (obtained_output_spec.freq != static_cast<int>(requested_config.sample_rate) ||
+				obtained_output_spec.samples != requested_config.buffer_frames ||
+				obtained_input_spec.freq != obtained_output_spec.freq)
+			{
+				ROBOTICK_INFO("AudioSystem - requested %u Hz / %u frames; output opened at %u Hz / %u frames, mic at %u Hz",
+					static_cast<unsigned int>(requested_config.sample_rate),
+					static_cast<unsigned int>(requested_config.buffer_frames),
+					static_cast<unsigned int>(obtained_output_spec.freq),
+					static_cast<unsigned int>(obtained_output_spec.samples),
+					static_cast<unsigned int>(obtained_input_spec.freq));
+			}
+
 			return true;
 		}
 
+		size_t output_bytes_per_sample() const { return (obtained_output_spec.format == AUDIO_S16SYS) ? sizeof(int16_t) : sizeof(float); }
+		size_t input_bytes_per_sample() const { return (obtained_input_spec.format == AUDIO_S16SYS) ? sizeof(int16_t) : sizeof(float); }
+
 		uint32_t sample_rate() const { return obtained_output_spec.freq; }
 		uint8_t output_channels() const { return obtained_output_spec.channels; }
 		uint32_t input_sample_rate() const { return obtained_input_spec.freq != 0 ? obtained_input_spec.freq : obtained_output_spec.freq; }
 		uint8_t input_channels() const { return obtained_input_spec.channels != 0 ? obtained_input_spec.channels : 1; }
 
-		// Queue already-interleaved stereo frames (frames == number of LR pairs)
-		AudioQueueResult queue_audio_data(const void* data, uint32_t bytes)
+		// Queue already-interleaved float samples (in the device's channel layout), converting for Int16 devices.
+		AudioQueueResult queue_audio_data(const float* samples, size_t sample_count)
 		{
-			if (output_device == 0 || data == nullptr || bytes == 0)
+			if (!has_output() || samples == nullptr || sample_count == 0)
 				return AudioQueueResult::Error;
 
+			if (capture_buffer != nullptr)
+			{
+				const size_t count = robotick::min(sample_count, capture_capacity - capture_count);
+				::memcpy(capture_buffer + capture_count, samples, count * sizeof(float));
+				capture_count += count;
+				return (count == sample_count) ? AudioQueueResult::Success : AudioQueueResult::Dropped;
+			}
+
+			if (output_bytes_per_sample() == sizeof(float))
+				return queue_device_bytes(samples, static_cast<uint32_t>(sample_count * sizeof(float)));
+
+			int16_t* pcm = output_pcm_scratch.data();
+			const size_t pcm_capacity = output_pcm_scratch.size();
+			size_t offset = 0;
+			while (offset < sample_count)
+			{
+				const size_t remaining = sample_count - offset;
+				const size_t chunk = (remaining > pcm_capacity) ? pcm_capacity : remaining;
+				AudioKernels::float_to_int16(samples + offset, pcm, chunk);
+				const auto result = queue_device_bytes(pcm, static_cast<uint32_t>(chunk * sizeof(int16_t)));
+				if (result != AudioQueueResult::Success)
+					return result;
+				offset += chunk;
+			}
+			return AudioQueueResult::Success;
+		}
+
+		// Queue raw bytes in the device format, applying the back-pressure strategy.
+		AudioQueueResult queue_device_bytes(const void* data, uint32_t bytes)
+		{
+
 			const uint32_t queued_bytes = SDL_GetQueuedAudioSize(output_device);
 			if (max_queued_bytes != 0 && queued_bytes + bytes > max_queued_bytes)
 			{
@@ -218,7 +336,7 @@ namespace robotick
 			if (obtained_output_spec.freq == 0 || obtained_output_spec.channels == 0)
 				return 0.0f;
 
-			const float frame_bytes = static_cast<float>(obtained_output_spec.channels * sizeof(float));
+			const float frame_bytes = static_cast<float>(obtained_output_spec.channels * output_bytes_per_sample());
 			return (bytes / frame_bytes) / static_cast<float>(obtained_output_spec.freq) * 1000.0f;
 		}
 
@@ -231,152 +349,153 @@ namespace robotick
 
 		AudioQueueResult write_interleaved_stereo(const float* interleaved_lr, size_t frames)
 		{
-			if (output_device == 0 || interleaved_lr == nullptr || frames == 0)
+			if (!has_output() || interleaved_lr == nullptr || frames == 0)
 				return AudioQueueResult::Error;
 
-			if (obtained_output_spec.channels == 1)
+			const uint8_t out_channels = obtained_output_spec.channels;
+			if (out_channels == 2)
 			{
-				float* mixed = mono_scratch.data();
-				size_t remaining = frames;
-				const size_t chunk_limit = kScratchChunkFrames;
-				const float* src = interleaved_lr;
-				while (remaining > 0)
-				{
-					const size_t chunk = (remaining > chunk_limit) ? chunk_limit : remaining;
-					for (size_t i = 0; i < chunk; ++i)
-					{
-						const float l = src[2 * i + 0];
-						const float r = src[2 * i + 1];
-						mixed[i] = 0.5f * (l + r);
-					}
-					const auto result = queue_audio_data(mixed, static_cast<uint32_t>(chunk * sizeof(float)));
-					if (result != AudioQueueResult::Success)
-						return result;
-					src += chunk * 2;
-					remaining -= chunk;
-				}
-				return AudioQueueResult::Success;
+				return queue_audio_data(interleaved_lr, frames * 2);
 			}
 
-			const uint32_t bytes = static_cast<uint32_t>(frames * obtained_output_spec.channels * sizeof(float));
-			return queue_audio_data(interleaved_lr, bytes);
-		}
-
-		// Queue mono to both channels (duplicates to L+R if output is stereo)
-		AudioQueueResult write_mono(const float* mono, size_t frames)
-		{
-			if (output_device == 0 || mono == nullptr || frames == 0)
-				return AudioQueueResult::Error;
-
-			if (obtained_output_spec.channels == 1)
-				return queue_audio_data(mono, static_cast<uint32_t>(frames * sizeof(float)));
-
+			// Mono or multi-channel device: mix down (or split and re-route) a chunk at a time.
+			float* left = planar_scratch.data();
+			float* right = left + kScratchChunkFrames;
 			size_t remaining = frames;
-			const size_t chunk_limit = kScratchChunkFrames;
-			float* scratch = stereo_scratch.data();
+			const float* src = interleaved_lr;
 			while (remaining > 0)
 			{
-				const size_t chunk = (remaining > chunk_limit) ? chunk_limit : remaining;
-				for (size_t i = 0; i < chunk; ++i)
+				const size_t chunk = (remaining > kScratchChunkFrames) ? kScratchChunkFrames : remaining;
+				AudioQueueResult result = AudioQueueResult::Error;
+				if (out_channels == 1)
 				{
-					const float v = mono[i];
-					scratch[2 * i + 0] = v;
-					scratch[2 * i + 1] = v;
+					AudioKernels::mix_stereo_to_mono(src, left, chunk);
+					result = queue_audio_data(left, chunk);
+				}
+				else
+				{
+					AudioKernels::deinterleave_stereo(src, left, right, chunk);
+					const float* channels[2] = {left, right};
+					result = write_planar(channels, 2, chunk);
 				}
-				const auto result = queue_audio_data(scratch, static_cast<uint32_t>(chunk * 2 * sizeof(float)));
 				if (result != AudioQueueResult::Success)
 					return result;
-				mono += chunk;
+				src += chunk * 2;
 				remaining -= chunk;
 			}
 			return AudioQueueResult::Success;
 		}
 
-		// Queue mono into a specific channel (0=left, 1=right). Other channel is zero.
-		AudioQueueResult write_mono_to_channel(int channel, const float* mono, size_t frames)
+		// Queue mono to every channel (duplicates to L+R if output is stereo)
+		AudioQueueResult write_mono(const float* mono, size_t frames)
 		{
-			if (output_device == 0 || mono == nullptr || frames == 0)
+			if (!has_output() || mono == nullptr || frames == 0)
 				return AudioQueueResult::Error;
 
 			if (obtained_output_spec.channels == 1)
-				return queue_audio_data(mono, static_cast<uint32_t>(frames * sizeof(float)));
+				return queue_audio_data(mono, frames);
 
-			const int ch = (channel <= 0) ? 0 : 1; // clamp to 0/1
-			float* scratch = stereo_scratch.data();
-			size_t remaining = frames;
-			const size_t chunk_limit = kScratchChunkFrames;
+			const float* channels[AudioSystem::max_output_channels];
+			for (size_t ch = 0; ch < AudioSystem::max_output_channels; ++ch)
+				channels[ch] = mono;
+			return write_planar(channels, obtained_output_spec.channels, frames);
+		}
 
-			while (remaining > 0)
+		// Queue mono into a specific channel (0=left, 1=right, ...). Other channels are zero.
+		AudioQueueResult write_mono_to_channel(int channel, const float* mono, size_t frames)
+		{
+			if (!has_output() || mono == nullptr || frames == 0)
+				return AudioQueueResult::Error;
+
+			const int out_channels = obtained_output_spec.channels;
+			if (out_channels == 1)
+				return queue_audio_data(mono, frames);
+
+			const int target = (channel <= 0) ? 0 : ((channel >= out_channels) ? out_channels - 1 : channel);
+			const float* channels[AudioSystem::max_output_channels] = {};
+			channels[target] = mono;
+			return write_planar(channels, static_cast<size_t>(out_channels), frames);
+		}
+
+		// Queue separate left/right mono buffers
+		AudioQueueResult write_stereo(const float* left, const float* right, size_t frames)
+		{
+			const float* channels[2] = {left, right};
+			return write_planar(channels, 2, frames);
+		}
+
+		// Queue planar buffers: interleave straight into the scratch chunk and queue it, so any
+		// AudioFrame-sized block costs one interleave pass and one queue call.
+		AudioQueueResult write_planar(const float* const* channels, size_t num_channels, size_t frames)
+		{
+			if (!has_output() || channels == nullptr || num_channels == 0 || frames == 0)
+				return AudioQueueResult::Error;
+
+			const size_t out_channels = obtained_output_spec.channels;
+			if (out_channels == 1)
+				return write_planar_mixdown(channels, num_channels, frames);
+
+			const float* routed[AudioSystem::max_output_channels] = {};
+			bool has_source = false;
+			for (size_t ch = 0; ch < out_channels && ch < num_channels; ++ch)
 			{
-				const size_t chunk = (remaining > chunk_limit) ? chunk_limit : remaining;
-				for (size_t i = 0; i < chunk; ++i)
-				{
-					scratch[2 * i + 0] = (ch == 0) ? mono[i] : 0.0f;
-					scratch[2 * i + 1] = (ch == 1) ? mono[i] : 0.0f;
-				}
-				const auto result = queue_audio_data(scratch, static_cast<uint32_t>(chunk * 2 * sizeof(float)));
+				routed[ch] = channels[ch];
+				has_source = has_source || (channels[ch] != nullptr);
+			}
+			if (!has_source)
+				return AudioQueueResult::Error;
+
+			float* scratch = interleave_scratch.data();
+			size_t offset = 0;
+			while (offset < frames)
+			{
+				const size_t remaining = frames - offset;
+				const size_t chunk = (remaining > kScratchChunkFrames) ? kScratchChunkFrames : remaining;
+
+				const float* chunk_channels[AudioSystem::max_output_channels];
+				for (size_t ch = 0; ch < out_channels; ++ch)
+					chunk_channels[ch] = routed[ch] ? routed[ch] + offset : nullptr;
+
+				AudioKernels::interleave(chunk_channels, out_channels, scratch, chunk);
+				const auto result = queue_audio_data(scratch, chunk * out_channels);
 				if (result != AudioQueueResult::Success)
 					return result;
-				mono += chunk;
-				remaining -= chunk;
+				offset += chunk;
 			}
 			return AudioQueueResult::Success;
 		}
 
-		// Queue separate left/right mono buffers
-		AudioQueueResult write_stereo(const float* left, const float* right, size_t frames)
+		// Mono device: fold all num_channels inputs with equal weight, null ones counting as silence (a lone
+		// mono input is queued without copying).
+		AudioQueueResult write_planar_mixdown(const float* const* channels, size_t num_channels, size_t frames)
 		{
-			if (output_device == 0 || frames == 0 || (!left && !right))
+			num_channels = robotick::min<size_t>(num_channels, AudioSystem::max_output_channels);
+
+			bool has_source = false;
+			for (size_t ch = 0; ch < num_channels; ++ch)
+				has_source = has_source || (channels[ch] != nullptr);
+
+			if (!has_source)
 				return AudioQueueResult::Error;
+			if (num_channels == 1)
+				return queue_audio_data(channels[0], frames);
 
-			if (obtained_output_spec.channels == 1)
+			float* mixed = planar_scratch.data();
+			size_t offset = 0;
+			while (offset < frames)
 			{
-				// Mix down to mono (simple average)
-				float* mixed = mono_scratch.data();
-				size_t remaining = frames;
-				const size_t chunk_limit = kScratchChunkFrames;
-				while (remaining > 0)
-				{
-					const size_t chunk = (remaining > chunk_limit) ? chunk_limit : remaining;
-					for (size_t i = 0; i < chunk; ++i)
-					{
-						const float l = left ? left[i] : 0.0f;
-						const float r = right ? right[i] : 0.0f;
-						mixed[i] = 0.5f * (l + r);
-					}
-					const auto result = queue_audio_data(mixed, static_cast<uint32_t>(chunk * sizeof(float)));
-					if (result != AudioQueueResult::Success)
-						return result;
-					if (left)
-						left += chunk;
-					if (right)
-						right += chunk;
-					remaining -= chunk;
-				}
-				return AudioQueueResult::Success;
-			}
+				const size_t remaining = frames - offset;
+				const size_t chunk = (remaining > kScratchChunkFrames) ? kScratchChunkFrames : remaining;
 
-			float* scratch = stereo_scratch.data();
-			size_t remaining = frames;
-			const size_t chunk_limit = kScratchChunkFrames;
-			while (remaining > 0)
-			{
-				const size_t chunk = (remaining > chunk_limit) ? chunk_limit : remaining;
-				for (size_t i = 0; i < chunk; ++i)
-				{
-					const float l = left ? left[i] : 0.0f;
-					const float r = right ? right[i] : 0.0f;
-					scratch[2 * i + 0] = l;
-					scratch[2 * i + 1] = r;
-				}
-				const auto result = queue_audio_data(scratch, static_cast<uint32_t>(chunk * 2 * sizeof(float)));
+				const float* chunk_channels[AudioSystem::max_output_channels];
+				for (size_t ch = 0; ch < num_channels; ++ch)
+					chunk_channels[ch] = channels[ch] ? channels[ch] + offset : nullptr;
+				AudioKernels::mix_planar_to_mono(chunk_channels, num_channels, mixed, chunk);
+
+				const auto result = queue_audio_data(mixed, chunk);
 				if (result != AudioQueueResult::Success)
 					return result;
-				if (left)
-					left += chunk;
-				if (right)
-					right += chunk;
-				remaining -= chunk;
+				offset += chunk;
 			}
 			return AudioQueueResult::Success;
 		}
@@ -387,8 +506,30 @@ namespace robotick
 			if (input_device == 0 || buffer == nullptr || max_count == 0)
 				return result;
 
-			const uint32_t requested_bytes = static_cast<uint32_t>(max_count * sizeof(float));
-			const uint32_t dequeued_bytes = SDL_DequeueAudio(input_device, buffer, requested_bytes);
+			const size_t bytes_per_sample = input_bytes_per_sample();
+			uint32_t dequeued_bytes = 0;
+			if (bytes_per_sample == sizeof(float))
+			{
+				dequeued_bytes = SDL_DequeueAudio(input_device, buffer, static_cast<uint32_t>(max_count * sizeof(float)));
+			}
+			else
+			{
+				// Int16 mic: dequeue a chunk at a time and widen into the caller's float buffer.
+				size_t samples_done = 0;
+				while (samples_done < max_count)
+				{
+					const size_t remaining = max_count - samples_done;
+					const size_t chunk = (remaining > input_pcm_scratch.size()) ? input_pcm_scratch.size() : remaining;
+					const uint32_t chunk_bytes =
+						SDL_DequeueAudio(input_device, input_pcm_scratch.data(), static_cast<uint32_t>(chunk * sizeof(int16_t)));
+					const size_t chunk_samples = chunk_bytes / sizeof(int16_t);
+					AudioKernels::int16_to_float(input_pcm_scratch.data(), buffer + samples_done, chunk_samples);
+					samples_done += chunk_samples;
+					dequeued_bytes += chunk_bytes;
+					if (chunk_samples < chunk)
+						break;
+				}
+			}
 
 			if (dequeued_bytes == 0)
 			{
@@ -406,13 +547,13 @@ namespace robotick
 				return result;
 			}
 
-			if ((dequeued_bytes % sizeof(float)) != 0)
+			if ((dequeued_bytes % bytes_per_sample) != 0)
 			{
 				ROBOTICK_WARNING("AudioSystem::read received a partial sample block (%u bytes)", dequeued_bytes);
 			}
 
 			result.status = AudioQueueResult::Success;
-			result.samples_read = dequeued_bytes / sizeof(float);
+			result.samples_read = dequeued_bytes / bytes_per_sample;
 			return result;
 		}
 	};
@@ -427,6 +568,49 @@ namespace robotick
 		return g_audio_impl.initialized;
 	}
 
+	void AudioSystem::set_requested_config(const AudioDeviceConfig& config)
+	{
+		LockGuard lock(g_audio_mutex);
+
+		AudioDeviceConfig sanitized = config;
+		sanitized.sample_rate = robotick::clamp<uint32_t>(sanitized.sample_rate, 8000, 192000);
+		sanitized.buffer_frames = robotick::clamp<uint16_t>(sanitized.buffer_frames, 16, 8192);
+		sanitized.output_channels = robotick::clamp<uint8_t>(sanitized.output_channels, 1, AudioSystem::max_output_channels);
+
+		if (g_audio_impl.initialized)
+		{
+			const AudioDeviceConfig& current = g_audio_impl.requested_config;
+			if (sanitized.sample_rate != current.sample_rate || sanitized.buffer_frames != current.buffer_frames ||
+				sanitized.output_channels != current.output_channels || sanitized.format != current.format)
+			{
+				ROBOTICK_WARNING("AudioSystem::set_requested_config(%u Hz, %u frames, %u channels) ignored - devices are already open at "
+								 "%u Hz, %u frames, %u channels",
+					static_cast<unsigned int>(sanitized.sample_rate),
+					static_cast<unsigned int>(sanitized.buffer_frames),
+					static_cast<unsigned int>(sanitized.output_channels),
+					static_cast<unsigned int>(g_audio_impl.sample_rate()),
+					static_cast<unsigned int>(g_audio_impl.obtained_output_spec.samples),
+					static_cast<unsigned int>(g_audio_impl.output_channels()));
+			}
+			return;
+		}
+
+		g_audio_impl.requested_config = sanitized;
+	}
+
+	AudioDeviceConfig AudioSystem::get_requested_config()
+	{
+		LockGuard lock(g_audio_mutex);
+		return g_audio_impl.requested_config;
+	}
+
+	void AudioSystem::set_requested_output_channels(uint8_t channels)
+	{
+		AudioDeviceConfig config = get_requested_config();
+		config.output_channels = channels;
+		set_requested_config(config);
+	}
+
 	uint32_t AudioSystem::get_sample_rate()
 	{
 		return g_audio_impl.sample_rate();
@@ -437,11 +621,21 @@ namespace robotick
 		return g_audio_impl.output_channels();
 	}
 
+	AudioDeviceInfo AudioSystem::get_output_info()
+	{
+		return AudioSystemImpl::describe_spec(g_audio_impl.obtained_output_spec);
+	}
+
 	uint32_t AudioSystem::get_input_sample_rate()
 	{
 		return g_audio_impl.input_sample_rate();
 	}
 
+	AudioDeviceInfo AudioSystem::get_input_info()
+	{
+		return AudioSystemImpl::describe_spec(g_audio_impl.obtained_input_spec);
+	}
+
 	uint8_t AudioSystem::get_input_channels()
 	{
 		return g_audio_impl.input_channels();
@@ -467,6 +661,11 @@ namespace robotick
 		return g_audio_impl.write_mono_to_channel(channel, mono, frames);
 	}
 
+	AudioQueueResult AudioSystem::write_planar(const float* const* channels, uint8_t num_channels, size_t frames)
+	{
+		return g_audio_impl.write_planar(channels, num_channels, frames);
+	}
+
 	AudioReadResult AudioSystem::read(float* buffer, size_t max_count)
 	{
 		return g_audio_impl.read(buffer, max_count);
@@ -514,6 +713,21 @@ namespace robotick
 		g_audio_impl.obtained_output_spec.channels = static_cast<Uint8>(channels);
 	}
 
+	void AudioSystem::set_output_capture_for_test(float* buffer, size_t capacity_samples)
+	{
+		LockGuard lock(g_audio_mutex);
+		g_audio_impl.capture_buffer = buffer;
+		g_audio_impl.capture_capacity = (buffer != nullptr) ? capacity_samples : 0;
+		g_audio_impl.capture_count = 0;
+		g_audio_impl.allocate_scratch();
+	}
+
+	size_t AudioSystem::get_captured_samples_for_test()
+	{
+		LockGuard lock(g_audio_mutex);
+		return g_audio_impl.capture_count;
+	}
+
 } // namespace robotick
 
 #else
@@ -559,6 +773,28 @@ namespace robotick
 	{
 		return AudioQueueResult::Error;
 	}
+	AudioQueueResult AudioSystem::write_planar(const float* const*, uint8_t, size_t)
+	{
+		return AudioQueueResult::Error;
+	}
+	void AudioSystem::set_requested_config(const AudioDeviceConfig&)
+	{
+	}
+	AudioDeviceConfig AudioSystem::get_requested_config()
+	{
+		return {};
+	}
+	void AudioSystem::set_requested_output_channels(uint8_t)
+	{
+	}
+	AudioDeviceInfo AudioSystem::get_output_info()
+	{
+		return {};
+	}
+	AudioDeviceInfo AudioSystem::get_input_info()
+	{
+		return {};
+	}
 	AudioReadResult AudioSystem::read(float*, size_t)
 	{
 		return {};
@@ -583,6 +819,13 @@ namespace robotick
 	void AudioSystem::set_output_spec_for_test(uint32_t, uint8_t)
 	{
 	}
+	void AudioSystem::set_output_capture_for_test(float*, size_t)
+	{
+	}
+	size_t AudioSystem::get_captured_samples_for_test()
+	{
+		return 0;
+	}
 } // namespace robotick
 
 #endif
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "robotick/systems/audio/NoiseSuppressor.h"
+#include "robotick/systems/audio/AudioKernels.h"
 
 #include "robotick/framework/math/Clamp.h"
 #include "robotick/framework/math/MathUtils.h"
@@ -180,10 +181,7 @@ namespace robotick
 
 		const float normalizer = 1.0f / (static_cast<float>(NoiseSuppressorState::fft_size) * state.window_rms);
 		output.samples.set_size(input_samples);
-		for (size_t i = 0; i < input_samples; ++i)
-		{
-			output.samples[i] = state.ifft_time_domain[i] * normalizer;
-		}
+		AudioKernels::copy_with_gain(state.ifft_time_domain.data(), output.samples.data(), input_samples, normalizer);
 	}
 #else
 	void NoiseSuppressor::plan_fft(NoiseSuppressorState&)
@@ -3,7 +3,7 @@
 
 #include "robotick/systems/audio/WavFile.h"
 #include "robotick/api.h"
-#include "robotick/framework/math/MathUtils.h"
+#include "robotick/systems/audio/AudioKernels.h"
 
 #include <cstring>
 
@@ -11,6 +11,9 @@ namespace robotick
 {
 	namespace
 	{
+		// PCM is converted in small stack-resident blocks (kept modest for MCU task stacks).
+		static constexpr size_t kPcmChunkFrames = 128;
+
 		bool read_u32le(FILE* f, uint32_t& out)
 		{
 			unsigned char b[4];
@@ -156,33 +159,34 @@ namespace robotick
 		left_samples.initialize(frame_count);
 		right_samples.initialize(frame_count);
 
-		for (size_t i = 0; i < frame_count; ++i)
+		int16_t pcm_chunk[kPcmChunkFrames * 2];
+		float interleaved_chunk[kPcmChunkFrames * 2];
+
+		for (size_t frame_index = 0; frame_index < frame_count; frame_index += kPcmChunkFrames)
 		{
-			int16_t l = 0;
-			int16_t r = 0;
-			if (::fread(&l, sizeof(int16_t), 1, f) != 1)
+			const size_t remaining_frames = frame_count - frame_index;
+			const size_t chunk_frames = (remaining_frames > kPcmChunkFrames) ? kPcmChunkFrames : remaining_frames;
+			const size_t chunk_samples = chunk_frames * num_channels;
+
+			if (::fread(pcm_chunk, sizeof(int16_t), chunk_samples, f) != chunk_samples)
 			{
 				ROBOTICK_WARNING("Unexpected EOF while reading samples in %s", path);
 				::fclose(f);
 				return false;
 			}
 
+			float* left_out = &left_samples[frame_index];
+			float* right_out = &right_samples[frame_index];
 			if (num_channels == 2)
 			{
-				if (::fread(&r, sizeof(int16_t), 1, f) != 1)
-				{
-					ROBOTICK_WARNING("Unexpected EOF while reading samples in %s", path);
-					::fclose(f);
-					return false;
-				}
+				AudioKernels::int16_to_float(pcm_chunk, interleaved_chunk, chunk_samples);
+				AudioKernels::deinterleave_stereo(interleaved_chunk, left_out, right_out, chunk_frames);
 			}
 			else
 			{
-				r = l;
+				AudioKernels::int16_to_float(pcm_chunk, left_out, chunk_frames);
+				::memcpy(right_out, left_out, chunk_frames * sizeof(float));
 			}
-
-			left_samples[i] = static_cast<float>(l) / 32768.0f;
-			right_samples[i] = static_cast<float>(r) / 32768.0f;
 		}
 
 		::fclose(f);
@@ -244,12 +248,13 @@ namespace robotick
 		if (!fp || write_channels == 0 || !samples)
 			return;
 
-		for (size_t i = 0; i < count; ++i)
+		int16_t pcm_chunk[kPcmChunkFrames];
+		for (size_t offset = 0; offset < count; offset += kPcmChunkFrames)
 		{
-			float v = samples[i];
-			v = robotick::clamp(v, -1.0f, 1.0f);
-			int16_t s16 = static_cast<int16_t>(::roundf(v * 32767.0f));
-			::fwrite(&s16, sizeof(int16_t), 1, fp);
+			const size_t remaining = count - offset;
+			const size_t chunk = (remaining > kPcmChunkFrames) ? kPcmChunkFrames : remaining;
+			AudioKernels::float_to_int16(samples + offset, pcm_chunk, chunk);
+			::fwrite(pcm_chunk, sizeof(int16_t), chunk, fp);
 		}
 		data_bytes_written += static_cast<uint32_t>(count * sizeof(int16_t));
 	}
@@ -262,16 +267,15 @@ namespace robotick
 			return;
 		}
 
-		for (size_t i = 0; i < count; ++i)
+		float interleaved_chunk[kPcmChunkFrames * 2];
+		int16_t pcm_chunk[kPcmChunkFrames * 2];
+		for (size_t offset = 0; offset < count; offset += kPcmChunkFrames)
 		{
-			float l = left ? left[i] : 0.0f;
-			float r = right ? right[i] : 0.0f;
-			l = robotick::clamp(l, -1.0f, 1.0f);
-			r = robotick::clamp(r, -1.0f, 1.0f);
-			int16_t sL = static_cast<int16_t>(::roundf(l * 32767.0f));
-			int16_t sR = static_cast<int16_t>(::roundf(r * 32767.0f));
-			::fwrite(&sL, sizeof(int16_t), 1, fp);
-			::fwrite(&sR, sizeof(int16_t), 1, fp);
+			const size_t remaining = count - offset;
+			const size_t chunk = (remaining > kPcmChunkFrames) ? kPcmChunkFrames : remaining;
+			AudioKernels::interleave_stereo(left ? left + offset : nullptr, right ? right + offset : nullptr, interleaved_chunk, chunk);
+			AudioKernels::float_to_int16(interleaved_chunk, pcm_chunk, chunk * 2);
+			::fwrite(pcm_chunk, sizeof(int16_t), chunk * 2, fp);
 		}
 		data_bytes_written += static_cast<uint32_t>(count * sizeof(int16_t) * 2);
 	}
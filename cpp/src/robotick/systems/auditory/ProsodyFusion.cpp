@@ -23,6 +23,8 @@ namespace robotick
 	ROBOTICK_REGISTER_ENUM_END(ProsodicSegmentState)
 
 	ROBOTICK_REGISTER_STRUCT_BEGIN(ProsodicSegment)
+	ROBOTICK_STRUCT_FIELD(ProsodicSegment, uint32_t, segment_id)
+	ROBOTICK_STRUCT_FIELD(ProsodicSegment, uint32_t, revision)
 	ROBOTICK_STRUCT_FIELD(ProsodicSegment, float, start_time_sec)
 	ROBOTICK_STRUCT_FIELD(ProsodicSegment, float, end_time_sec)
 	ROBOTICK_STRUCT_FIELD(ProsodicSegment, ProsodyPitchCurve, pitch_hz)
@@ -36,6 +38,7 @@ namespace robotick
 
 	ROBOTICK_REGISTER_FIXED_VECTOR(ProsodyHistoryBuffer, ProsodyHistorySample);
 	ROBOTICK_REGISTER_FIXED_VECTOR(ProsodicSegmentBuffer, ProsodicSegment);
+	ROBOTICK_REGISTER_FIXED_VECTOR(ProsodicSegmentDelta, ProsodicSegment);
 
 	// Sliding-window helper shared by the workload: keeps the newest samples
 	// while avoiding reallocations on every tick.
@@ -84,4 +87,240 @@ namespace robotick
 		buffer.add(segment);
 	}
 
+	bool collect_segments_changed_since(const ProsodicSegmentBuffer& segments, uint32_t since_revision, ProsodicSegmentDelta& out)
+	{
+		out.clear();
+
+		FixedVector<uint32_t, ProsodicSegmentBuffer::capacity()> changed_revisions;
+		for (const ProsodicSegment& segment : segments)
+		{
+			if (segment.revision > since_revision)
+			{
+				changed_revisions.add(segment.revision);
+			}
+		}
+
+		// If more changed than fit, keep the most recent changes (revisions are unique per segment).
+		uint32_t min_revision = since_revision + 1;
+		const bool is_complete = changed_revisions.size() <= out.capacity();
+		if (!is_complete)
+		{
+			for (size_t a = 1; a < changed_revisions.size(); ++a)
+			{
+				const uint32_t revision = changed_revisions[a];
+				size_t b = a;
+				for (; b > 0 && changed_revisions[b - 1] > revision; --b)
+				{
+					changed_revisions[b] = changed_revisions[b - 1];
+				}
+				changed_revisions[b] = revision;
+			}
+			min_revision = changed_revisions[changed_revisions.size() - out.capacity()];
+		}
+
+		// Emit in buffer (creation) order so mirrors keep the producer's ordering.
+		for (const ProsodicSegment& segment : segments)
+		{
+			if (segment.revision >= min_revision)
+			{
+				out.add(segment);
+			}
+		}
+		return is_complete;
+	}
+
+	void apply_segment_delta(ProsodicSegmentBuffer& mirror, const ProsodicSegmentDelta& delta)
+	{
+		for (const ProsodicSegment& segment : delta)
+		{
+			if (segment.segment_id == 0)
+			{
+				continue;
+			}
+
+			ProsodicSegment* existing = nullptr;
+			for (ProsodicSegment& candidate : mirror)
+			{
+				if (candidate.segment_id == segment.segment_id)
+				{
+					existing = &candidate;
+					break;
+				}
+			}
+
+			if (existing == nullptr)
+			{
+				// Ids are issued in creation order: insert in place so the mirror keeps the producer's ordering.
+				append_segment_with_capacity(mirror, segment);
+				for (size_t i = mirror.size() - 1; i > 0 && mirror[i - 1].segment_id > segment.segment_id; --i)
+				{
+					const ProsodicSegment later = mirror[i - 1];
+					mirror[i - 1] = mirror[i];
+					mirror[i] = later;
+				}
+			}
+			else if (segment.revision > existing->revision)
+			{
+				*existing = segment;
+			}
+		}
+	}
+
+	bool ProsodicSegmentMirror::sync(const ProsodicSegmentDelta& delta,
+		bool delta_complete,
+		uint32_t delta_base_revision,
+		uint32_t producer_revision,
+		uint32_t producer_segments_handle)
+	{
+		if (producer_segments_handle != segments_handle)
+		{
+			// A different producer (or a restarted one): its revisions mean nothing against ours.
+			clear();
+			segments_handle = producer_segments_handle;
+		}
+
+		if (producer_revision <= revision)
+		{
+			return false;
+		}
+
+		if (delta_complete && revision >= delta_base_revision)
+		{
+			apply_segment_delta(segments, delta);
+			revision = producer_revision;
+			return false;
+		}
+
+		// The store may already be ahead of the outputs we were given; later deltas re-apply harmlessly.
+		if (!ProsodicSegmentStore::get().copy_set(segments_handle, segments, revision))
+		{
+			segments.clear();
+			revision = producer_revision;
+		}
+		return true;
+	}
+
+	bool ProsodicSegmentMirror::sync(const ProsodicSegmentDelta& delta,
+		bool delta_complete,
+		uint32_t delta_base_revision,
+		uint32_t producer_revision,
+		const ProsodicSegmentBuffer& full_segments)
+	{
+		if (producer_revision == revision)
+		{
+			return false;
+		}
+
+		if (delta_complete && revision >= delta_base_revision && revision < producer_revision)
+		{
+			apply_segment_delta(segments, delta);
+			revision = producer_revision;
+			return false;
+		}
+
+		segments = full_segments;
+		revision = producer_revision;
+		return true;
+	}
+
+	void ProsodicSegmentMirror::clear()
+	{
+		segments.clear();
+		revision = 0;
+		segments_handle = 0;
+	}
+
+	// ======================================================
+	// === ProsodicSegmentStore =============================
+	// ======================================================
+
+	ProsodicSegmentStore& ProsodicSegmentStore::get()
+	{
+		static ProsodicSegmentStore store;
+		return store;
+	}
+
+	ProsodicSegmentStore::SetEntry* ProsodicSegmentStore::find_entry(uint32_t handle)
+	{
+		for (SetEntry& entry : entries_)
+		{
+			if (handle != 0 && entry.handle == handle)
+			{
+				return &entry;
+			}
+		}
+		return nullptr;
+	}
+
+	const ProsodicSegmentStore::SetEntry* ProsodicSegmentStore::find_entry(uint32_t handle) const
+	{
+		return const_cast<ProsodicSegmentStore*>(this)->find_entry(handle);
+	}
+
+	uint32_t ProsodicSegmentStore::acquire_set()
+	{
+		LockGuard lock(mutex_);
+		SetEntry* free_entry = nullptr;
+		for (SetEntry& entry : entries_)
+		{
+			if (entry.handle == 0)
+			{
+				free_entry = &entry;
+				break;
+			}
+		}
+
+		if (free_entry == nullptr)
+		{
+			ROBOTICK_WARNING("ProsodicSegmentStore capacity exceeded (%lu sets)", static_cast<unsigned long>(kMaxSets));
+			return 0;
+		}
+
+		if (!free_entry->mirror)
+		{
+			free_entry->mirror = std_approved::make_unique<ProsodicSegmentMirror>();
+		}
+		free_entry->mirror->clear();
+		free_entry->handle = ++last_handle_;
+		return free_entry->handle;
+	}
+
+	void ProsodicSegmentStore::release_set(uint32_t handle)
+	{
+		LockGuard lock(mutex_);
+		if (SetEntry* entry = find_entry(handle))
+		{
+			entry->handle = 0;
+			entry->mirror->clear();
+		}
+	}
+
+	void ProsodicSegmentStore::publish(uint32_t handle,
+		const ProsodicSegmentDelta& delta,
+		bool delta_complete,
+		uint32_t delta_base_revision,
+		uint32_t producer_revision,
+		const ProsodicSegmentBuffer& full_segments)
+	{
+		LockGuard lock(mutex_);
+		if (SetEntry* entry = find_entry(handle))
+		{
+			entry->mirror->sync(delta, delta_complete, delta_base_revision, producer_revision, full_segments);
+		}
+	}
+
+	bool ProsodicSegmentStore::copy_set(uint32_t handle, ProsodicSegmentBuffer& out_segments, uint32_t& out_revision) const
+	{
+		LockGuard lock(mutex_);
+		const SetEntry* entry = find_entry(handle);
+		if (entry == nullptr)
+		{
+			return false;
+		}
+
+		out_segments = entry->mirror->segments;
+		out_revision = entry->mirror->revision;
+		return true;
+	}
+
 } // namespace robotick
@@ -3,6 +3,8 @@
 
 #include "robotick/api.h"
 #include "robotick/systems/audio/AudioFrame.h"
+#include "robotick/systems/audio/AudioHistory.h"
+#include "robotick/systems/audio/AudioKernels.h"
 #include "robotick/systems/audio/AudioSystem.h"
 
 #include <cstddef>
@@ -16,6 +18,15 @@ namespace robotick
 
 	struct MicConfig
 	{
+		// Device request (0 = AudioSystem default of 44.1 kHz / 256 frames), applied only if this workload
+		// is the first to open audio. e.g. 16000 for speech-only robots; outputs carry the obtained rate.
+		uint32_t device_sample_rate = 0;
+		uint16_t device_buffer_frames = 0;
+
+		// Optional shared history (see AudioHistoryRegistry): consumers attach by name and read
+		// recent audio as zero-copy spans instead of keeping their own copies. Empty = disabled.
+		FixedString32 history_name;
+		float history_seconds = 10.0f;
 	};
 
 	struct MicInputs
@@ -37,12 +48,29 @@ namespace robotick
 		MicInputs inputs;
 		MicOutputs outputs;
 
+		AudioHistory* history = nullptr;
+
+		~MicWorkload() { AudioHistoryRegistry::get().release(history); }
+
 		// One-time bring-up. Safe to call multiple times if the engine does.
 		void load()
 		{
+			if (config.device_sample_rate != 0 || config.device_buffer_frames != 0)
+			{
+				AudioDeviceConfig device = AudioSystem::get_requested_config();
+				device.sample_rate = (config.device_sample_rate != 0) ? config.device_sample_rate : device.sample_rate;
+				device.buffer_frames = (config.device_buffer_frames != 0) ? config.device_buffer_frames : device.buffer_frames;
+				AudioSystem::set_requested_config(device);
+			}
+
 			AudioSystem::init();
 			const uint32_t input_rate = AudioSystem::get_input_sample_rate();
 			outputs.mono.sample_rate = (input_rate != 0) ? input_rate : AudioSystem::get_sample_rate();
+
+			if (!config.history_name.empty() && history == nullptr)
+			{
+				history = AudioHistoryRegistry::get().acquire(config.history_name.c_str(), config.history_seconds, outputs.mono.sample_rate);
+			}
 		}
 
 		// Pull a chunk from the mic and publish to outputs.
@@ -83,10 +111,12 @@ namespace robotick
 			if (fabsf(gain_db) > 1e-6f)
 			{
 				const float gain = powf(10.0f, gain_db / 20.0f);
-				for (size_t i = 0; i < num_samples_read; ++i)
-				{
-					outputs.mono.samples[i] *= gain;
-				}
+				AudioKernels::apply_gain(outputs.mono.samples.data(), num_samples_read, gain);
+			}
+
+			if (history != nullptr)
+			{
+				history->write(outputs.mono);
 			}
 		}
 	};
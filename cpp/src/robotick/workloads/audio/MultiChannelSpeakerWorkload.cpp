@@ -0,0 +1,114 @@
+// Copyright Robotick contributors
+// SPDX-License-Identifier: Apache-2.0
+
+#if defined(ROBOTICK_PLATFORM_DESKTOP) || defined(ROBOTICK_PLATFORM_LINUX)
+
+#include "robotick/api.h"
+
+#include "robotick/systems/audio/AudioFrame.h"
+#include "robotick/systems/audio/AudioSystem.h"
+
+namespace robotick
+{
+	// ======================================================
+	// === MultiChannelSpeakerWorkload ======================
+	// ======================================================
+
+	struct MultiChannelSpeakerConfig
+	{
+		uint8_t num_channels = 4; // output channels requested from the device (1..8)
+	};
+
+	struct MultiChannelSpeakerInputs
+	{
+		// channelN feeds device output channel N-1; empty frames are silent. On a mono device all num_channels
+		// are folded with equal weight, so a single active channel of two plays at half level.
+		AudioFrame channel1;
+		AudioFrame channel2;
+		AudioFrame channel3;
+		AudioFrame channel4;
+		AudioFrame channel5;
+		AudioFrame channel6;
+		AudioFrame channel7;
+		AudioFrame channel8;
+	};
+
+	struct MultiChannelSpeakerOutputs
+	{
+		AudioBackpressureStats queue_stats{};
+		FixedString32 last_queue_status;
+		uint8_t device_channels = 0;
+		uint32_t frame_count = 0; // frames queued last tick: the shortest non-empty channel
+	};
+
+	struct MultiChannelSpeakerWorkload
+	{
+		MultiChannelSpeakerConfig config;
+		MultiChannelSpeakerInputs inputs;
+		MultiChannelSpeakerOutputs outputs;
+
+		void load()
+		{
+			AudioSystem::set_requested_output_channels(config.num_channels);
+			AudioSystem::init();
+			outputs.device_channels = AudioSystem::get_output_channels();
+
+			if (outputs.device_channels != config.num_channels)
+			{
+				ROBOTICK_WARNING("MultiChannelSpeakerWorkload - requested %u output channels, device provides %u",
+					static_cast<unsigned>(config.num_channels),
+					static_cast<unsigned>(outputs.device_channels));
+			}
+		}
+
+		void tick(const TickInfo&)
+		{
+			const AudioFrame* frames[AudioSystem::max_output_channels] = {
+				&inputs.channel1,
+				&inputs.channel2,
+				&inputs.channel3,
+				&inputs.channel4,
+				&inputs.channel5,
+				&inputs.channel6,
+				&inputs.channel7,
+				&inputs.channel8,
+			};
+
+			const size_t num_channels = robotick::min<size_t>(config.num_channels, AudioSystem::max_output_channels);
+			const float* channels[AudioSystem::max_output_channels] = {};
+			size_t frame_count = 0;
+			bool sizes_differ = false;
+
+			for (size_t ch = 0; ch < num_channels; ++ch)
+			{
+				const AudioFrame& frame = *frames[ch];
+				if (frame.samples.empty())
+					continue;
+
+				ROBOTICK_ASSERT(frame.sample_rate == AudioSystem::get_sample_rate());
+
+				// Channels are read in lockstep, so never read past the shortest one.
+				sizes_differ = sizes_differ || (frame_count != 0 && frame.samples.size() != frame_count);
+				frame_count = (frame_count == 0) ? frame.samples.size() : robotick::min(frame_count, frame.samples.size());
+				channels[ch] = frame.samples.data();
+			}
+
+			if (sizes_differ)
+			{
+				ROBOTICK_WARNING_ONCE("MultiChannelSpeakerWorkload - channel frames differ in size; queuing the shortest (%zu frames)", frame_count);
+			}
+
+			outputs.frame_count = static_cast<uint32_t>(frame_count);
+			if (frame_count == 0)
+				return;
+
+			const AudioQueueResult queue_result = AudioSystem::write_planar(channels, static_cast<uint8_t>(num_channels), frame_count);
+
+			outputs.queue_stats = AudioSystem::get_backpressure_stats();
+			outputs.last_queue_status = AudioSystem::describe_queue_result(queue_result);
+		}
+	};
+
+} // namespace robotick
+
+#endif // ROBOTICK_PLATFORM_DESKTOP || ROBOTICK_PLATFORM_LINUX
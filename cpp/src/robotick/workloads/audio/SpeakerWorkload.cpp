@@ -14,6 +14,14 @@
 
 namespace robotick
 {
+	struct SpeakerConfig
+	{
+		// Device request (0 = AudioSystem default of 44.1 kHz / 256 frames), applied only if this workload
+		// is the first to open audio; inputs must match the obtained rate.
+		uint32_t device_sample_rate = 0;
+		uint16_t device_buffer_frames = 0;
+	};
+
 	struct SpeakerInputs
 	{
 		AudioFrame left;
@@ -28,58 +36,54 @@ namespace robotick
 
 	struct SpeakerWorkload
 	{
+		SpeakerConfig config;
 		SpeakerInputs inputs;
 		SpeakerOutputs outputs;
 
-		void load() { AudioSystem::init(); }
+		void load()
+		{
+			if (config.device_sample_rate != 0 || config.device_buffer_frames != 0)
+			{
+				AudioDeviceConfig device = AudioSystem::get_requested_config();
+				device.sample_rate = (config.device_sample_rate != 0) ? config.device_sample_rate : device.sample_rate;
+				device.buffer_frames = (config.device_buffer_frames != 0) ? config.device_buffer_frames : device.buffer_frames;
+				AudioSystem::set_requested_config(device);
+			}
+
+			AudioSystem::init();
+		}
 
 		void tick(const TickInfo&)
 		{
 			const bool hasL = inputs.left.samples.size() > 0;
 			const bool hasR = inputs.right.samples.size() > 0;
-			AudioQueueResult queue_result = AudioQueueResult::Success;
-			bool issued_audio = false;
+			if (!hasL && !hasR)
+				return;
 
 			if (hasL && hasR)
 			{
 				ROBOTICK_ASSERT(inputs.left.samples.size() == inputs.right.samples.size());
-
 				ROBOTICK_ASSERT(inputs.left.sample_rate == inputs.right.sample_rate);
-				ROBOTICK_ASSERT(inputs.left.sample_rate == AudioSystem::get_sample_rate());
-
-				queue_result = AudioSystem::write_stereo(inputs.left.samples.data(), inputs.right.samples.data(), inputs.left.samples.size());
-				issued_audio = true;
 			}
-			else if (hasL)
+
+			const AudioFrame& reference = hasL ? inputs.left : inputs.right;
+			ROBOTICK_ASSERT(reference.sample_rate == AudioSystem::get_sample_rate());
+
+			// Both sides: one planar write interleaves and queues them together. A lone side goes to its own
+			// channel, so a mono device plays it at full level rather than folding in a silent partner.
+			AudioQueueResult queue_result = AudioQueueResult::Error;
+			if (hasL && hasR)
 			{
-				ROBOTICK_ASSERT(inputs.left.sample_rate == AudioSystem::get_sample_rate());
-				queue_result = AudioSystem::write_mono_to_channel(0, inputs.left.samples.data(), inputs.left.samples.size());
-				issued_audio = true;
+				const float* channels[2] = {inputs.left.samples.data(), inputs.right.samples.data()};
+				queue_result = AudioSystem::write_planar(channels, 2, reference.samples.size());
 			}
-			else if (hasR)
+			else
 			{
-				ROBOTICK_ASSERT(inputs.right.sample_rate == AudioSystem::get_sample_rate());
-				queue_result = AudioSystem::write_mono_to_channel(1, inputs.right.samples.data(), inputs.right.samples.size());
-				issued_audio = true;
+				queue_result = AudioSystem::write_mono_to_channel(hasL ? 0 : 1, reference.samples.data(), reference.samples.size());
 			}
 
-			if (issued_audio)
-			{
-				outputs.queue_stats = AudioSystem::get_backpressure_stats();
-				switch (queue_result)
-				{
-				case AudioQueueResult::Success:
-					outputs.last_queue_status = "success";
-					break;
-				case AudioQueueResult::Dropped:
-					outputs.last_queue_status = "dropped";
-					break;
-				case AudioQueueResult::Error:
-				default:
-					outputs.last_queue_status = "error";
-					break;
-				}
-			}
+			outputs.queue_stats = AudioSystem::get_backpressure_stats();
+			outputs.last_queue_status = AudioSystem::describe_queue_result(queue_result);
 		}
 	};
 
@@ -4,6 +4,7 @@
 #include "robotick/api.h"
 #include "robotick/framework/math/Pow.h"
 #include "robotick/systems/audio/AudioFrame.h"
+#include "robotick/systems/audio/AudioKernels.h"
 #include "robotick/systems/audio/AudioSystem.h"
 #include "robotick/systems/audio/WavFile.h"
 
@@ -108,10 +109,7 @@ namespace robotick
 					else
 					{
 						outputs.mono.samples.set_size(emit_samples);
-						for (int i = 0; i < emit_samples; ++i)
-						{
-							outputs.mono.samples[i] = 0.5f * (left_ptr[i] + right_ptr[i]);
-						}
+						AudioKernels::average(left_ptr, right_ptr, outputs.mono.samples.data(), emit_samples);
 					}
 				}
 				else
@@ -119,19 +117,16 @@ namespace robotick
 					outputs.left.samples.set_size(emit_samples);
 					outputs.right.samples.set_size(emit_samples);
 					outputs.mono.samples.set_size(emit_samples);
-					for (int i = 0; i < emit_samples; ++i)
+					AudioKernels::copy_with_gain(left_ptr, outputs.left.samples.data(), emit_samples, gain);
+					AudioKernels::copy_with_gain(right_ptr, outputs.right.samples.data(), emit_samples, gain);
+					if (source_is_mono)
+					{
+						outputs.mono.samples.set(outputs.left.samples.data(), emit_samples);
+					}
+					else
 					{
-						outputs.left.samples[i] = gain * left_ptr[i];
-						outputs.right.samples[i] = gain * right_ptr[i];
-						if (source_is_mono)
-						{
-							outputs.mono.samples[i] = outputs.left.samples[i];
-						}
-						else
-						{
-							const float mono_val = 0.5f * (left_ptr[i] + right_ptr[i]);
-							outputs.mono.samples[i] = gain * mono_val;
-						}
+						AudioKernels::average(left_ptr, right_ptr, outputs.mono.samples.data(), emit_samples);
+						AudioKernels::apply_gain(outputs.mono.samples.data(), emit_samples, gain);
 					}
 				}
 
@@ -41,9 +41,15 @@ namespace robotick
 
 	struct CochlearVisualizerInputs
 	{
-		CochlearFrame cochlear_frame;	// envelope[Nbands], band_center_hz[Nbands]
-		HarmonicPitchResult pitch_info; // h1_f0_hz, harmonic_amplitudes[k]
-		ProsodicSegmentBuffer speech_segments;
+		CochlearFrame cochlear_frame;		   // envelope[Nbands], band_center_hz[Nbands]
+		HarmonicPitchResult pitch_info;		   // h1_f0_hz, harmonic_amplitudes[k]
+		ProsodicSegmentBuffer speech_segments; // full set from ProsodyFusion, drawn only if the delta is not connected
+		ProsodicSegmentDelta changed_segments; // its per-tick changes, mirrored locally when connected
+
+		bool changed_segments_complete = true;
+		uint32_t changed_segments_base_revision = 0;
+		uint32_t segments_revision = 0; // 0 = delta not connected: draw speech_segments directly
+		uint32_t segments_handle = 0;	// ProsodicSegmentStore set the mirror refetches from on a gap
 	};
 
 	struct CochlearVisualizerOutputs
@@ -63,6 +69,8 @@ namespace robotick
 		int tex_h = 0;			  // rows (cochlear bands)
 		HeapVector<uint8_t> rgba; // RGBA8888, size = tex_w * tex_h * 4 (desktop/test)
 
+		ProsodicSegmentMirror segment_mirror; // follows inputs.changed_segments
+
 		Renderer renderer;
 	};
 
@@ -153,7 +161,11 @@ namespace robotick
 			s.initialized = true;
 		}
 
-		void start(float tick_rate_hz) { initialize_renderer(tick_rate_hz); }
+		void start(float tick_rate_hz)
+		{
+			state->segment_mirror.clear();
+			initialize_renderer(tick_rate_hz);
+		}
 
 		void tick(const TickInfo& tick)
 		{
@@ -291,7 +303,18 @@ namespace robotick
 					overlays.add(overlay);
 				};
 
-				for (const ProsodicSegment& segment : inputs.speech_segments)
+				const ProsodicSegmentBuffer* speech_segments = &inputs.speech_segments;
+				if (inputs.segments_revision != 0)
+				{
+					s.segment_mirror.sync(inputs.changed_segments,
+						inputs.changed_segments_complete,
+						inputs.changed_segments_base_revision,
+						inputs.segments_revision,
+						inputs.segments_handle);
+					speech_segments = &s.segment_mirror.segments;
+				}
+
+				for (const ProsodicSegment& segment : *speech_segments)
 				{
 					if (!segment_has_span(segment))
 					{
@@ -469,7 +492,11 @@ namespace robotick
 			}
 		}
 
-		void stop() { state->renderer.cleanup(); }
+		void stop()
+		{
+			state->segment_mirror.clear();
+			state->renderer.cleanup();
+		}
 	};
 
 } // namespace robotick
@@ -35,7 +35,16 @@ namespace robotick
 
 	struct ProsodyFusionOutputs
 	{
+		// Full segment set (over 100 KB) - wire it only where every tick needs the whole set. Consumers that only
+		// need updates follow changed_segments with a ProsodicSegmentMirror, which refetches the full set from
+		// ProsodicSegmentStore (by segments_handle) whenever it has missed a revision.
 		ProsodicSegmentBuffer speech_segments;
+
+		ProsodicSegmentDelta changed_segments;		 // segments whose revision changed this tick
+		bool changed_segments_complete = true;		 // false if more changed than fit - mirrors refetch the full set
+		uint32_t changed_segments_base_revision = 0; // changed_segments holds every change after this revision
+		uint32_t segments_revision = 0;				 // revision of the most recent change
+		uint32_t segments_handle = 0;				 // ProsodicSegmentStore set holding the full segments (0 = none)
 	};
 
 	// Keeps the rolling prosody buffer plus the last transcript metadata to
@@ -56,6 +65,11 @@ namespace robotick
 		bool in_voiced_segment = false;
 		float current_segment_start = -1.0f;
 		float last_voiced_time = -1.0f;
+		float live_segment_end = -1.0f; // last_voiced_time the live segment was last built up to
+
+		// Monotonic across start/stop so consumer mirrors never see an id or revision reused.
+		uint32_t revision = 0;
+		uint32_t next_segment_id = 0;
 	};
 
 	struct ProsodyFusionWorkload
@@ -66,14 +80,42 @@ namespace robotick
 		StatePtr<ProsodyFusionState> state;
 
 		void start(float /*tick_rate_hz*/)
+		{
+			if (outputs.segments_handle == 0)
+			{
+				outputs.segments_handle = ProsodicSegmentStore::get().acquire_set();
+			}
+			reset();
+		}
+
+		void reset()
 		{
 			state->history.clear();
 			state->last_proto_text.clear();
 			state->last_final_text.clear();
-			outputs.speech_segments.clear();
 			state->in_voiced_segment = false;
 			state->current_segment_start = -1.0f;
 			state->last_voiced_time = -1.0f;
+			state->live_segment_end = -1.0f;
+
+			// Clearing the segments is itself a change: bump the revision so every mirror sees a gap and resyncs.
+			outputs.speech_segments.clear();
+			outputs.changed_segments.clear();
+			outputs.changed_segments_complete = true;
+			outputs.segments_revision = ++state->revision;
+			outputs.changed_segments_base_revision = state->revision;
+			publish_segments();
+		}
+
+		// Bring our ProsodicSegmentStore set up to the current outputs (applying the delta in place).
+		void publish_segments()
+		{
+			ProsodicSegmentStore::get().publish(outputs.segments_handle,
+				outputs.changed_segments,
+				outputs.changed_segments_complete,
+				outputs.changed_segments_base_revision,
+				outputs.segments_revision,
+				outputs.speech_segments);
 		}
 
 		ProsodicSegment* find_segment_for_transcript(const Transcript& transcript)
@@ -96,8 +138,11 @@ namespace robotick
 			return nullptr;
 		}
 
+		void mark_segment_changed(ProsodicSegment& segment) { segment.revision = ++state->revision; }
+
 		void annotate_segment_with_transcript(ProsodicSegment& segment, const Transcript& transcript, ProsodicSegmentState new_state)
 		{
+			mark_segment_changed(segment);
 			segment.state = new_state;
 			segment.words.clear();
 			for (const TranscribedWord& word : transcript.words)
@@ -118,13 +163,20 @@ namespace robotick
 				const bool overlaps = fabsf(candidate.start_time_sec - segment.start_time_sec) <= config.segment_merge_tolerance_sec;
 				if (overlaps)
 				{
+					// Replace in place, keeping the handle consumers already know.
+					const uint32_t segment_id = candidate.segment_id;
 					candidate = segment;
+					candidate.segment_id = segment_id;
+					mark_segment_changed(candidate);
 					return candidate;
 				}
 			}
 
 			append_segment_with_capacity(outputs.speech_segments, segment);
-			return outputs.speech_segments[outputs.speech_segments.size() - 1];
+			ProsodicSegment& appended = outputs.speech_segments[outputs.speech_segments.size() - 1];
+			appended.segment_id = ++state->next_segment_id;
+			mark_segment_changed(appended);
+			return appended;
 		}
 
 		static bool transcript_has_content(const Transcript& transcript) { return (!transcript.text.empty()) && (transcript.duration_sec > 0.0f); }
@@ -419,6 +471,8 @@ namespace robotick
 
 		void tick(const TickInfo& tick_info)
 		{
+			const uint32_t tick_start_revision = state->revision;
+
 			append_history_sample(inputs.prosody_state, tick_info.time_now);
 
 			const bool is_voiced = inputs.prosody_state.is_voiced;
@@ -432,8 +486,12 @@ namespace robotick
 				}
 			}
 
-			if (state->in_voiced_segment && state->last_voiced_time > state->current_segment_start)
+			// The live segment only grows while voiced; through the silence hangover it is left untouched.
+			if (state->in_voiced_segment && state->last_voiced_time > state->current_segment_start &&
+				state->last_voiced_time != state->live_segment_end)
 			{
+				state->live_segment_end = state->last_voiced_time;
+
 				ProsodicSegment live_segment;
 				if (build_segment_from_history_window(
 						state->current_segment_start, state->last_voiced_time, ProsodicSegmentState::Ongoing, live_segment))
@@ -456,6 +514,7 @@ namespace robotick
 
 				state->in_voiced_segment = false;
 				state->current_segment_start = -1.0f;
+				state->live_segment_end = -1.0f;
 			}
 
 			// Proto segment: Whisper is mid-sentence. We surface it immediately
@@ -493,17 +552,23 @@ namespace robotick
 					}
 				}
 			}
+
+			// Publish only what changed this tick alongside the full buffer.
+			outputs.changed_segments_complete =
+				collect_segments_changed_since(outputs.speech_segments, tick_start_revision, outputs.changed_segments);
+			outputs.changed_segments_base_revision = tick_start_revision;
+			outputs.segments_revision = state->revision;
+			if (state->revision != tick_start_revision)
+			{
+				publish_segments();
+			}
 		}
 
 		void stop()
 		{
-			state->history.clear();
-			state->last_proto_text.clear();
-			state->last_final_text.clear();
-			outputs.speech_segments.clear();
-			state->in_voiced_segment = false;
-			state->current_segment_start = -1.0f;
-			state->last_voiced_time = -1.0f;
+			reset();
+			ProsodicSegmentStore::get().release_set(outputs.segments_handle);
+			outputs.segments_handle = 0;
 		}
 	};
 
@@ -14,7 +14,10 @@ namespace robotick
 {
 	struct ProsodyWaveGeneratorConfig
 	{
-		// --- Global output ---
+		// --- Voice pool ---
+		int num_voices = 1; // 1..8 voices, each driven by its own prosody input and mixed into one output
+
+		// --- Global output (applied per voice) ---
 		float amplitude_gain_db = 0.0f;
 		bool use_rms_for_amplitude = true;
 		bool use_voiced_gate = true;
@@ -55,19 +58,29 @@ namespace robotick
 	struct ProsodyWaveGeneratorInputs
 	{
 		bool enabled = true;
+
+		// One prosody input per voice (voice 1 = prosody_state). Only the first config.num_voices are used;
+		// a voice whose input is gated/silent costs nothing once its release tail has played out.
 		ProsodyState prosody_state;
+		ProsodyState prosody_state2;
+		ProsodyState prosody_state3;
+		ProsodyState prosody_state4;
+		ProsodyState prosody_state5;
+		ProsodyState prosody_state6;
+		ProsodyState prosody_state7;
+		ProsodyState prosody_state8;
 	};
 
 	struct ProsodyWaveGeneratorOutputs
 	{
-		AudioFrame mono;
+		AudioFrame mono;	   // all active voices mixed (clipped to [-1, 1] when num_voices > 1)
+		int active_voices = 0; // voices that produced audio this tick
 	};
 
-	struct ProsodyWaveGeneratorState
+	struct ProsodyVoiceState
 	{
 		static constexpr int MaxOsc = 1 + 8; // 1 fundamental + up to 8 synthetic partials
 
-		double sample_accum = 0.0;
 		double last_step_fundamental = 0.0;
 		double phase[MaxOsc] = {0.0};
 
@@ -88,6 +101,17 @@ namespace robotick
 			random_state = x;
 			return static_cast<float>(static_cast<int32_t>(x) / 2147483648.0f);
 		}
+
+		// Silent and fully released - nothing to synthesize.
+		bool is_idle() const { return previous_amplitude_linear == 0.0f; }
+	};
+
+	struct ProsodyWaveGeneratorState
+	{
+		static constexpr int MaxVoices = 8;
+
+		double sample_accum = 0.0;
+		ProsodyVoiceState voices[MaxVoices];
 	};
 
 	struct ProsodyWaveGeneratorWorkload
@@ -113,68 +137,98 @@ namespace robotick
 		void load()
 		{
 			AudioSystem::init();
-			for (double& p : state->phase)
+			config.num_voices = robotick::clamp(config.num_voices, 1, ProsodyWaveGeneratorState::MaxVoices);
+			for (int voice_index = 0; voice_index < ProsodyWaveGeneratorState::MaxVoices; ++voice_index)
 			{
-				p = 0.0;
+				ProsodyVoiceState& voice = state->voices[voice_index];
+				voice = ProsodyVoiceState{};
+				voice.random_state += 0x9E3779B9u * static_cast<uint32_t>(voice_index); // decorrelate voice noise
 			}
-			state->noise_filter_state = 0.0f;
-			state->previous_amplitude_linear = 0.0f;
-			state->tone_gain_smooth = state->partial_gain_smooth = state->noise_gain_smooth = 0.0f;
 			state->sample_accum = 0.0;
 		}
 
 		void start(float) { outputs.mono.sample_rate = AudioSystem::get_sample_rate(); }
 
-		int emit_smooth_zero(AudioFrame& out, ProsodyWaveGeneratorState& s, int max_tail_samples)
+		const ProsodyState& get_voice_input(int voice_index) const
 		{
-			const int capacity = static_cast<int>(out.samples.capacity());
-			if (capacity <= 0)
-			{
-				return 0;
-			}
+			const ProsodyState* voice_inputs[ProsodyWaveGeneratorState::MaxVoices] = {
+				&inputs.prosody_state,
+				&inputs.prosody_state2,
+				&inputs.prosody_state3,
+				&inputs.prosody_state4,
+				&inputs.prosody_state5,
+				&inputs.prosody_state6,
+				&inputs.prosody_state7,
+				&inputs.prosody_state8,
+			};
+			return *voice_inputs[voice_index];
+		}
 
-			out.samples.set_size(capacity);
+		// Continue a voice that has just been gated off along its last slope until it reaches zero (adds into mix).
+		static void add_release_tail(float* mix, int num_samples, ProsodyVoiceState& voice, int max_tail_samples)
+		{
+			const double current_value =
+				sin(voice.phase[0]) * static_cast<double>(voice.tone_gain_smooth) * static_cast<double>(voice.previous_amplitude_linear);
+			const double slope = cos(voice.phase[0]) * voice.last_step_fundamental * static_cast<double>(voice.tone_gain_smooth) *
+								 static_cast<double>(voice.previous_amplitude_linear);
 
-			const double current_value = sin(s.phase[0]) * static_cast<double>(s.tone_gain_smooth) * static_cast<double>(s.previous_amplitude_linear);
-			const double slope = cos(s.phase[0]) * s.last_step_fundamental * static_cast<double>(s.tone_gain_smooth) *
-								 static_cast<double>(s.previous_amplitude_linear);
+			voice.previous_amplitude_linear = 0.0f;
 
-			const int upper = robotick::min(max_tail_samples, capacity);
+			const int upper = robotick::min(max_tail_samples, num_samples);
 			if (upper <= 0)
 			{
-				return 0;
+				return;
 			}
 
-			int num_samples = 0;
+			int tail_samples = 0;
 			if (fabs(slope) > 1e-9)
 			{
-				num_samples = static_cast<int>(ceil(fabs(current_value / slope)));
+				tail_samples = static_cast<int>(ceil(fabs(current_value / slope)));
 			}
+			tail_samples = (upper >= 4) ? robotick::clamp(tail_samples, 4, upper) : upper;
 
-			num_samples = robotick::clamp(num_samples, 0, upper);
-			if (upper >= 4)
+			double value = current_value;
+			for (int sample_index = 0; sample_index < tail_samples; ++sample_index)
 			{
-				num_samples = robotick::max(num_samples, 4);
+				mix[sample_index] += static_cast<float>(value);
+				value -= slope;
 			}
-			else
+		}
+
+		// A full-capacity frame holding only the release tails of voices still sounding, then silence.
+		// Used whenever there is nothing to synthesize this tick, exactly as the single-voice generator always did.
+		void emit_release_frame(int max_tail_samples)
+		{
+			const int capacity = static_cast<int>(outputs.mono.samples.capacity());
+			outputs.mono.samples.set_size(capacity);
+
+			float* mix = outputs.mono.samples.data();
+			::memset(mix, 0, static_cast<size_t>(capacity) * sizeof(float));
+
+			for (int voice_index = 0; voice_index < config.num_voices; ++voice_index)
 			{
-				num_samples = upper;
+				ProsodyVoiceState& voice = state->voices[voice_index];
+				if (!voice.is_idle())
+				{
+					add_release_tail(mix, capacity, voice, max_tail_samples);
+				}
 			}
 
-			double value = current_value;
-			for (int sample_index = 0; sample_index < num_samples; ++sample_index)
+			clip_mix(mix, capacity);
+		}
+
+		// Summed voices can exceed full scale; a lone voice is left untouched, as before the voice pool.
+		void clip_mix(float* mix, int num_samples) const
+		{
+			if (config.num_voices <= 1)
 			{
-				out.samples[sample_index] = static_cast<float>(value);
-				value -= slope;
+				return;
 			}
 
-			for (int sample_index = num_samples; sample_index < capacity; ++sample_index)
+			for (int sample_index = 0; sample_index < num_samples; ++sample_index)
 			{
-				out.samples[sample_index] = 0.0f;
+				mix[sample_index] = robotick::clamp(mix[sample_index], -1.0f, 1.0f);
 			}
-
-			s.previous_amplitude_linear = 0.0f;
-			return capacity;
 		}
 
 		double compute_partial_weight(const ProsodyState& prosody, int harmonic_index_zero_based, int max_harmonics)
@@ -228,14 +282,79 @@ namespace robotick
 			static constexpr double ns_to_sec = 1e-9;
 			outputs.mono.timestamp = ns_to_sec * static_cast<double>(tick_info.time_now_ns);
 
-			const ProsodyState& prosody = inputs.prosody_state;
+			outputs.active_voices = 0;
+
+			bool any_voice_open = false;
+			for (int voice_index = 0; voice_index < config.num_voices; ++voice_index)
+			{
+				any_voice_open = any_voice_open || !(config.use_voiced_gate && !get_voice_input(voice_index).is_voiced);
+			}
 
-			if (config.use_voiced_gate && !prosody.is_voiced)
+			// Every voice gated: a full frame of release tails + silence, without advancing the sample clock.
+			if (!any_voice_open)
 			{
-				emit_smooth_zero(outputs.mono, state.get(), 64);
+				emit_release_frame(64);
 				return;
 			}
 
+			// --- Determine how many samples to produce (shared by all voices) ---
+			const int sample_rate = outputs.mono.sample_rate;
+			state->sample_accum += static_cast<double>(sample_rate) * static_cast<double>(tick_info.delta_time);
+			int num_samples = static_cast<int>(state->sample_accum);
+			state->sample_accum -= num_samples;
+
+			if (num_samples <= 0)
+			{
+				// Open voices still track their prosody (gain smoothing) so the next frame picks up where it should.
+				for (int voice_index = 0; voice_index < config.num_voices; ++voice_index)
+				{
+					const ProsodyState& prosody = get_voice_input(voice_index);
+					if (!(config.use_voiced_gate && !prosody.is_voiced))
+					{
+						synthesize_voice(prosody, state->voices[voice_index], nullptr, 0, tick_info);
+					}
+				}
+				emit_release_frame(16);
+				return;
+			}
+
+			num_samples = robotick::min(num_samples, static_cast<int>(outputs.mono.samples.capacity()));
+			outputs.mono.samples.set_size(num_samples);
+
+			// --- Mix: every active voice accumulates into the output in its own single pass ---
+			float* mix = outputs.mono.samples.data();
+			::memset(mix, 0, static_cast<size_t>(num_samples) * sizeof(float));
+
+			for (int voice_index = 0; voice_index < config.num_voices; ++voice_index)
+			{
+				const ProsodyState& prosody = get_voice_input(voice_index);
+				ProsodyVoiceState& voice = state->voices[voice_index];
+
+				const bool is_gated = (config.use_voiced_gate && !prosody.is_voiced);
+				if (is_gated)
+				{
+					if (!voice.is_idle())
+					{
+						add_release_tail(mix, num_samples, voice, 64);
+					}
+					continue;
+				}
+
+				if (synthesize_voice(prosody, voice, mix, num_samples, tick_info))
+				{
+					++outputs.active_voices;
+				}
+			}
+
+			clip_mix(mix, num_samples);
+		}
+
+		// Synthesize one voice and add it into mix[0..num_samples). Returns false if the voice was idle or there
+		// were no samples to produce (its gains are still smoothed towards this tick's prosody).
+		bool synthesize_voice(const ProsodyState& prosody, ProsodyVoiceState& voice, float* mix, int num_samples, const TickInfo& tick_info)
+		{
+			(void)tick_info; // used by ENABLE_PARTIALS_LOG
+
 			const int sample_rate = outputs.mono.sample_rate;
 			const double nyquist_hz = 0.5 * static_cast<double>(sample_rate);
 			const double frequency_guard = 0.98 * nyquist_hz;
@@ -254,7 +373,7 @@ namespace robotick
 
 			if (step_fundamental > 0.0)
 			{
-				state->last_step_fundamental = step_fundamental;
+				voice.last_step_fundamental = step_fundamental;
 			}
 
 			// --- Interpret expressive cues ---
@@ -291,13 +410,18 @@ namespace robotick
 
 			// Smooth gains
 			const float mix_alpha = clamp01(config.mix_smooth_alpha);
-			state->tone_gain_smooth = (1.0f - mix_alpha) * state->tone_gain_smooth + mix_alpha * tone_gain;
-			state->partial_gain_smooth = (1.0f - mix_alpha) * state->partial_gain_smooth + mix_alpha * partials_gain;
-			state->noise_gain_smooth = (1.0f - mix_alpha) * state->noise_gain_smooth + mix_alpha * noise_gain;
+			voice.tone_gain_smooth = (1.0f - mix_alpha) * voice.tone_gain_smooth + mix_alpha * tone_gain;
+			voice.partial_gain_smooth = (1.0f - mix_alpha) * voice.partial_gain_smooth + mix_alpha * partials_gain;
+			voice.noise_gain_smooth = (1.0f - mix_alpha) * voice.noise_gain_smooth + mix_alpha * noise_gain;
 
-			tone_gain = state->tone_gain_smooth;
-			partials_gain = state->partial_gain_smooth;
-			noise_gain = state->noise_gain_smooth;
+			tone_gain = voice.tone_gain_smooth;
+			partials_gain = voice.partial_gain_smooth;
+			noise_gain = voice.noise_gain_smooth;
+
+			if (num_samples <= 0 || (amplitude_linear == 0.0f && voice.is_idle()))
+			{
+				return false; // nothing to produce, or silent and already faded out - skip all per-sample work
+			}
 
 			// --- Noise LPF cutoff ---
 			float cutoff_hz = config.noise_cutoff_default_hz;
@@ -309,27 +433,58 @@ namespace robotick
 			const float alpha =
 				robotick::clamp(1.0f - expf(-2.0f * static_cast<float>(two_pi) * (cutoff_hz / static_cast<float>(sample_rate))), 1e-5f, 0.9999f);
 
-			// --- Determine how many samples to produce ---
-			state->sample_accum += static_cast<double>(sample_rate) * static_cast<double>(tick_info.delta_time);
-			int num_samples = static_cast<int>(state->sample_accum);
-			state->sample_accum -= num_samples;
-
-			if (num_samples <= 0)
+			// --- Partial amplitudes/steps depend only on this tick's prosody: compute once, not per sample ---
+			const int num_partials = robotick::clamp(config.max_num_partials, 0, ProsodyVoiceState::MaxOsc - 1);
+			double partial_amplitude[ProsodyVoiceState::MaxOsc] = {0.0};
+			double partial_step[ProsodyVoiceState::MaxOsc] = {0.0};
+			int num_audible_partials = 0;
+			if (partials_gain > 0.0f && f0 > 0.0)
 			{
-				emit_smooth_zero(outputs.mono, state.get(), 16);
-				return;
-			}
+#if ENABLE_PARTIALS_LOG
+				const bool emit_log = (tick_info.tick_count % 10) == 0;
+				FixedString<512> harmonic_log = "partials: ";
+#endif // #if ENABLE_PARTIALS_LOG
 
-			num_samples = robotick::min(num_samples, static_cast<int>(outputs.mono.samples.capacity()));
-			outputs.mono.samples.set_size(num_samples);
+				for (int harmonic_index = 0; harmonic_index < num_partials; ++harmonic_index)
+				{
+					const double harmonic_frequency = (harmonic_index + 2) * f0;
+					if (harmonic_frequency >= frequency_guard)
+					{
+						break; // harmonics only rise from here
+					}
 
-			double phase_local[ProsodyWaveGeneratorState::MaxOsc];
-			::memcpy(phase_local, state->phase, sizeof(phase_local));
-			float noise_state = state->noise_filter_state;
+					const double baseRolloff = 1.0 / (1.0 + harmonic_index); // keep your gentle rolloff
+					const double w = compute_partial_weight(prosody, harmonic_index, num_partials);
+					partial_amplitude[harmonic_index] = w * baseRolloff;
+					partial_step[harmonic_index] = two_pi * harmonic_frequency / static_cast<double>(sample_rate);
+					num_audible_partials = harmonic_index + 1;
 
-			const float amplitude_start = state->previous_amplitude_linear;
+#if ENABLE_PARTIALS_LOG
+					// Append to single-line log
+					if (emit_log)
+					{
+						harmonic_log.appendf("h%d=%.3f ", harmonic_index + 1, partial_amplitude[harmonic_index]);
+					}
+#endif // #if ENABLE_PARTIALS_LOG
+				}
+
+#if ENABLE_PARTIALS_LOG
+				if (emit_log)
+				{
+					ROBOTICK_INFO("%s", harmonic_log.c_str());
+				}
+#endif // #if ENABLE_PARTIALS_LOG
+			}
+
+			double phase_local[ProsodyVoiceState::MaxOsc];
+			::memcpy(phase_local, voice.phase, sizeof(phase_local));
+			float noise_state = voice.noise_filter_state;
+
+			const float amplitude_start = voice.previous_amplitude_linear;
 			const float amplitude_end = amplitude_linear;
 			const double denominator = (num_samples > 1) ? static_cast<double>(num_samples - 1) : 1.0;
+			const bool has_tone = (tone_gain > 0.0f && step_fundamental > 0.0);
+			const int phase_limit = robotick::min(1 + num_partials, ProsodyVoiceState::MaxOsc);
 
 			for (int sample_index = 0; sample_index < num_samples; ++sample_index)
 			{
@@ -342,61 +497,24 @@ namespace robotick
 				double signal_noise = 0.0;
 
 				// --- Tone ---
-				if (tone_gain > 0.0f && step_fundamental > 0.0)
+				if (has_tone)
 				{
 					signal_tone = sin(phase_local[0]);
 					phase_local[0] += step_fundamental;
 				}
 
 				// --- Synthetic partials ---
-				if (partials_gain > 0.0f && f0 > 0.0)
+				for (int harmonic_index = 0; harmonic_index < num_audible_partials; ++harmonic_index)
 				{
-#if ENABLE_PARTIALS_LOG
-					const bool emit_log = (tick_info.tick_count % 10) == 0;
-					FixedString<512> harmonic_log = "partials: ";
-#endif // #if ENABLE_PARTIALS_LOG
-
-					const int num_partials = robotick::clamp(config.max_num_partials, 0, ProsodyWaveGeneratorState::MaxOsc - 1);
-					for (int harmonic_index = 0; harmonic_index < num_partials; ++harmonic_index)
-					{
-						const double harmonic_frequency = (harmonic_index + 2) * f0;
-						if (harmonic_frequency >= frequency_guard)
-						{
-							continue;
-						}
-
-						const int phase_index = 1 + harmonic_index;
-
-						const double baseRolloff = 1.0 / (1.0 + harmonic_index); // keep your gentle rolloff
-						const double w = compute_partial_weight(
-							prosody, harmonic_index, robotick::clamp(config.max_num_partials, 0, ProsodyWaveGeneratorState::MaxOsc - 1));
-						const double harmonic_amplitude = w * baseRolloff;
-						signal_partials += harmonic_amplitude * sin(phase_local[phase_index]);
-
-						const double harmonic_step = two_pi * harmonic_frequency / static_cast<double>(sample_rate);
-						phase_local[phase_index] += harmonic_step;
-
-#if ENABLE_PARTIALS_LOG
-						// Append to single-line log
-						if (emit_log)
-						{
-							harmonic_log.appendf("h%d=%.3f ", harmonic_index + 1, harmonic_amplitude);
-						}
-#endif // #if ENABLE_PARTIALS_LOG
-					}
-
-#if ENABLE_PARTIALS_LOG
-					if (emit_log)
-					{
-						ROBOTICK_INFO("%s", harmonic_log.c_str());
-					}
-#endif // #if ENABLE_PARTIALS_LOG
+					const int phase_index = 1 + harmonic_index;
+					signal_partials += partial_amplitude[harmonic_index] * sin(phase_local[phase_index]);
+					phase_local[phase_index] += partial_step[harmonic_index];
 				}
 
 				// --- Noise (one-pole LPF) ---
 				if (noise_gain > 0.0f)
 				{
-					const float white_noise = state->random_uniform_pm1();
+					const float white_noise = voice.random_uniform_pm1();
 					noise_state = noise_state + alpha * (white_noise - noise_state);
 					signal_noise = static_cast<double>(noise_state);
 				}
@@ -404,11 +522,9 @@ namespace robotick
 				const double mixed_signal = static_cast<double>(tone_gain) * signal_tone + static_cast<double>(partials_gain) * signal_partials +
 											static_cast<double>(noise_gain) * signal_noise;
 
-				outputs.mono.samples[sample_index] = static_cast<float>(amplitude * mixed_signal);
+				mix[sample_index] += static_cast<float>(amplitude * mixed_signal);
 
 				// Wrap phases for tone + partials
-				const int max_phase_index = 1 + config.max_num_partials;
-				const int phase_limit = robotick::min(max_phase_index, ProsodyWaveGeneratorState::MaxOsc);
 				for (int phase_index = 0; phase_index < phase_limit; ++phase_index)
 				{
 					if (phase_local[phase_index] >= two_pi)
@@ -423,9 +539,10 @@ namespace robotick
 			}
 
 			// --- Persist state ---
-			::memcpy(state->phase, phase_local, sizeof(phase_local));
-			state->noise_filter_state = noise_state;
-			state->previous_amplitude_linear = amplitude_linear;
+			::memcpy(voice.phase, phase_local, sizeof(phase_local));
+			voice.noise_filter_state = noise_state;
+			voice.previous_amplitude_linear = amplitude_linear;
+			return true;
 		}
 	};
 
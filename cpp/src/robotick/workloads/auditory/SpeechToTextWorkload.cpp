@@ -109,10 +109,17 @@ namespace robotick
 	};
 
 	// ---------------------------------------------------------------
-	// Simple linear downsampler to 16 kHz
+	// Simple linear downsampler to 16 kHz (pass-through when the mic already runs at 16 kHz)
 	// ---------------------------------------------------------------
 	static void downsample_to_accumulator_rate(const AudioBuffer512& input, const uint32_t input_rate, AudioBuffer512& output)
 	{
+		if (input_rate == accumulator_sample_rate_hz)
+		{
+			// Device already runs at the model rate - nothing to resample.
+			output.set(input.data(), input.size());
+			return;
+		}
+
 		const double ratio = static_cast<double>(input_rate) / static_cast<double>(accumulator_sample_rate_hz);
 		if (ratio <= 0.0)
 		{
@@ -5,6 +5,7 @@
 #include "robotick/framework/WorkloadInstanceInfo.h"
 #include "robotick/framework/data/DataConnection.h"
 #include "robotick/framework/time/Clock.h"
+#include "robotick/systems/WorkloadCpuStats.h"
 
 #include <string>
 namespace robotick
@@ -15,6 +16,7 @@ namespace robotick
 		{
 			const WorkloadInstanceInfo* workload_info = nullptr;
 			void* workload_ptr = nullptr;
+			WorkloadCpuStats* cpu_stats = nullptr;
 
 			List<const DataConnectionInfo*> connections_in;
 		};
@@ -66,6 +68,7 @@ namespace robotick
 
 				info.workload_info = child_workload;
 				info.workload_ptr = child_workload->get_ptr(*engine);
+				info.cpu_stats = WorkloadCpuStatsRegistry::get().find_or_add(child_workload->seed->unique_name.c_str());
 
 				ROBOTICK_ASSERT(info.workload_info && info.workload_info->type);
 				const WorkloadDescriptor* workload_desc = info.workload_info->type->get_workload_desc();
@@ -110,6 +113,8 @@ namespace robotick
 		{
 			ROBOTICK_ASSERT(engine != nullptr && "Engine should have been set by now");
 
+			const bool cpu_stats_enabled = WorkloadCpuStatsRegistry::get().is_enabled();
+
 			for (auto& child_info : children)
 			{
 				if (child_info.workload_info != nullptr && child_info.workload_info->workload_descriptor->tick_fn != nullptr)
@@ -126,16 +131,27 @@ namespace robotick
 					const auto budget_duration = Clock::from_seconds(1.0f / child_info.workload_info->seed->tick_rate_hz);
 					const uint32_t budget_ns = detail::clamp_to_uint32(Clock::to_nanoseconds(budget_duration).count());
 
+					ThreadCpuSample cpu_before;
+					const bool sample_cpu = cpu_stats_enabled && child_info.cpu_stats != nullptr && sample_thread_cpu(cpu_before);
+
 					const auto now_pre_tick = Clock::now();
 					child_info.workload_info->workload_descriptor->tick_fn(child_info.workload_ptr, child_tick_info);
 					const auto now_post_tick = Clock::now();
 
+					ThreadCpuSample cpu_after;
+					const bool has_cpu_sample = sample_cpu && sample_thread_cpu(cpu_after);
+
 					const uint32_t duration_ns = detail::clamp_to_uint32(Clock::to_nanoseconds(now_post_tick - now_pre_tick).count());
 
 					const auto delta_duration = Clock::from_seconds(child_tick_info.delta_time);
 					const uint32_t delta_ns = detail::clamp_to_uint32(Clock::to_nanoseconds(delta_duration).count());
 					child_info.workload_info->workload_stats->record_tick_sample(duration_ns, delta_ns, budget_ns);
 					child_info.workload_info->workload_stats->tick_count++;
+
+					if (has_cpu_sample)
+					{
+						child_info.cpu_stats->record_tick(duration_ns, cpu_before, cpu_after);
+					}
 				}
 			}
 		}
@@ -8,6 +8,7 @@
 #include "robotick/framework/concurrency/Thread.h"
 #include "robotick/framework/data/DataConnection.h"
 #include "robotick/framework/time/Clock.h"
+#include "robotick/systems/WorkloadCpuStats.h"
 
 #include <string>
 
@@ -22,6 +23,7 @@ namespace robotick
 			AtomicValue<uint32_t> tick_counter;
 			const WorkloadInstanceInfo* workload_info = nullptr;
 			void* workload_ptr = nullptr;
+			WorkloadCpuStats* cpu_stats = nullptr;
 		};
 
 		const Engine* engine = nullptr;
@@ -62,6 +64,7 @@ namespace robotick
 
 				info.workload_info = child_workload;
 				info.workload_ptr = child_workload->get_ptr(*engine);
+				info.cpu_stats = WorkloadCpuStatsRegistry::get().find_or_add(child_workload->seed->unique_name.c_str());
 
 				ROBOTICK_ASSERT(child_workload->workload_descriptor != nullptr);
 
@@ -167,6 +170,7 @@ namespace robotick
 			tick_info.tick_rate_hz = child.seed->tick_rate_hz;
 
 			auto workload_tick_fn = child.workload_descriptor->tick_fn;
+			const WorkloadCpuStatsRegistry& cpu_stats_registry = WorkloadCpuStatsRegistry::get();
 
 			if (child.workload_descriptor->start_fn)
 			{
@@ -201,9 +205,15 @@ namespace robotick
 
 				thread_fence_acquire();
 
+				ThreadCpuSample cpu_before;
+				const bool sample_cpu = child_info.cpu_stats != nullptr && cpu_stats_registry.is_enabled() && sample_thread_cpu(cpu_before);
+
 				workload_tick_fn(child_info.workload_ptr, tick_info);
 				next_tick_time += tick_interval;
 
+				ThreadCpuSample cpu_after;
+				const bool has_cpu_sample = sample_cpu && sample_thread_cpu(cpu_after);
+
 				const auto now_post = Clock::now();
 				const uint32_t duration_ns = detail::clamp_to_uint32(Clock::to_nanoseconds(now_post - now).count());
 
@@ -211,6 +221,11 @@ namespace robotick
 				child.workload_stats->record_tick_sample(duration_ns, delta_ns, budget_ns);
 				child.workload_stats->tick_count++;
 
+				if (has_cpu_sample)
+				{
+					child_info.cpu_stats->record_tick(duration_ns, cpu_before, cpu_after);
+				}
+
 				Thread::hybrid_sleep_until(next_tick_time);
 			}
 		}
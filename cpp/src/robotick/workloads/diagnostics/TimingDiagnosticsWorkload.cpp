@@ -3,6 +3,8 @@
 
 #include "robotick/api.h"
 #include "robotick/framework/math/Sqrt.h"
+#include "robotick/framework/strings/FixedString.h"
+#include "robotick/systems/WorkloadCpuStats.h"
 
 namespace robotick
 {
@@ -12,6 +14,7 @@ namespace robotick
 	struct TimingDiagnosticsConfig
 	{
 		int log_rate_hz = 1;
+		bool report_workload_cpu = false; // per-workload CPU time vs wall time, and context switches (ticked by group workloads)
 	};
 
 	struct TimingDiagnosticsInputs
@@ -23,6 +26,10 @@ namespace robotick
 		float last_tick_rate = 0.0;
 		float avg_tick_rate = 0.0;
 		float tick_stddev = 0.0;
+
+		// Workload that spent the largest share of its tick wall time off-CPU (blocked or preempted) over the last report period
+		FixedString64 most_off_cpu_workload;
+		float most_off_cpu_fraction = 0.0;
 	};
 
 	// === Internal state (not registered) ===
@@ -32,6 +39,9 @@ namespace robotick
 		int count = 0;
 		float sum_dt = 0.0;
 		float sum_dt2 = 0.0;
+
+		WorkloadCpuTotals last_cpu_totals[WorkloadCpuStatsRegistry::kMaxWorkloads];
+		bool is_cpu_reporter = false; // holds one WorkloadCpuStatsRegistry reporter between start() and stop()
 	};
 
 	// === Workload ===
@@ -51,6 +61,25 @@ namespace robotick
 			internal_state.sum_dt2 = 0.0;
 		}
 
+		void start(float)
+		{
+			if (config.report_workload_cpu && !internal_state.is_cpu_reporter)
+			{
+				WorkloadCpuStatsRegistry::get().add_reporter();
+				internal_state.is_cpu_reporter = true;
+			}
+		}
+
+		void stop()
+		{
+			// Only drop our own hold: another TimingDiagnosticsWorkload may still be reporting.
+			if (internal_state.is_cpu_reporter)
+			{
+				WorkloadCpuStatsRegistry::get().remove_reporter();
+				internal_state.is_cpu_reporter = false;
+			}
+		}
+
 		void tick(const TickInfo& tick_info)
 		{
 			if (config.log_rate_hz == 0 || tick_info.delta_time <= 0.0f)
@@ -84,11 +113,62 @@ namespace robotick
 				ROBOTICK_INFO(
 					"[TimingDiagnostics] avg: %.2f Hz, stddev: %.2f us", outputs.avg_tick_rate, outputs.tick_stddev * seconds_to_microseconds);
 
+				if (config.report_workload_cpu)
+				{
+					report_workload_cpu();
+				}
+
 				internal_state.count = 0;
 				internal_state.sum_dt = 0.0f;
 				internal_state.sum_dt2 = 0.0f;
 			}
 		}
+
+		void report_workload_cpu()
+		{
+			static constexpr float ns_to_microseconds = 1e-3f;
+
+			outputs.most_off_cpu_workload.clear();
+			outputs.most_off_cpu_fraction = 0.0f;
+
+			const WorkloadCpuStatsRegistry& registry = WorkloadCpuStatsRegistry::get();
+			const uint32_t count = registry.get_count();
+			for (uint32_t i = 0; i < count; ++i)
+			{
+				const WorkloadCpuStats& stats = registry.get_entry(i);
+				const WorkloadCpuTotals totals = stats.get_totals();
+				WorkloadCpuTotals& last = internal_state.last_cpu_totals[i];
+
+				const uint64_t ticks = totals.tick_count - last.tick_count;
+				const uint64_t wall_ns = totals.wall_ns - last.wall_ns;
+				const uint64_t cpu_ns = totals.cpu_ns - last.cpu_ns;
+				const uint64_t voluntary = totals.voluntary_switches - last.voluntary_switches;
+				const uint64_t involuntary = totals.involuntary_switches - last.involuntary_switches;
+				last = totals;
+
+				if (ticks == 0 || wall_ns == 0)
+				{
+					continue;
+				}
+
+				// CPU time can slightly exceed wall time through clock granularity, so clamp rather than report a negative share.
+				const float on_cpu_fraction = robotick::min(1.0f, (float)cpu_ns / (float)wall_ns);
+				const float off_cpu_fraction = 1.0f - on_cpu_fraction;
+				if (off_cpu_fraction > outputs.most_off_cpu_fraction)
+				{
+					outputs.most_off_cpu_fraction = off_cpu_fraction;
+					outputs.most_off_cpu_workload = stats.name.c_str();
+				}
+
+				ROBOTICK_INFO("[TimingDiagnostics]   %s: wall %.1f us, cpu %.1f us (%.0f%% on-cpu), switches/tick %.2f vol %.2f invol",
+					stats.name.c_str(),
+					(float)wall_ns / (float)ticks * ns_to_microseconds,
+					(float)cpu_ns / (float)ticks * ns_to_microseconds,
+					on_cpu_fraction * 100.0f,
+					(float)voluntary / (float)ticks,
+					(float)involuntary / (float)ticks);
+			}
+		}
 	};
 
 } // namespace robotick
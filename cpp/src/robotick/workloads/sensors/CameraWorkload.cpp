@@ -4,7 +4,11 @@
 #include "robotick/api.h"
 #include "robotick/framework/containers/FixedVector.h"
 #include "robotick/systems/Camera.h"
+#include "robotick/systems/FrameChangeDetector.h"
 #include "robotick/systems/Image.h"
+#include "robotick/systems/ImageFramePool.h"
+
+#include <cstring>
 
 namespace robotick
 {
@@ -16,6 +20,23 @@ namespace robotick
 	struct CameraConfig
 	{
 		int camera_index = 0;
+
+		// Optional shared frame pool (see ImageFramePoolRegistry): each frame is written once into a pool
+		// slot and published as jpeg_frame, so connections copy a handle instead of the JPEG bytes.
+		// Handle readers use ScopedImageFrame (or ImageFrameUnpackWorkload where bytes are needed). Empty = disabled.
+		FixedString32 frame_pool_name;
+		uint32_t frame_pool_slots = 8; // latest frame + frames readers still hold + one being written
+		// With a pool, jpeg_data is left empty by default so each frame is written once. Consumers still wired
+		// to jpeg_data should move to jpeg_frame; until they do, set this to keep copying the bytes there too.
+		// Without a pool jpeg_data is always filled.
+		bool publish_jpeg_data = false;
+
+		// Optional change gating (see FrameChangeDetector): frames whose luma differs from the last
+		// published frame by less than min_change_score (mean abs difference, 0..255) are neither encoded
+		// nor published. A frame is still published at least every keyframe_interval_sec (0 = never forced).
+		bool gate_unchanged_frames = false;
+		float min_change_score = 2.0f;
+		float keyframe_interval_sec = 5.0f;
 	};
 
 	struct CameraInputs
@@ -25,15 +46,24 @@ namespace robotick
 	struct CameraOutputs
 	{
 		ImageJpeg128k jpeg_data;
+		ImageHandle jpeg_frame;				  // frame in the shared pool (frame_pool_name set), else invalid
+		uint32_t dropped_frames = 0;		  // pooled frames skipped because readers held every slot
+		uint32_t frame_sequence = 0;		  // incremented for every published frame
+		float change_score = 0.0f;			  // last captured frame vs last published frame (gating only)
+		uint32_t skipped_unchanged_count = 0; // captured frames suppressed by gating
 	};
 
 	//------------------------------------------------------------------------------
-	// State (not currently needed, but here for expansion)
+	// State
 	//------------------------------------------------------------------------------
 
 	struct CameraState
 	{
 		Camera camera;
+		FrameChangeDetector change_detector;
+		double last_publish_time_sec = 0.0;
+
+		ImageFramePool* frame_pool = nullptr;
 	};
 
 	struct CameraWorkload
@@ -43,6 +73,8 @@ namespace robotick
 		CameraOutputs outputs;
 		State<CameraState> state;
 
+		~CameraWorkload() { ImageFramePoolRegistry::get().release(state->frame_pool); }
+
 		void load()
 		{
 			if (!state->camera.setup(config.camera_index))
@@ -50,18 +82,82 @@ namespace robotick
 				state->camera.print_available_cameras();
 				ROBOTICK_FATAL_EXIT("CameraWorkload failed to initialize camera index %i", config.camera_index);
 			}
+
+			if (!config.frame_pool_name.empty() && state->frame_pool == nullptr)
+			{
+				state->frame_pool =
+					ImageFramePoolRegistry::get().acquire(config.frame_pool_name.c_str(), config.frame_pool_slots, ImageJpeg128k::capacity());
+				if (state->frame_pool == nullptr)
+					ROBOTICK_WARNING("CameraWorkload - frame pool '%s' unavailable; publishing jpeg_data instead", config.frame_pool_name.c_str());
+			}
 		}
 
 		void tick(const TickInfo& tick_info)
 		{
-			(void)tick_info;
+			ImageFramePool* frame_pool = state->frame_pool;
+			uint8_t* dst_buffer = outputs.jpeg_data.data();
+			size_t dst_capacity = outputs.jpeg_data.capacity();
+			if (frame_pool != nullptr)
+			{
+				dst_buffer = frame_pool->begin_write();
+				dst_capacity = frame_pool->get_slot_capacity();
+				if (dst_buffer == nullptr)
+				{
+					// Every slot is still held by readers; keep publishing the previous frame.
+					outputs.dropped_frames++;
+					return;
+				}
+			}
 
 			size_t size_used = 0;
-			if (state->camera.read_frame(outputs.jpeg_data.data(), outputs.jpeg_data.capacity(), size_used))
+			if (!capture_frame(tick_info, dst_buffer, dst_capacity, size_used) || size_used == 0)
+			{
+				if (frame_pool != nullptr)
+					frame_pool->cancel_write();
+				return;
+			}
+
+			outputs.frame_sequence++;
+			state->last_publish_time_sec = tick_info.time_now;
+
+			if (frame_pool != nullptr)
+			{
+				// Dimensions stay 0: the JPEG header carries them and Camera does not report them separately.
+				outputs.jpeg_frame = frame_pool->publish(size_used, ImageFormat::Jpeg, 0, 0);
+
+				// A shared pool may have larger slots than jpeg_data holds; a truncated JPEG is no use to anyone.
+				const bool copy_bytes = config.publish_jpeg_data && size_used <= outputs.jpeg_data.capacity();
+				if (copy_bytes)
+					::memcpy(outputs.jpeg_data.data(), dst_buffer, size_used);
+				outputs.jpeg_data.set_size(copy_bytes ? size_used : 0);
+			}
+			else
 			{
 				outputs.jpeg_data.set_size(size_used);
 			}
 		}
+
+		// Capture and (unless gated out) encode into dst_buffer. size_used is 0 for a suppressed frame.
+		bool capture_frame(const TickInfo& tick_info, uint8_t* dst_buffer, const size_t dst_capacity, size_t& size_used)
+		{
+			if (!config.gate_unchanged_frames)
+				return state->camera.read_frame(dst_buffer, dst_capacity, size_used);
+
+			const bool keyframe_due = config.keyframe_interval_sec > 0.0f && outputs.frame_sequence > 0 &&
+									  tick_info.time_now - state->last_publish_time_sec >= static_cast<double>(config.keyframe_interval_sec);
+
+			float change_score = 0.0f;
+			if (!state->camera.read_frame_if_changed(
+					dst_buffer, dst_capacity, state->change_detector, config.min_change_score, keyframe_due, size_used, change_score))
+			{
+				return false;
+			}
+
+			outputs.change_score = change_score;
+			if (size_used == 0)
+				outputs.skipped_unchanged_count++;
+			return true;
+		}
 	};
 
 } // namespace robotick
@@ -0,0 +1,66 @@
+// Copyright Robotick contributors
+// SPDX-License-Identifier: Apache-2.0
+
+#include "robotick/api.h"
+#include "robotick/systems/Image.h"
+#include "robotick/systems/ImageFramePool.h"
+
+#include <cstring>
+
+namespace robotick
+{
+	//------------------------------------------------------------------------------
+	// Config / Inputs / Outputs
+	//------------------------------------------------------------------------------
+
+	struct ImageFrameUnpackInputs
+	{
+		ImageHandle frame; // e.g. CameraWorkload.outputs.jpeg_frame
+	};
+
+	struct ImageFrameUnpackOutputs
+	{
+		ImageJpeg128k jpeg_data;
+		uint32_t frame_sequence = 0; // incremented for every new frame copied out
+		uint32_t missed_frames = 0;	 // handles that could not be read (frame recycled, pool gone, or too large)
+	};
+
+	//------------------------------------------------------------------------------
+	// Workload
+	//------------------------------------------------------------------------------
+
+	// Reads a pooled frame by handle and copies its bytes out, for the one branch of a camera fan-out that needs
+	// them (MQTT, recording, a remote UI). In-process readers should hold the handle with ScopedImageFrame instead.
+	struct ImageFrameUnpackWorkload
+	{
+		ImageFrameUnpackInputs inputs;
+		ImageFrameUnpackOutputs outputs;
+
+		ImageHandle last_unpacked;
+
+		void tick(const TickInfo&)
+		{
+			const ImageHandle& handle = inputs.frame;
+			if (!handle.is_valid())
+				return;
+
+			// The producer keeps publishing the same handle until it has a new frame.
+			if (handle.pool_id == last_unpacked.pool_id && handle.slot == last_unpacked.slot && handle.generation == last_unpacked.generation)
+				return;
+
+			last_unpacked = handle;
+
+			ScopedImageFrame frame(handle);
+			if (!frame.is_valid() || frame.size() > outputs.jpeg_data.capacity())
+			{
+				outputs.missed_frames++;
+				return;
+			}
+
+			::memcpy(outputs.jpeg_data.data(), frame.data(), frame.size());
+			outputs.jpeg_data.set_size(frame.size());
+			outputs.frame_sequence++;
+		}
+	};
+
+} // namespace robotick
@@ -0,0 +1,104 @@
+// Copyright Robotick contributors
+// SPDX-License-Identifier: Apache-2.0
+
+#include "robotick/api.h"
+#include "robotick/framework/containers/FixedVector.h"
+#include "robotick/systems/Image.h"
+#include "robotick/systems/MultiCamera.h"
+
+namespace robotick
+{
+	using MultiCameraIndices = FixedVector<int, MultiCamera::kMaxCameras>;
+	using MultiCameraTimestamps = FixedVector<double, MultiCamera::kMaxCameras>;
+
+	ROBOTICK_REGISTER_FIXED_VECTOR(MultiCameraIndices, int);
+	ROBOTICK_REGISTER_FIXED_VECTOR(MultiCameraTimestamps, double);
+
+	//------------------------------------------------------------------------------
+	// Config / Inputs / Outputs
+	//------------------------------------------------------------------------------
+
+	struct MultiCameraConfig
+	{
+		// Device indices, in output order (jpeg_data1 = first entry). e.g. [0, 1] for a stereo pair.
+		MultiCameraIndices camera_indices;
+	};
+
+	struct MultiCameraInputs
+	{
+	};
+
+	struct MultiCameraOutputs
+	{
+		// jpeg_dataN holds camera N-1 of the set; unused cameras stay empty. All are from the same set.
+		ImageJpeg128k jpeg_data1;
+		ImageJpeg128k jpeg_data2;
+		ImageJpeg128k jpeg_data3;
+		ImageJpeg128k jpeg_data4;
+
+		MultiCameraTimestamps capture_time_sec;	// per-camera grab time: seconds on the steady clock since start()
+		float skew_ms = 0.0f;					// spread between earliest and latest grab in the set
+		float max_skew_ms = 0.0f;				// worst skew seen since load
+		uint32_t frame_sequence = 0;			// incremented for every complete set published
+		uint32_t failed_captures = 0;			// sets dropped because a camera failed to grab, decode or encode
+	};
+
+	//------------------------------------------------------------------------------
+	// State
+	//------------------------------------------------------------------------------
+
+	struct MultiCameraState
+	{
+		MultiCamera cameras;
+	};
+
+	struct MultiCameraWorkload
+	{
+		MultiCameraConfig config;
+		MultiCameraInputs inputs;
+		MultiCameraOutputs outputs;
+		State<MultiCameraState> state;
+
+		void load()
+		{
+			const uint32_t camera_count = static_cast<uint32_t>(config.camera_indices.size());
+			if (camera_count == 0)
+				ROBOTICK_FATAL_EXIT("MultiCameraWorkload requires at least one entry in camera_indices");
+
+			if (!state->cameras.setup(config.camera_indices.data(), camera_count))
+			{
+				state->cameras.print_available_cameras();
+				ROBOTICK_FATAL_EXIT("MultiCameraWorkload failed to initialize %u camera(s)", static_cast<unsigned>(camera_count));
+			}
+		}
+
+		// capture_time_sec counts from here: run time, like tick_info.time_now, but read at each grab itself.
+		void start(float) { state->cameras.reset_clock(); }
+
+		void tick(const TickInfo&)
+		{
+			MultiCamera& cameras = state->cameras;
+			ImageJpeg128k* const jpeg_outputs[MultiCamera::kMaxCameras] = {
+				&outputs.jpeg_data1, &outputs.jpeg_data2, &outputs.jpeg_data3, &outputs.jpeg_data4};
+
+			// Encode in turn through the shared buffer; a set is only published whole.
+			if (!capture_jpeg_set(cameras, jpeg_outputs))
+			{
+				outputs.failed_captures++;
+				return;
+			}
+
+			const uint32_t camera_count = cameras.get_camera_count();
+			outputs.capture_time_sec.set_size(camera_count);
+			for (uint32_t i = 0; i < camera_count; ++i)
+			{
+				outputs.capture_time_sec[i] = static_cast<double>(cameras.get_grab_time_ns(i)) * 1e-9;
+			}
+
+			outputs.skew_ms = static_cast<float>(static_cast<double>(cameras.get_skew_ns()) * 1e-6);
+			outputs.max_skew_ms = robotick::max(outputs.max_skew_ms, outputs.skew_ms);
+			outputs.frame_sequence++;
+		}
+	};
+
+} // namespace robotick
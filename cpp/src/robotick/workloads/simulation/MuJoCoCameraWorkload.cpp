@@ -9,6 +9,7 @@
 #include "robotick/framework/memory/StdApproved.h"
 #include "robotick/framework/strings/FixedString.h"
 #include "robotick/systems/Image.h"
+#include "robotick/systems/ImageFramePool.h"
 #include "robotick/systems/MuJoCoRenderContext.h"
 #include "robotick/systems/MuJoCoSceneRegistry.h"
 
@@ -16,15 +17,43 @@
 #include <opencv2/imgcodecs.hpp>
 #include <opencv2/imgproc.hpp>
 
+#include <cstring>
+
 namespace robotick
 {
-	// Stub workload: render a single MuJoCo camera (implementation later).
+	// Render a single MuJoCo camera to PNG, optionally with raw depth and segmentation from the same scene update.
+
+	enum class MuJoCoCameraDepthFormat : uint8_t
+	{
+		None = 0,
+		LinearMetresF32,
+		MillimetresU16
+	};
+
+	ROBOTICK_REGISTER_ENUM_BEGIN(MuJoCoCameraDepthFormat)
+	ROBOTICK_ENUM_VALUE("None", MuJoCoCameraDepthFormat::None)
+	ROBOTICK_ENUM_VALUE("LinearMetresF32", MuJoCoCameraDepthFormat::LinearMetresF32)
+	ROBOTICK_ENUM_VALUE("MillimetresU16", MuJoCoCameraDepthFormat::MillimetresU16)
+	ROBOTICK_REGISTER_ENUM_END(MuJoCoCameraDepthFormat)
 
 	struct MuJoCoCameraConfig
 	{
 		FixedString64 camera_name;
 		uint32_t texture_width = 640;
 		uint32_t texture_height = 480;
+
+		// Opt-in raw outputs. Each stream is written into its own named ImageFramePool (a pool has a single writer
+		// and one latest frame) and only handles are published, so a camera without them carries no pixel buffers.
+		MuJoCoCameraDepthFormat depth_format = MuJoCoCameraDepthFormat::None;
+		FixedString32 depth_frame_pool_name;
+		bool output_segmentation = false;
+		FixedString32 segmentation_frame_pool_name;
+		uint32_t raw_frame_pool_slots = 4; // per pool: latest frame + frames readers still hold + one being written
+
+		// Render at most this often, independent of the tick rate (0 = every tick).
+		float render_rate_hz = 0.0f;
+		// Reuse the previous frame while the physics scene has not changed since it was rendered.
+		bool skip_unchanged_scene = true;
 	};
 
 	struct MuJoCoCameraInputs
@@ -35,7 +64,16 @@ namespace robotick
 	struct MuJoCoCameraOutputs
 	{
 		ImagePng256k png_data;
-		uint32_t frame_count = 0;
+		uint32_t frame_count = 0;			  // distinct frames produced; unchanged while a frame is reused
+		float frame_age_sec = 0.0f;			  // tick time since png_data (and the raw frames) were rendered
+		double frame_sim_time_sec = 0.0;	  // simulation time of the rendered snapshot
+		uint32_t skipped_unchanged_count = 0; // renders skipped because the scene had not changed
+
+		// Raw frames (see depth_format / output_segmentation) share the PNG frame's size but keep GL row order
+		// (bottom row first). Invalid when disabled or no pool slot was free.
+		ImageHandle depth_frame;		 // ImageFormat::DepthMetresF32 or DepthMillimetresU16
+		ImageHandle segmentation_frame;	 // ImageFormat::SegmentationU16: geom id + 1 per pixel, 0 = background
+		uint32_t dropped_raw_frames = 0; // raw frames skipped because readers held every pool slot
 	};
 
 	struct MuJoCoCameraState
@@ -62,6 +100,20 @@ namespace robotick
 		uint32_t rgb_width = 0;
 		uint32_t rgb_height = 0;
 
+		// Render-side depth / segmentation targets and the pool their frames are published through,
+		// allocated once and only when enabled in config.
+		HeapVector<float> depth_data;
+		HeapVector<int32_t> segmentation_data;
+		ImageFramePool* depth_frame_pool = nullptr;
+		ImageFramePool* segmentation_frame_pool = nullptr;
+		bool raw_outputs_disabled = false;
+
+		// Render scheduling: the current outputs hold a frame of last_rendered_revision, rendered at last_render_time_sec.
+		bool has_frame = false;
+		uint64_t last_rendered_revision = 0;
+		double last_render_time_sec = 0.0;
+		double next_render_time_sec = 0.0;
+
 		// Scratch buffer for PNG encoding; reserve once to avoid per-tick allocation.
 		std_approved::vector<uint8_t> png_scratch;
 	};
@@ -73,6 +125,12 @@ namespace robotick
 		MuJoCoCameraOutputs outputs;
 		State<MuJoCoCameraState> state;
 
+		~MuJoCoCameraWorkload()
+		{
+			ImageFramePoolRegistry::get().release(state->depth_frame_pool);
+			ImageFramePoolRegistry::get().release(state->segmentation_frame_pool);
+		}
+
 		static bool encode_png_from_rgb(
 			const uint8_t* rgb, size_t rgb_size, int width, int height, ImagePng256k& out_png, std_approved::vector<uint8_t>& scratch)
 		{
@@ -99,7 +157,146 @@ namespace robotick
 			return true;
 		}
 
-		void tick(const TickInfo&)
+		static void copy_depth_to_millimetres(const float* depth_m, size_t pixel_count, uint16_t* out_mm)
+		{
+			for (size_t i = 0; i < pixel_count; ++i)
+			{
+				const float mm = depth_m[i] * 1000.0f + 0.5f;
+				out_mm[i] = mm <= 0.0f ? 0 : (mm >= 65535.0f ? 65535 : static_cast<uint16_t>(mm));
+			}
+		}
+
+		static void copy_segmentation_ids(const int32_t* geom_ids, size_t pixel_count, uint16_t* out_ids)
+		{
+			for (size_t i = 0; i < pixel_count; ++i)
+			{
+				const int32_t id = geom_ids[i] + 1;
+				out_ids[i] = id <= 0 ? 0 : (id >= 65535 ? 65535 : static_cast<uint16_t>(id));
+			}
+		}
+
+		ImageFramePool* acquire_raw_frame_pool(const FixedString32& pool_name, size_t slot_capacity_bytes)
+		{
+			if (pool_name.empty())
+			{
+				ROBOTICK_WARNING("MuJoCoCameraWorkload: depth/segmentation output needs a frame pool name; raw outputs disabled.");
+				return nullptr;
+			}
+
+			ImageFramePool* pool = ImageFramePoolRegistry::get().acquire(pool_name.c_str(), config.raw_frame_pool_slots, slot_capacity_bytes);
+			if (pool == nullptr)
+				ROBOTICK_WARNING("MuJoCoCameraWorkload: frame pool '%s' unavailable; raw outputs disabled.", pool_name.c_str());
+			return pool;
+		}
+
+		// Size the depth / segmentation targets and join their frame pools once; returns false (raw outputs off)
+		// if they are not enabled or cannot be set up.
+		bool ensure_raw_buffers()
+		{
+			const bool want_depth = config.depth_format != MuJoCoCameraDepthFormat::None;
+			if ((!want_depth && !config.output_segmentation) || state->raw_outputs_disabled)
+				return false;
+
+			const size_t pixel_count = static_cast<size_t>(config.texture_width * config.texture_height);
+			if (want_depth && state->depth_frame_pool == nullptr)
+			{
+				state->depth_frame_pool = acquire_raw_frame_pool(config.depth_frame_pool_name, pixel_count * sizeof(float));
+				state->raw_outputs_disabled = state->raw_outputs_disabled || state->depth_frame_pool == nullptr;
+			}
+			if (config.output_segmentation && state->segmentation_frame_pool == nullptr)
+			{
+				state->segmentation_frame_pool = acquire_raw_frame_pool(config.segmentation_frame_pool_name, pixel_count * sizeof(uint16_t));
+				state->raw_outputs_disabled = state->raw_outputs_disabled || state->segmentation_frame_pool == nullptr;
+			}
+			if (state->raw_outputs_disabled)
+				return false;
+
+			if (want_depth && state->depth_data.size() == 0)
+				state->depth_data.initialize(pixel_count);
+			if (config.output_segmentation && state->segmentation_data.size() == 0)
+				state->segmentation_data.initialize(pixel_count);
+			return true;
+		}
+
+		// Copy one raw image into a fresh slot of its pool (converted as needed) and return its handle.
+		ImageHandle publish_raw_frame(ImageFramePool& pool, ImageFormat format, uint32_t width, uint32_t height)
+		{
+			uint8_t* slot = pool.begin_write();
+			if (slot == nullptr)
+			{
+				outputs.dropped_raw_frames++;
+				return ImageHandle{};
+			}
+
+			// Slots start at multiples of their capacity (2 or 4 bytes per pixel), so they are suitably aligned.
+			const size_t pixel_count = static_cast<size_t>(width * height);
+			size_t size_bytes = 0;
+			switch (format)
+			{
+			case ImageFormat::DepthMetresF32:
+				size_bytes = pixel_count * sizeof(float);
+				::memcpy(slot, state->depth_data.data(), size_bytes);
+				break;
+			case ImageFormat::DepthMillimetresU16:
+				size_bytes = pixel_count * sizeof(uint16_t);
+				copy_depth_to_millimetres(state->depth_data.data(), pixel_count, reinterpret_cast<uint16_t*>(slot));
+				break;
+			default:
+				size_bytes = pixel_count * sizeof(uint16_t);
+				copy_segmentation_ids(state->segmentation_data.data(), pixel_count, reinterpret_cast<uint16_t*>(slot));
+				break;
+			}
+
+			return pool.publish(size_bytes, format, static_cast<uint16_t>(width), static_cast<uint16_t>(height));
+		}
+
+		void publish_raw_outputs(uint32_t width, uint32_t height)
+		{
+			if (config.depth_format == MuJoCoCameraDepthFormat::LinearMetresF32)
+				outputs.depth_frame = publish_raw_frame(*state->depth_frame_pool, ImageFormat::DepthMetresF32, width, height);
+			else if (config.depth_format == MuJoCoCameraDepthFormat::MillimetresU16)
+				outputs.depth_frame = publish_raw_frame(*state->depth_frame_pool, ImageFormat::DepthMillimetresU16, width, height);
+
+			if (config.output_segmentation)
+				outputs.segmentation_frame = publish_raw_frame(*state->segmentation_frame_pool, ImageFormat::SegmentationU16, width, height);
+		}
+
+		void clear_raw_outputs()
+		{
+			outputs.depth_frame = ImageHandle{};
+			outputs.segmentation_frame = ImageHandle{};
+		}
+
+		// True when render_rate_hz says this tick should produce a frame. Ticks land on a grid, so a render is due
+		// once we are within half a tick of the schedule; that keeps the average rate on target.
+		bool is_render_due(const TickInfo& tick_info) const
+		{
+			if (config.render_rate_hz <= 0.0f || !state->has_frame)
+				return true;
+			return tick_info.time_now + 0.5 * static_cast<double>(tick_info.delta_time) >= state->next_render_time_sec;
+		}
+
+		void on_frame_rendered(const TickInfo& tick_info, uint64_t revision, double sim_time)
+		{
+			state->has_frame = true;
+			state->last_rendered_revision = revision;
+			state->last_render_time_sec = tick_info.time_now;
+
+			if (config.render_rate_hz > 0.0f)
+			{
+				const double period = 1.0 / static_cast<double>(config.render_rate_hz);
+				// Advance on the fixed schedule; resync if we fell more than a period behind (e.g. unchanged-scene skips).
+				if (tick_info.time_now - state->next_render_time_sec > period)
+					state->next_render_time_sec = tick_info.time_now;
+				state->next_render_time_sec += period;
+			}
+
+			outputs.frame_count++;
+			outputs.frame_age_sec = 0.0f;
+			outputs.frame_sim_time_sec = sim_time;
+		}
+
+		void tick(const TickInfo& tick_info)
 		{
 
 			ROBOTICK_ASSERT(config.texture_width > 0);
@@ -112,6 +309,12 @@ namespace robotick
 				return;
 			}
 
+			if (state->has_frame)
+				outputs.frame_age_sec = static_cast<float>(tick_info.time_now - state->last_render_time_sec);
+
+			if (!is_render_due(tick_info))
+				return;
+
 			const mjModel* model = MuJoCoSceneRegistry::get().get_model(inputs.mujoco_scene_id);
 			if (!model)
 			{
@@ -147,10 +350,21 @@ namespace robotick
 				return;
 			}
 
+			uint64_t scene_revision = 0;
+			if (config.skip_unchanged_scene && state->has_frame &&
+				MuJoCoSceneRegistry::get().get_state_revision(inputs.mujoco_scene_id, scene_revision) &&
+				scene_revision == state->last_rendered_revision)
+			{
+				// Nothing has moved since the last frame; keep publishing it rather than rendering a duplicate.
+				outputs.skipped_unchanged_count++;
+				return;
+			}
+
 			const mjModel* snapshot_model = nullptr;
 			double snapshot_time = 0.0;
 			// Copy the live sim state into our pre-allocated buffer.
-			if (!MuJoCoSceneRegistry::get().copy_render_snapshot(inputs.mujoco_scene_id, state->render_data, snapshot_model, snapshot_time))
+			if (!MuJoCoSceneRegistry::get().copy_render_snapshot(
+					inputs.mujoco_scene_id, state->render_data, snapshot_model, snapshot_time, &scene_revision))
 			{
 				ROBOTICK_WARNING("MuJoCoCameraWorkload: copy_render_snapshot failed; disabling render.");
 				state->render_disabled = true;
@@ -195,30 +409,43 @@ namespace robotick
 					return;
 				}
 
+				const bool want_raw = ensure_raw_buffers();
+
+				MuJoCoRenderTargets targets;
+				targets.rgb = state->rgb_data.data();
+				targets.rgb_capacity = state->rgb_data.size();
+				if (want_raw && state->depth_data.size() > 0)
+				{
+					targets.depth = state->depth_data.data();
+					targets.depth_capacity = state->depth_data.size();
+				}
+				if (want_raw && state->segmentation_data.size() > 0)
+				{
+					targets.segmentation = state->segmentation_data.data();
+					targets.segmentation_capacity = state->segmentation_data.size();
+				}
+
 				int rgb_width = 0;
 				int rgb_height = 0;
-				size_t rgb_size = 0;
-				if (!state->render_context.render_to_rgb(snapshot_model,
-						state->render_data,
-						config.camera_name.c_str(),
-						state->rgb_data.data(),
-						state->rgb_data.size(),
-						rgb_size,
-						rgb_width,
-						rgb_height,
-						false))
+				if (!state->render_context.render_frame(snapshot_model, state->render_data, config.camera_name.c_str(), targets, rgb_width, rgb_height))
 				{
 					state->rgb_size = 0;
 					state->rgb_width = 0;
 					state->rgb_height = 0;
 					outputs.png_data.set_size(0);
-					ROBOTICK_WARNING("MuJoCoCameraWorkload: render_to_rgb failed; output cleared.");
+					clear_raw_outputs();
+					state->has_frame = false;
+					ROBOTICK_WARNING("MuJoCoCameraWorkload: render_frame failed; output cleared.");
 					return;
 				}
 
+				const size_t rgb_size = static_cast<size_t>(rgb_width * rgb_height * 3);
 				state->rgb_size = rgb_size;
 				state->rgb_width = static_cast<uint32_t>(rgb_width);
 				state->rgb_height = static_cast<uint32_t>(rgb_height);
+
+				if (want_raw)
+					publish_raw_outputs(state->rgb_width, state->rgb_height);
 			}
 
 			if (!encode_png_from_rgb(state->rgb_data.data(),
@@ -229,11 +456,12 @@ namespace robotick
 					state->png_scratch))
 			{
 				outputs.png_data.set_size(0);
+				state->has_frame = false;
 				ROBOTICK_WARNING("MuJoCoCameraWorkload: PNG encode failed; output cleared.");
 				return;
 			}
 
-			outputs.frame_count++;
+			on_frame_rendered(tick_info, scene_revision, snapshot_time);
 		}
 
 		void stop()
@@ -241,6 +469,8 @@ namespace robotick
 			state->render_context.shutdown();
 			state->render_context_ready = false;
 			state->render_disabled = false;
+			state->has_frame = false;
+			state->next_render_time_sec = 0.0;
 			if (state->render_data)
 			{
 				mj_deleteData(state->render_data);
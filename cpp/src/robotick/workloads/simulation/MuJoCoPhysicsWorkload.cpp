@@ -6,6 +6,8 @@
 #include "robotick/api.h"
 #include "robotick/framework/data/Blackboard.h"
 #include "robotick/framework/utility/Algorithm.h"
+#include "robotick/systems/AdaptiveSubStepper.h"
+#include "robotick/systems/MuJoCoModelCache.h"
 #include "robotick/systems/MuJoCoPhysics.h"
 #include "robotick/systems/MuJoCoSceneRegistry.h"
 
@@ -25,6 +27,23 @@ namespace robotick
 
 		float sim_tick_rate_hz = -1.0f;
 
+		// Adaptive sub-stepping (see AdaptiveSubStepper): each tick owes sim_num_sub_ticks * timestep of sim
+		// time; steps are taken until that debt is repaid, max_sub_steps_per_tick is reached or (unless
+		// deterministic_catch_up) max_tick_budget_fraction of the tick interval has been spent. Unpaid debt
+		// carries over, up to max_sim_debt_sec. Also settable in the workload YAML's mujoco map.
+		bool adaptive_sub_stepping = false;
+		uint32_t max_sub_steps_per_tick = 0; // 0 = 4x the nominal sub-step count
+		float max_tick_budget_fraction = 0.8f;
+		float max_sim_debt_sec = 0.25f;
+		bool deterministic_catch_up = false; // true = ignore wall time, only the step cap limits catch-up
+
+		// Reuse a compiled .mjb when the model and its assets are unchanged (see MuJoCoModelCache).
+		bool use_model_cache = true;
+		FixedString256 model_cache_dir; // empty = next to the model XML
+
+		// Share one mjModel with other instances loading the same unchanged model (see MuJoCoModelStore).
+		bool share_model = true;
+
 		Blackboard mj_initial;
 		// ^- config/initial-conditions snapshot read from sim at setup
 	};
@@ -40,6 +59,11 @@ namespace robotick
 		Blackboard mujoco;
 		// ^- values read from sim each tick
 		uint32_t scene_id = 0;
+
+		float realtime_factor = 0.0f;	   // sim seconds per wall second, smoothed over ~1s
+		uint32_t sub_steps_taken = 0;	   // mj_step calls this tick
+		float sim_time_debt_sec = 0.0f;	   // sim time still owed (adaptive mode)
+		float sim_time_dropped_sec = 0.0f; // total sim time given up beyond max_sim_debt_sec
 	};
 
 	// ---------- Binding model ----------
@@ -90,6 +114,7 @@ namespace robotick
 		uint32_t scene_id = 0;
 
 		uint32_t sim_num_sub_ticks = 1;
+		AdaptiveSubStepper sub_stepper;
 
 		HeapVector<MuJoCoBinding> config_bindings;
 		HeapVector<MuJoCoBinding> input_bindings;
@@ -304,6 +329,20 @@ namespace robotick
 			ROBOTICK_ASSERT_MSG(!config.model_path.empty(), "mujoco.model_path is required.");
 
 			config.sim_tick_rate_hz = mujoco["sim_tick_rate_hz"].as<float>(-1.0f);
+			config.use_model_cache = mujoco["use_model_cache"].as<bool>(config.use_model_cache);
+			config.share_model = mujoco["share_model"].as<bool>(config.share_model);
+
+			config.adaptive_sub_stepping = mujoco["adaptive_sub_stepping"].as<bool>(config.adaptive_sub_stepping);
+			config.max_sub_steps_per_tick = mujoco["max_sub_steps_per_tick"].as<uint32_t>(config.max_sub_steps_per_tick);
+			config.max_tick_budget_fraction = mujoco["max_tick_budget_fraction"].as<float>(config.max_tick_budget_fraction);
+			config.max_sim_debt_sec = mujoco["max_sim_debt_sec"].as<float>(config.max_sim_debt_sec);
+			config.deterministic_catch_up = mujoco["deterministic_catch_up"].as<bool>(config.deterministic_catch_up);
+
+			const YAML::Node model_cache_dir_node = mujoco["model_cache_dir"];
+			if (model_cache_dir_node && model_cache_dir_node.IsScalar())
+			{
+				config.model_cache_dir = model_cache_dir_node.Scalar().c_str();
+			}
 
 			// Build binding lists and field descriptors
 			configure_io_fields(mujoco["config"], state->config_bindings, state->config_fields);
@@ -353,7 +392,17 @@ namespace robotick
 
 		void load_model()
 		{
-			if (!state->physics.load_from_xml(config.model_path.c_str()))
+			MuJoCoModelCacheOptions cache_options;
+			cache_options.cache_dir = config.model_cache_dir.c_str();
+
+			bool loaded = false;
+			if (config.share_model)
+				loaded = state->physics.load_shared_from_xml(config.model_path.c_str(), config.use_model_cache ? &cache_options : nullptr);
+			else if (config.use_model_cache)
+				loaded = state->physics.load_from_xml(config.model_path.c_str(), cache_options);
+			else
+				loaded = state->physics.load_from_xml(config.model_path.c_str());
+			if (!loaded)
 			{
 				ROBOTICK_FATAL_EXIT("MuJoCoPhysics failed to load model: %s", config.model_path.c_str());
 			}
@@ -557,12 +606,15 @@ namespace robotick
 		void setup()
 		{
 			auto physics_lock = state->physics.lock();
-			mjModel* physics_model = state->physics.model_mutable();
+			const mjModel* physics_model = state->physics.model();
 			mjData* physics_data = state->physics.data_mutable();
 
 			// Optionally run forward to make derived quantities valid
 			if (physics_model && physics_data)
+			{
 				mj_forward(physics_model, physics_data);
+				state->physics.mark_state_changed();
+			}
 
 			// hard-reset all controls this tick
 			if (physics_model && physics_data && physics_model->nu > 0)
@@ -588,15 +640,24 @@ namespace robotick
 			const float final_sim_rate = tick_rate_hz * static_cast<float>(state->sim_num_sub_ticks);
 			const double dt = 1.0 / static_cast<double>(final_sim_rate);
 			auto physics_lock = state->physics.lock();
-			mjModel* model = state->physics.model_mutable();
-			if (model)
-				model->opt.timestep = dt;
+			state->physics.set_timestep(dt);
+
+			AdaptiveSubStepperConfig sub_stepper_config;
+			sub_stepper_config.timestep_sec = dt;
+			sub_stepper_config.max_steps_per_tick =
+				(config.max_sub_steps_per_tick > 0) ? config.max_sub_steps_per_tick : 4 * state->sim_num_sub_ticks;
+			sub_stepper_config.tick_budget_ns = static_cast<uint64_t>(static_cast<double>(config.max_tick_budget_fraction) * 1e9 / tick_rate_hz);
+			sub_stepper_config.max_debt_sec = static_cast<double>(config.max_sim_debt_sec);
+			sub_stepper_config.deterministic = config.deterministic_catch_up;
+			state->sub_stepper.configure(sub_stepper_config);
+
+			outputs.realtime_factor = 0.0f;
+			outputs.sim_time_debt_sec = 0.0f;
+			outputs.sim_time_dropped_sec = 0.0f;
 		}
 
 		void tick(const TickInfo& tick_info)
 		{
-			(void)tick_info;
-
 			auto physics_lock = state->physics.lock();
 			const mjModel* model = state->physics.model();
 			mjData* mujoco_data = state->physics.data_mutable();
@@ -616,10 +677,24 @@ namespace robotick
 			}
 
 			// Advance physics
-			for (uint32_t i = 0; i < state->sim_num_sub_ticks; ++i)
+			const double sim_time_before = mujoco_data->time;
+			if (config.adaptive_sub_stepping)
 			{
-				mj_step(model, mujoco_data);
+				outputs.sub_steps_taken = step_adaptive(model, mujoco_data);
 			}
+			else
+			{
+				for (uint32_t i = 0; i < state->sim_num_sub_ticks; ++i)
+				{
+					mj_step(model, mujoco_data);
+				}
+				outputs.sub_steps_taken = state->sim_num_sub_ticks;
+			}
+			update_realtime_factor(mujoco_data->time - sim_time_before, tick_info.delta_time);
+
+			// Cameras skip re-rendering while the revision is unchanged.
+			if (outputs.sub_steps_taken > 0 || wrote_joint_qpos_target)
+				state->physics.mark_state_changed();
 
 			// Read outputs from sim
 			for (const auto& b : state->output_bindings)
@@ -627,6 +702,36 @@ namespace robotick
 				assign_blackboard_from_mujoco(b, outputs.mujoco);
 			}
 		}
+
+		uint32_t step_adaptive(const mjModel* model, mjData* mujoco_data)
+		{
+			AdaptiveSubStepper& sub_stepper = state->sub_stepper;
+			const uint32_t steps = sub_stepper.tick(state->sim_num_sub_ticks,
+				[model, mujoco_data]()
+				{
+					mj_step(model, mujoco_data);
+				});
+
+			outputs.sim_time_debt_sec = static_cast<float>(sub_stepper.get_debt_sec());
+			outputs.sim_time_dropped_sec = static_cast<float>(sub_stepper.get_dropped_sec());
+			return steps;
+		}
+
+		void update_realtime_factor(double sim_seconds_advanced, float wall_seconds_elapsed)
+		{
+			if (wall_seconds_elapsed <= 0.0f)
+				return;
+
+			const float instant_factor = static_cast<float>(sim_seconds_advanced) / wall_seconds_elapsed;
+			if (outputs.realtime_factor <= 0.0f)
+			{
+				outputs.realtime_factor = instant_factor;
+				return;
+			}
+
+			const float alpha = robotick::min(1.0f, wall_seconds_elapsed);
+			outputs.realtime_factor += alpha * (instant_factor - outputs.realtime_factor);
+		}
 	};
 
 } // namespace robotick
@@ -26,6 +26,11 @@ namespace robotick
 		bool enable_tls = false;
 		uint8_t publish_qos = 1;
 		uint8_t subscribe_qos = 1;
+
+		// Store-and-forward for link outages (see MqttClient::set_store_and_forward): the latest value of up to
+		// this many topics is held while disconnected and drained on reconnect. 0 = disabled (values are dropped).
+		uint16_t store_and_forward_topics = 0;
+		uint16_t store_and_forward_drain_per_tick = 16; // messages sent per tick while draining
 	};
 
 	//----------------------------------------------------------------------
@@ -86,6 +91,7 @@ namespace robotick
 			auto mqtt_client = std_approved::make_unique<MqttClient>(broker.c_str(), client_id.c_str());
 			mqtt_client->set_tls_enabled(config.enable_tls);
 			mqtt_client->set_qos(config.publish_qos, config.subscribe_qos);
+			mqtt_client->set_store_and_forward(config.store_and_forward_topics, config.store_and_forward_drain_per_tick);
 			if (!mqtt_client->connect())
 			{
 				ROBOTICK_WARNING("MqttClientWorkload - initial MQTT connect failed (proceeding, will retry on tick).");
@@ -0,0 +1,208 @@
+// Copyright Robotick contributors
+// SPDX-License-Identifier: Apache-2.0
+
+#if defined(ROBOTICK_PLATFORM_DESKTOP) || defined(ROBOTICK_PLATFORM_LINUX)
+
+#include "robotick/api.h"
+#include "robotick/framework/Engine.h"
+#include "robotick/framework/data/WorkloadsBuffer.h"
+#include "robotick/framework/memory/StdApproved.h"
+#include "robotick/framework/strings/FixedString.h"
+#include "robotick/framework/utils/WorkloadFieldsIterator.h"
+#include "robotick/systems/SharedTelemetryWriter.h"
+
+#include <cstring>
+
+namespace robotick
+{
+	//----------------------------------------------------------------------
+	// Config, Inputs, Outputs
+	//----------------------------------------------------------------------
+
+	struct SharedTelemetryConfig
+	{
+		// POSIX shm name; readers open /dev/shm/<name> (see SharedTelemetryFormat.h and robotick.telemetry).
+		FixedString64 segment_name = "/robotick_telemetry";
+		FixedString256 workloads;		 // comma-separated workload names to export; empty = all
+		bool include_config = false;	 // config rarely changes - inputs and outputs are always exported
+		uint32_t max_field_size = 4096; // larger fields (images, audio buffers) are left out
+	};
+
+	struct SharedTelemetryOutputs
+	{
+		uint32_t field_count = 0;
+		uint32_t snapshot_bytes = 0;
+		uint32_t copy_runs = 0; // memcpy calls per publish
+		bool active = false;
+	};
+
+	//----------------------------------------------------------------------
+	// Internal State
+	//----------------------------------------------------------------------
+
+	struct SharedTelemetryState
+	{
+		const Engine* engine = nullptr;
+		SharedTelemetryWriter writer;
+	};
+
+	namespace
+	{
+		bool is_listed(const char* list, const char* name)
+		{
+			const size_t name_len = ::strlen(name);
+			const char* cursor = list;
+			while (*cursor)
+			{
+				while (*cursor == ' ' || *cursor == ',')
+					++cursor;
+				const char* end = cursor;
+				while (*end && *end != ',' && *end != ' ')
+					++end;
+				if (static_cast<size_t>(end - cursor) == name_len && ::strncmp(cursor, name, name_len) == 0)
+					return true;
+				cursor = end;
+			}
+			return false;
+		}
+
+		RobotickSharedTelemetryKind kind_for_type(const TypeId& type)
+		{
+			if (type == GET_TYPE_ID(int))
+				return ROBOTICK_SHARED_TELEMETRY_INT32;
+			if (type == GET_TYPE_ID(uint8_t))
+				return ROBOTICK_SHARED_TELEMETRY_UINT8;
+			if (type == GET_TYPE_ID(uint16_t))
+				return ROBOTICK_SHARED_TELEMETRY_UINT16;
+			if (type == GET_TYPE_ID(uint32_t))
+				return ROBOTICK_SHARED_TELEMETRY_UINT32;
+			if (type == GET_TYPE_ID(float))
+				return ROBOTICK_SHARED_TELEMETRY_FLOAT32;
+			if (type == GET_TYPE_ID(double))
+				return ROBOTICK_SHARED_TELEMETRY_FLOAT64;
+			if (type == GET_TYPE_ID(bool))
+				return ROBOTICK_SHARED_TELEMETRY_BOOL;
+			if (type == GET_TYPE_ID(FixedString8) || type == GET_TYPE_ID(FixedString16) || type == GET_TYPE_ID(FixedString32) ||
+				type == GET_TYPE_ID(FixedString64) || type == GET_TYPE_ID(FixedString128) || type == GET_TYPE_ID(FixedString256) ||
+				type == GET_TYPE_ID(FixedString512) || type == GET_TYPE_ID(FixedString1024))
+				return ROBOTICK_SHARED_TELEMETRY_STRING;
+			return ROBOTICK_SHARED_TELEMETRY_BYTES;
+		}
+	} // namespace
+
+	//----------------------------------------------------------------------
+	// Workload
+	//----------------------------------------------------------------------
+
+	// Exports a seqlock-protected snapshot of selected workloads' fields into shared memory each tick, for
+	// same-host loggers and plotting tools that would otherwise go through MQTT (JSON, TCP, broker).
+	struct SharedTelemetryWorkload
+	{
+		SharedTelemetryConfig config;
+		SharedTelemetryOutputs outputs;
+
+		State<SharedTelemetryState> state;
+
+		void set_engine(const Engine& engine_in) { state->engine = &engine_in; }
+
+		void start(float)
+		{
+			ROBOTICK_ASSERT_MSG(state->engine != nullptr, "Engine must be set before start()");
+
+			// Every workload is loaded by now, so field addresses in the engine's buffer are final.
+			std_approved::vector<SharedTelemetryField> fields;
+			collect_fields(fields);
+
+			if (!state->writer.open(config.segment_name.c_str(), fields.data(), static_cast<uint32_t>(fields.size())))
+			{
+				ROBOTICK_WARNING("SharedTelemetryWorkload - unable to open shared memory segment '%s'", config.segment_name.c_str());
+				return;
+			}
+
+			outputs.field_count = static_cast<uint32_t>(fields.size());
+			outputs.snapshot_bytes = state->writer.get_data_size();
+			outputs.copy_runs = state->writer.get_copy_run_count();
+			outputs.active = true;
+		}
+
+		void tick(const TickInfo& tick_info) { state->writer.publish(tick_info.time_now_ns); }
+
+		void collect_fields(std_approved::vector<SharedTelemetryField>& fields)
+		{
+			const Engine& engine = *state->engine;
+			WorkloadsBuffer& buffer = const_cast<Engine&>(engine).get_workloads_buffer();
+
+			WorkloadFieldsIterator::for_each_workload_field(engine,
+				&buffer,
+				[&](const WorkloadFieldView& top_view)
+				{
+					if (!top_view.workload_info || !top_view.struct_info || !top_view.field_info)
+						return;
+
+					const char* workload_name = top_view.workload_info->seed->unique_name;
+					if (!config.workloads.empty() && !is_listed(config.workloads.c_str(), workload_name))
+						return;
+
+					const WorkloadDescriptor* workload_desc = top_view.workload_info->type->get_workload_desc();
+					if (!workload_desc)
+						return;
+
+					const char* struct_name = nullptr;
+					if (top_view.struct_info == workload_desc->outputs_desc)
+						struct_name = "outputs";
+					else if (top_view.struct_info == workload_desc->inputs_desc)
+						struct_name = "inputs";
+					else if (top_view.struct_info == workload_desc->config_desc && config.include_config)
+						struct_name = "config";
+					else
+						return;
+
+					FixedString512 base_path;
+					base_path.format("%s.%s.%s", workload_name, struct_name, top_view.field_info->name.c_str());
+
+					auto visit_leafs = [&](auto&& self, const WorkloadFieldView& view, const FixedString512& path_so_far) -> void
+					{
+						if (view.is_struct_field())
+						{
+							WorkloadFieldsIterator::for_each_field_in_struct_field(view,
+								[&](const WorkloadFieldView& child)
+								{
+									const char* child_name = child.subfield_info ? child.subfield_info->name.c_str()
+																				 : (child.field_info ? child.field_info->name.c_str() : "(unknown)");
+									FixedString512 next_path(path_so_far.c_str());
+									next_path.append(".");
+									next_path.append(child_name);
+									self(self, child, next_path);
+								});
+							return;
+						}
+
+						if (!view.field_ptr)
+							return;
+
+						const FieldDescriptor* field_desc = view.subfield_info ? view.subfield_info : view.field_info;
+						const TypeDescriptor* type_desc = field_desc ? field_desc->find_type_descriptor() : nullptr;
+						if (!type_desc || type_desc->size == 0 || type_desc->size > config.max_field_size)
+							return;
+
+						if (path_so_far.length() >= ROBOTICK_SHARED_TELEMETRY_PATH_SIZE)
+						{
+							ROBOTICK_WARNING("SharedTelemetryWorkload - skipping '%s' (path too long)", path_so_far.c_str());
+							return;
+						}
+
+						SharedTelemetryField& field = fields.emplace_back();
+						field.path.assign(path_so_far.c_str(), path_so_far.length());
+						field.src = view.field_ptr;
+						field.size = static_cast<uint32_t>(type_desc->size);
+						field.kind = kind_for_type(field_desc->type_id);
+					};
+
+					visit_leafs(visit_leafs, top_view, base_path);
+				});
+		}
+	};
+
+} // namespace robotick
+
+#endif
@@ -27,17 +27,23 @@ namespace robotick
 		float result = 0.0f; // filtered output
 	};
 
+	struct LowPassFilterState
+	{
+		// alpha only depends on dt and tau, so it is recomputed only when either changes.
+		float cached_dt = -1.0f;
+		float cached_tau = -1.0f;
+		float alpha = 0.0f;
+	};
+
 	struct LowPassFilterWorkload
 	{
 		LowPassFilterConfig config;
 		LowPassFilterInputs inputs;
 		LowPassFilterOutputs outputs;
+		State<LowPassFilterState> state;
 
 		void tick(const TickInfo& ti)
 		{
-			// Derive alpha from dt and tau: alpha = 1 - exp(-dt / tau)
-			// Assumes ti.dt_seconds is available. If your TickInfo uses a different name,
-			// map it here.
 			const float dt = ti.delta_time;
 
 			float tau = config.tau_seconds;
@@ -46,21 +52,12 @@ namespace robotick
 				tau = config.min_tau_seconds;
 			}
 
-			// Handle degenerate dt safely (e.g., first frame).
-			float alpha = 0.0f;
-			if (dt > 0.0f)
+			LowPassFilterState& s = state.get();
+			if (dt != s.cached_dt || tau != s.cached_tau)
 			{
-				const float u = -dt / tau;
-				// For very small |u|, expf(u) ~ 1 + u; alpha stays well-behaved.
-				alpha = 1.0f - robotick::exp(u);
-				if (alpha < 0.0f)
-				{
-					alpha = 0.0f;
-				}
-				else if (alpha > 1.0f)
-				{
-					alpha = 1.0f;
-				}
+				s.cached_dt = dt;
+				s.cached_tau = tau;
+				s.alpha = compute_alpha(dt, tau);
 			}
 
 			if (inputs.reset)
@@ -70,8 +67,30 @@ namespace robotick
 			else
 			{
 				// Exponential smoothing step
-				outputs.result += alpha * (inputs.value - outputs.result);
+				outputs.result += s.alpha * (inputs.value - outputs.result);
+			}
+		}
+
+		static float compute_alpha(float dt, float tau)
+		{
+			// Derive alpha from dt and tau: alpha = 1 - exp(-dt / tau)
+			// Handle degenerate dt safely (e.g., first frame).
+			if (dt <= 0.0f)
+			{
+				return 0.0f;
+			}
+
+			// For very small |u|, expf(u) ~ 1 + u; alpha stays well-behaved.
+			const float alpha = 1.0f - robotick::exp(-dt / tau);
+			if (alpha < 0.0f)
+			{
+				return 0.0f;
+			}
+			if (alpha > 1.0f)
+			{
+				return 1.0f;
 			}
+			return alpha;
 		}
 	};
 } // namespace robotick
@@ -0,0 +1,174 @@
+// Copyright Robotick contributors
+// SPDX-License-Identifier: Apache-2.0
+
+#include "robotick/api.h"
+
+#include <cstring>
+
+namespace robotick
+{
+	// ======================================================
+	// === MatrixMixerWorkload ==============================
+	// ======================================================
+	//
+	// result = clamp(weights * values), where weights is an M x N (outputs x inputs) matrix.
+	// Generalises WeightedSumWorkload to wide mixes such as mecanum / omni motor mixing or sensor blends,
+	// replacing trees of scalar workloads with one tick and one connection per vector.
+
+	static constexpr size_t kMaxMixerChannels = 16;
+
+	using MixerVector = FixedVector<float, kMaxMixerChannels>;
+	using MixerMatrix = FixedVector<float, kMaxMixerChannels * kMaxMixerChannels>;
+	ROBOTICK_REGISTER_FIXED_VECTOR(MixerVector, float);
+	ROBOTICK_REGISTER_FIXED_VECTOR(MixerMatrix, float);
+
+	struct MatrixMixerConfig
+	{
+		int num_inputs = 2;
+		int num_outputs = 1;
+
+		// Row-major (one row of num_inputs weights per output). Missing entries are treated as 0.
+		MixerMatrix weights;
+
+		// Optional per-output stage, as in SteeringMixerWorkload.
+		bool clamp_outputs = false;
+		float output_min = -1.0f;
+		float output_max = 1.0f;
+		float seek_rate = -1.0f; // <= 0 means instant-snap (no seeking)
+	};
+
+	struct MatrixMixerInputs
+	{
+		MixerVector values; // missing entries are treated as 0
+
+		// Optional live matrix (same layout as config.weights); used instead of config.weights when non-empty.
+		MixerMatrix weights;
+	};
+
+	struct MatrixMixerOutputs
+	{
+		MixerVector result;
+	};
+
+	struct MatrixMixerState
+	{
+		size_t num_inputs = 0;
+		size_t num_outputs = 0;
+
+		// Column-major copy of the active weights so the product accumulates contiguous output rows
+		// (vectorisable), rebuilt only when the source matrix changes.
+		float columns[kMaxMixerChannels * kMaxMixerChannels] = {};
+		MixerMatrix cached_weights;
+		bool has_cached_weights = false;
+
+		float mixed[kMaxMixerChannels] = {};
+	};
+
+	struct MatrixMixerWorkload
+	{
+		MatrixMixerConfig config;
+		MatrixMixerInputs inputs;
+		MatrixMixerOutputs outputs;
+		State<MatrixMixerState> state;
+
+		void load()
+		{
+			MatrixMixerState& s = state.get();
+			s.num_inputs = static_cast<size_t>(robotick::clamp(config.num_inputs, 0, static_cast<int>(kMaxMixerChannels)));
+			s.num_outputs = static_cast<size_t>(robotick::clamp(config.num_outputs, 0, static_cast<int>(kMaxMixerChannels)));
+			if (s.num_inputs != static_cast<size_t>(config.num_inputs) || s.num_outputs != static_cast<size_t>(config.num_outputs))
+			{
+				ROBOTICK_WARNING("MatrixMixerWorkload - %d x %d exceeds the %d x %d limit, clamping",
+					config.num_outputs,
+					config.num_inputs,
+					static_cast<int>(kMaxMixerChannels),
+					static_cast<int>(kMaxMixerChannels));
+			}
+
+			if (!config.weights.empty() && config.weights.size() != s.num_inputs * s.num_outputs)
+			{
+				ROBOTICK_WARNING("MatrixMixerWorkload - weights has %d entries, expected %d (missing entries are 0)",
+					static_cast<int>(config.weights.size()),
+					static_cast<int>(s.num_inputs * s.num_outputs));
+			}
+
+			outputs.result.set_size(s.num_outputs);
+			::memset(outputs.result.data(), 0, s.num_outputs * sizeof(float));
+		}
+
+		void tick(const TickInfo& tick_info)
+		{
+			MatrixMixerState& s = state.get();
+			const size_t num_inputs = s.num_inputs;
+			const size_t num_outputs = s.num_outputs;
+
+			update_columns(inputs.weights.empty() ? config.weights : inputs.weights);
+
+			// mixed = sum over inputs of (column_i * value_i)
+			float* mixed = s.mixed;
+			::memset(mixed, 0, num_outputs * sizeof(float));
+
+			const size_t num_values = robotick::min(num_inputs, inputs.values.size());
+			for (size_t i = 0; i < num_values; ++i)
+			{
+				const float value = inputs.values[i];
+				const float* column = s.columns + i * num_outputs;
+				for (size_t j = 0; j < num_outputs; ++j)
+				{
+					mixed[j] += column[j] * value;
+				}
+			}
+
+			if (config.clamp_outputs)
+			{
+				const float lo = config.output_min;
+				const float hi = config.output_max;
+				for (size_t j = 0; j < num_outputs; ++j)
+				{
+					mixed[j] = max(lo, min(hi, mixed[j]));
+				}
+			}
+
+			outputs.result.set_size(num_outputs);
+			float* result = outputs.result.data();
+
+			if (config.seek_rate <= 0.0f)
+			{
+				::memcpy(result, mixed, num_outputs * sizeof(float));
+				return;
+			}
+
+			const float max_delta = config.seek_rate * tick_info.delta_time;
+			for (size_t j = 0; j < num_outputs; ++j)
+			{
+				const float delta = max(-max_delta, min(max_delta, mixed[j] - result[j]));
+				result[j] += delta;
+			}
+		}
+
+		void update_columns(const MixerMatrix& weights)
+		{
+			MatrixMixerState& s = state.get();
+			if (s.has_cached_weights && s.cached_weights.size() == weights.size() &&
+				(weights.empty() || ::memcmp(s.cached_weights.data(), weights.data(), weights.size() * sizeof(float)) == 0))
+			{
+				return;
+			}
+
+			s.cached_weights.set(weights.data(), weights.size());
+			s.has_cached_weights = true;
+
+			const size_t num_inputs = s.num_inputs;
+			const size_t num_outputs = s.num_outputs;
+			for (size_t j = 0; j < num_outputs; ++j)
+			{
+				for (size_t i = 0; i < num_inputs; ++i)
+				{
+					const size_t row_major_index = j * num_inputs + i;
+					s.columns[i * num_outputs + j] = (row_major_index < weights.size()) ? weights[row_major_index] : 0.0f;
+				}
+			}
+		}
+	};
+
+} // namespace robotick
@@ -0,0 +1,384 @@
+// Copyright Robotick contributors
+// SPDX-License-Identifier: Apache-2.0
+
+#include "robotick/api.h"
+#include "robotick/framework/math/LogExp.h"
+#include "robotick/framework/math/Sqrt.h"
+#include "robotick/framework/math/Trig.h"
+
+#include <cstring>
+
+namespace robotick
+{
+	// ======================================================
+	// === MultiLowPassFilterWorkload =======================
+	// ======================================================
+	//
+	// N-channel counterpart of LowPassFilterWorkload: one workload smooths a whole vector of signals
+	// (joint readings, IMU axes, band energies, ...), so a control group pays one tick dispatch and one
+	// connection copy instead of one per channel. Coefficients are cached until dt or tau changes.
+
+	static constexpr size_t kMaxLowPassChannels = 64;
+	static constexpr size_t kMaxBiquadSections = 2;
+
+	using LowPassChannels = FixedVector<float, kMaxLowPassChannels>;
+	ROBOTICK_REGISTER_FIXED_VECTOR(LowPassChannels, float);
+
+	struct MultiLowPassFilterConfig
+	{
+		// Time constant in seconds, shared by all channels unless tau_seconds_per_channel is set.
+		// For the Butterworth orders the cutoff is derived from it: fc = 1 / (2 * pi * tau).
+		float tau_seconds = 0.25f;
+
+		// Optional per-channel time constants; channels beyond its size use tau_seconds.
+		LowPassChannels tau_seconds_per_channel;
+
+		// Guard to avoid numeric issues when tau is tiny/zero.
+		float min_tau_seconds = 1e-4f;
+
+		// 1 = one-pole exponential smoothing (same response as LowPassFilterWorkload),
+		// 2 / 4 = Butterworth low-pass built from one / two biquad sections.
+		int order = 1;
+	};
+
+	struct MultiLowPassFilterInputs
+	{
+		LowPassChannels values; // input signals, one per channel
+		bool reset = false;		// when true, snap outputs to values this tick
+	};
+
+	struct MultiLowPassFilterOutputs
+	{
+		LowPassChannels result; // filtered outputs, same size as inputs.values
+	};
+
+	struct BiquadCoefficients
+	{
+		float b0 = 1.0f;
+		float b1 = 0.0f;
+		float b2 = 0.0f;
+		float a1 = 0.0f;
+		float a2 = 0.0f;
+	};
+
+	// Per-channel coefficients, one array per tap, so the per-channel loop reads each tap contiguously.
+	struct BiquadChannelCoefficients
+	{
+		float b0[kMaxLowPassChannels] = {};
+		float b1[kMaxLowPassChannels] = {};
+		float b2[kMaxLowPassChannels] = {};
+		float a1[kMaxLowPassChannels] = {};
+		float a2[kMaxLowPassChannels] = {};
+
+		void set(size_t channel, const BiquadCoefficients& c)
+		{
+			b0[channel] = c.b0;
+			b1[channel] = c.b1;
+			b2[channel] = c.b2;
+			a1[channel] = c.a1;
+			a2[channel] = c.a2;
+		}
+	};
+
+	// Per-section state in structure-of-arrays form so the channel loops stay branch-free and vectorisable.
+	struct BiquadSectionState
+	{
+		BiquadCoefficients shared;
+		BiquadChannelCoefficients per_channel;
+		// Direct form I history: independent of the coefficients, so tau/dt changes and resets stay glitch-free.
+		float x1[kMaxLowPassChannels] = {};
+		float x2[kMaxLowPassChannels] = {};
+		float y1[kMaxLowPassChannels] = {};
+		float y2[kMaxLowPassChannels] = {};
+	};
+
+	struct MultiLowPassFilterState
+	{
+		size_t num_channels = 0;
+		int num_sections = 0; // 0 = one-pole
+		bool has_output = false;
+
+		// Cache keys: coefficients are only rebuilt when one of these changes.
+		float cached_dt = -1.0f;
+		float cached_tau = -1.0f;
+		LowPassChannels cached_tau_per_channel;
+
+		bool use_per_channel = false;
+		float shared_alpha = 0.0f;
+		float alpha[kMaxLowPassChannels] = {};
+
+		BiquadSectionState sections[kMaxBiquadSections];
+	};
+
+	struct MultiLowPassFilterWorkload
+	{
+		MultiLowPassFilterConfig config;
+		MultiLowPassFilterInputs inputs;
+		MultiLowPassFilterOutputs outputs;
+		State<MultiLowPassFilterState> state;
+
+		void load()
+		{
+			MultiLowPassFilterState& s = state.get();
+			if (config.order <= 1)
+			{
+				s.num_sections = 0;
+			}
+			else if (config.order <= 2)
+			{
+				s.num_sections = 1;
+			}
+			else
+			{
+				if (config.order != 4)
+				{
+					ROBOTICK_WARNING("MultiLowPassFilterWorkload - order %d not supported, using 4", config.order);
+				}
+				s.num_sections = 2;
+			}
+		}
+
+		void start(float)
+		{
+			MultiLowPassFilterState& s = state.get();
+			s.has_output = false;
+			s.cached_dt = -1.0f;
+			outputs.result.set_size(0);
+		}
+
+		void tick(const TickInfo& ti)
+		{
+			MultiLowPassFilterState& s = state.get();
+
+			const size_t num_channels = inputs.values.size();
+			if (num_channels != s.num_channels)
+			{
+				// Channel layout changed (or first tick): start every channel from its current input.
+				s.num_channels = num_channels;
+				s.has_output = false;
+				s.cached_dt = -1.0f;
+			}
+			outputs.result.set_size(num_channels);
+			if (num_channels == 0)
+			{
+				return;
+			}
+
+			const float* in = inputs.values.data();
+			float* out = outputs.result.data();
+
+			if (inputs.reset || !s.has_output)
+			{
+				snap_to_input(in, out, num_channels);
+				s.has_output = true;
+				return;
+			}
+
+			if (ti.delta_time <= 0.0f)
+			{
+				return; // degenerate dt: hold the previous output
+			}
+
+			update_coefficients(ti.delta_time);
+
+			if (s.num_sections == 0)
+			{
+				tick_one_pole(in, out, num_channels);
+			}
+			else
+			{
+				tick_biquads(in, out, num_channels);
+			}
+		}
+
+		// --- Coefficients ---
+
+		float get_channel_tau(size_t channel) const
+		{
+			const float tau = (channel < config.tau_seconds_per_channel.size()) ? config.tau_seconds_per_channel[channel] : config.tau_seconds;
+			return (tau < config.min_tau_seconds) ? config.min_tau_seconds : tau;
+		}
+
+		static float compute_alpha(float dt, float tau)
+		{
+			// alpha = 1 - exp(-dt / tau), clamped to [0, 1]
+			const float alpha = 1.0f - robotick::exp(-dt / tau);
+			return (alpha < 0.0f) ? 0.0f : ((alpha > 1.0f) ? 1.0f : alpha);
+		}
+
+		static BiquadCoefficients compute_butterworth_section(float dt, float tau, float q)
+		{
+			BiquadCoefficients c;
+
+			// RBJ cookbook low-pass; keep the cutoff safely below Nyquist.
+			const float sample_rate = 1.0f / dt;
+			float cutoff_hz = 1.0f / (2.0f * robotick::kPi * tau);
+			if (cutoff_hz > 0.45f * sample_rate)
+			{
+				cutoff_hz = 0.45f * sample_rate;
+			}
+
+			const float w0 = 2.0f * robotick::kPi * cutoff_hz * dt;
+			const float cos_w0 = robotick::cos(w0);
+			const float alpha = robotick::sin(w0) / (2.0f * q);
+			const float inv_a0 = 1.0f / (1.0f + alpha);
+
+			c.b0 = 0.5f * (1.0f - cos_w0) * inv_a0;
+			c.b1 = (1.0f - cos_w0) * inv_a0;
+			c.b2 = c.b0;
+			c.a1 = -2.0f * cos_w0 * inv_a0;
+			c.a2 = (1.0f - alpha) * inv_a0;
+			return c;
+		}
+
+		static float get_section_q(int num_sections, int section)
+		{
+			// Butterworth pole Qs: 2nd order = 1/sqrt(2); 4th order = 1 / (2 cos(pi/8)), 1 / (2 cos(3pi/8)).
+			if (num_sections == 1)
+			{
+				return 1.0f / robotick::sqrt(2.0f);
+			}
+			return (section == 0) ? 0.54119610f : 1.30656296f;
+		}
+
+		bool is_tau_config_cached() const
+		{
+			const MultiLowPassFilterState& s = state.get();
+			if (s.cached_tau != config.tau_seconds || s.cached_tau_per_channel.size() != config.tau_seconds_per_channel.size())
+			{
+				return false;
+			}
+			const size_t count = config.tau_seconds_per_channel.size();
+			return count == 0 || ::memcmp(s.cached_tau_per_channel.data(), config.tau_seconds_per_channel.data(), count * sizeof(float)) == 0;
+		}
+
+		void update_coefficients(float dt)
+		{
+			MultiLowPassFilterState& s = state.get();
+			if (s.cached_dt == dt && is_tau_config_cached())
+			{
+				return;
+			}
+
+			s.cached_dt = dt;
+			s.cached_tau = config.tau_seconds;
+			s.cached_tau_per_channel.set(config.tau_seconds_per_channel.data(), config.tau_seconds_per_channel.size());
+			s.use_per_channel = !config.tau_seconds_per_channel.empty();
+
+			const float shared_tau = (config.tau_seconds < config.min_tau_seconds) ? config.min_tau_seconds : config.tau_seconds;
+
+			if (s.num_sections == 0)
+			{
+				s.shared_alpha = compute_alpha(dt, shared_tau);
+				if (s.use_per_channel)
+				{
+					for (size_t i = 0; i < s.num_channels; ++i)
+					{
+						s.alpha[i] = compute_alpha(dt, get_channel_tau(i));
+					}
+				}
+				return;
+			}
+
+			for (int k = 0; k < s.num_sections; ++k)
+			{
+				BiquadSectionState& section = s.sections[k];
+				const float q = get_section_q(s.num_sections, k);
+				section.shared = compute_butterworth_section(dt, shared_tau, q);
+				if (s.use_per_channel)
+				{
+					for (size_t i = 0; i < s.num_channels; ++i)
+					{
+						section.per_channel.set(i, compute_butterworth_section(dt, get_channel_tau(i), q));
+					}
+				}
+			}
+		}
+
+		// --- Filtering ---
+
+		void snap_to_input(const float* in, float* out, size_t num_channels)
+		{
+			MultiLowPassFilterState& s = state.get();
+			::memcpy(out, in, num_channels * sizeof(float));
+
+			// Steady state for a constant input: every history tap equals it.
+			for (int k = 0; k < s.num_sections; ++k)
+			{
+				BiquadSectionState& section = s.sections[k];
+				::memcpy(section.x1, in, num_channels * sizeof(float));
+				::memcpy(section.x2, in, num_channels * sizeof(float));
+				::memcpy(section.y1, in, num_channels * sizeof(float));
+				::memcpy(section.y2, in, num_channels * sizeof(float));
+			}
+		}
+
+		void tick_one_pole(const float* in, float* out, size_t num_channels)
+		{
+			const MultiLowPassFilterState& s = state.get();
+			if (s.use_per_channel)
+			{
+				const float* alpha = s.alpha;
+				for (size_t i = 0; i < num_channels; ++i)
+				{
+					out[i] += alpha[i] * (in[i] - out[i]);
+				}
+			}
+			else
+			{
+				const float alpha = s.shared_alpha;
+				for (size_t i = 0; i < num_channels; ++i)
+				{
+					out[i] += alpha * (in[i] - out[i]);
+				}
+			}
+		}
+
+		void tick_biquads(const float* in, float* out, size_t num_channels)
+		{
+			MultiLowPassFilterState& s = state.get();
+
+			// Each section filters the previous section's output (the first reads the input).
+			const float* src = in;
+			for (int k = 0; k < s.num_sections; ++k)
+			{
+				BiquadSectionState& section = s.sections[k];
+				float* x1 = section.x1;
+				float* x2 = section.x2;
+				float* y1 = section.y1;
+				float* y2 = section.y2;
+
+				if (s.use_per_channel)
+				{
+					const BiquadChannelCoefficients& c = section.per_channel;
+					for (size_t i = 0; i < num_channels; ++i)
+					{
+						const float x = src[i];
+						const float y = c.b0[i] * x + c.b1[i] * x1[i] + c.b2[i] * x2[i] - c.a1[i] * y1[i] - c.a2[i] * y2[i];
+						x2[i] = x1[i];
+						x1[i] = x;
+						y2[i] = y1[i];
+						y1[i] = y;
+					}
+				}
+				else
+				{
+					const BiquadCoefficients c = section.shared;
+					for (size_t i = 0; i < num_channels; ++i)
+					{
+						const float x = src[i];
+						const float y = c.b0 * x + c.b1 * x1[i] + c.b2 * x2[i] - c.a1 * y1[i] - c.a2 * y2[i];
+						x2[i] = x1[i];
+						x1[i] = x;
+						y2[i] = y1[i];
+						y1[i] = y;
+					}
+				}
+				src = y1;
+			}
+
+			::memcpy(out, src, num_channels * sizeof(float));
+		}
+	};
+
+} // namespace robotick
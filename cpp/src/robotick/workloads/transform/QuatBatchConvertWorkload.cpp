@@ -0,0 +1,235 @@
+// Copyright Robotick contributors
+// SPDX-License-Identifier: Apache-2.0
+
+#include "robotick/api.h"
+#include "robotick/framework/math/Sqrt.h"
+
+#include <cmath>
+
+namespace robotick
+{
+	// ======================================================
+	// === QuatBatchConvertWorkload =========================
+	// ======================================================
+	//
+	// Batched counterpart of QuatToEulerWorkload: converts a vector of orientations (e.g. every body's
+	// xquat of a multi-link model) in one pass, to Euler angles, rotation matrices and/or rotation vectors.
+	// Quaternions are split into structure-of-arrays scratch first so each stage is a straight loop the
+	// compiler can vectorise; fast_trig swaps libm's atan2/asin for branch-free polynomial approximations.
+
+	static constexpr size_t kMaxQuatBatch = 32;
+
+	using QuatBatch = FixedVector<Quatf, kMaxQuatBatch>;
+	using Vec3Batch = FixedVector<Vec3f, kMaxQuatBatch>;
+	using RotationMatrixBatch = FixedVector<float, kMaxQuatBatch * 9>;
+	ROBOTICK_REGISTER_FIXED_VECTOR(QuatBatch, Quatf);
+	ROBOTICK_REGISTER_FIXED_VECTOR(Vec3Batch, Vec3f);
+	ROBOTICK_REGISTER_FIXED_VECTOR(RotationMatrixBatch, float);
+
+	struct QuatBatchConvertConfig
+	{
+		bool output_euler = true;			  // roll / pitch / yaw in x / y / z (radians, REP-103 as QuatToEulerWorkload)
+		bool output_matrices = false;		  // 9 floats per quaternion, row-major
+		bool output_rotation_vectors = false; // axis * angle (radians)
+
+		// Polynomial atan2/asin (max error ~1e-5 rad) instead of libm - noticeably cheaper for large batches.
+		bool fast_trig = false;
+	};
+
+	struct QuatBatchConvertInputs
+	{
+		QuatBatch quats;
+	};
+
+	struct QuatBatchConvertOutputs
+	{
+		Vec3Batch euler;
+		RotationMatrixBatch matrices;
+		Vec3Batch rotation_vectors;
+	};
+
+	struct QuatBatchConvertState
+	{
+		// Normalised quaternion components, structure-of-arrays.
+		float w[kMaxQuatBatch] = {};
+		float x[kMaxQuatBatch] = {};
+		float y[kMaxQuatBatch] = {};
+		float z[kMaxQuatBatch] = {};
+
+		// atan2 / asin argument scratch.
+		float num[kMaxQuatBatch] = {};
+		float den[kMaxQuatBatch] = {};
+		float angle[kMaxQuatBatch] = {};
+	};
+
+	struct QuatBatchConvertWorkload
+	{
+		QuatBatchConvertConfig config;
+		QuatBatchConvertInputs inputs;
+		QuatBatchConvertOutputs outputs;
+		State<QuatBatchConvertState> state;
+
+		// --- fast trig ---
+
+		// atan(t) for |t| <= 1 (odd minimax polynomial, max error ~1e-5 rad).
+		static inline float atan_unit(float t)
+		{
+			const float t2 = t * t;
+			return t * (0.99997726f + t2 * (-0.33262347f + t2 * (0.19354346f + t2 * (-0.11643287f + t2 * (0.05265332f + t2 * -0.01172120f)))));
+		}
+
+		static inline float fast_atan2(float y, float x)
+		{
+			const float abs_x = fabsf(x);
+			const float abs_y = fabsf(y);
+			const bool swap = abs_y > abs_x;
+			const float hi = swap ? abs_y : abs_x;
+			const float lo = swap ? abs_x : abs_y;
+			float r = atan_unit((hi > 0.0f) ? lo / hi : 0.0f);
+			r = swap ? (0.5f * robotick::kPi - r) : r;
+			r = (x < 0.0f) ? (robotick::kPi - r) : r;
+			return (y < 0.0f) ? -r : r;
+		}
+
+		static inline float fast_asin(float s) { return fast_atan2(s, robotick::sqrt(robotick::max(0.0f, 1.0f - s * s))); }
+
+		void atan2_batch(size_t count)
+		{
+			QuatBatchConvertState& s = state.get();
+			if (config.fast_trig)
+			{
+				for (size_t i = 0; i < count; ++i)
+					s.angle[i] = fast_atan2(s.num[i], s.den[i]);
+			}
+			else
+			{
+				for (size_t i = 0; i < count; ++i)
+					s.angle[i] = atan2f(s.num[i], s.den[i]);
+			}
+		}
+
+		// --- tick ---
+
+		void tick(const TickInfo&)
+		{
+			QuatBatchConvertState& s = state.get();
+			const size_t count = inputs.quats.size();
+
+			// Split + normalise (a zero quaternion maps to identity).
+			for (size_t i = 0; i < count; ++i)
+			{
+				const Quatf& q = inputs.quats[i];
+				const float norm_sq = q.w * q.w + q.x * q.x + q.y * q.y + q.z * q.z;
+				const float inv_norm = (norm_sq > 0.0f) ? 1.0f / robotick::sqrt(norm_sq) : 0.0f;
+				s.w[i] = (norm_sq > 0.0f) ? q.w * inv_norm : 1.0f;
+				s.x[i] = q.x * inv_norm;
+				s.y[i] = q.y * inv_norm;
+				s.z[i] = q.z * inv_norm;
+			}
+
+			outputs.euler.set_size(config.output_euler ? count : 0);
+			outputs.matrices.set_size(config.output_matrices ? count * 9 : 0);
+			outputs.rotation_vectors.set_size(config.output_rotation_vectors ? count : 0);
+
+			if (config.output_euler)
+			{
+				convert_to_euler(count);
+			}
+			if (config.output_matrices)
+			{
+				convert_to_matrices(count);
+			}
+			if (config.output_rotation_vectors)
+			{
+				convert_to_rotation_vectors(count);
+			}
+		}
+
+		void convert_to_euler(size_t count)
+		{
+			QuatBatchConvertState& s = state.get();
+			const float* w = s.w;
+			const float* x = s.x;
+			const float* y = s.y;
+			const float* z = s.z;
+			Vec3f* euler = outputs.euler.data();
+
+			// roll
+			for (size_t i = 0; i < count; ++i)
+			{
+				s.num[i] = 2.0f * (w[i] * x[i] + y[i] * z[i]);
+				s.den[i] = 1.0f - 2.0f * (x[i] * x[i] + y[i] * y[i]);
+			}
+			atan2_batch(count);
+			for (size_t i = 0; i < count; ++i)
+				euler[i].x = s.angle[i];
+
+			// pitch (clamped to handle gimbal lock at +/-90 degrees)
+			for (size_t i = 0; i < count; ++i)
+			{
+				const float sinp = robotick::clamp(2.0f * (w[i] * y[i] - z[i] * x[i]), -1.0f, 1.0f);
+				euler[i].y = config.fast_trig ? fast_asin(sinp) : asinf(sinp);
+			}
+
+			// yaw
+			for (size_t i = 0; i < count; ++i)
+			{
+				s.num[i] = 2.0f * (w[i] * z[i] + x[i] * y[i]);
+				s.den[i] = 1.0f - 2.0f * (y[i] * y[i] + z[i] * z[i]);
+			}
+			atan2_batch(count);
+			for (size_t i = 0; i < count; ++i)
+				euler[i].z = s.angle[i];
+		}
+
+		void convert_to_matrices(size_t count)
+		{
+			const QuatBatchConvertState& s = state.get();
+			float* m = outputs.matrices.data();
+
+			for (size_t i = 0; i < count; ++i, m += 9)
+			{
+				const float w = s.w[i];
+				const float x = s.x[i];
+				const float y = s.y[i];
+				const float z = s.z[i];
+
+				m[0] = 1.0f - 2.0f * (y * y + z * z);
+				m[1] = 2.0f * (x * y - w * z);
+				m[2] = 2.0f * (x * z + w * y);
+				m[3] = 2.0f * (x * y + w * z);
+				m[4] = 1.0f - 2.0f * (x * x + z * z);
+				m[5] = 2.0f * (y * z - w * x);
+				m[6] = 2.0f * (x * z - w * y);
+				m[7] = 2.0f * (y * z + w * x);
+				m[8] = 1.0f - 2.0f * (x * x + y * y);
+			}
+		}
+
+		void convert_to_rotation_vectors(size_t count)
+		{
+			QuatBatchConvertState& s = state.get();
+			Vec3f* rotation_vectors = outputs.rotation_vectors.data();
+
+			// angle = 2 * atan2(|v|, w), taking the w >= 0 hemisphere so the angle lies in [0, pi].
+			for (size_t i = 0; i < count; ++i)
+			{
+				s.num[i] = robotick::sqrt(s.x[i] * s.x[i] + s.y[i] * s.y[i] + s.z[i] * s.z[i]);
+				s.den[i] = fabsf(s.w[i]);
+			}
+			atan2_batch(count);
+
+			for (size_t i = 0; i < count; ++i)
+			{
+				const float sign = (s.w[i] < 0.0f) ? -1.0f : 1.0f;
+				const float sin_half = s.num[i];
+				// Small angles: 2 * atan2(v, w) / |v| -> 2 / w.
+				const float scale = sign * ((sin_half > 1e-6f) ? (2.0f * s.angle[i]) / sin_half : 2.0f / robotick::max(s.den[i], 1e-6f));
+				rotation_vectors[i].x = s.x[i] * scale;
+				rotation_vectors[i].y = s.y[i] * scale;
+				rotation_vectors[i].z = s.z[i] * scale;
+			}
+		}
+	};
+
+} // namespace robotick
@@ -15,6 +15,11 @@ namespace robotick
 	{
 		FixedString256 scene_path;
 		bool render_to_texture = false;
+
+		// Load YAML scenes through a binary cache keyed on the file contents (see CanvasScene).
+		bool use_scene_cache = true;
+		// Cache directory; empty writes "<scene_path>.canvasb" next to the scene file.
+		FixedString256 scene_cache_dir;
 	};
 
 	struct CanvasInputs
@@ -56,7 +61,20 @@ namespace robotick
 		void load_scene_from_file(const char* path)
 		{
 			CanvasState& s = state.get();
-			if (!s.scene.load_from_file(path))
+
+			bool loaded = false;
+			if (config.use_scene_cache)
+			{
+				CanvasSceneCacheOptions cache_options;
+				cache_options.cache_dir = config.scene_cache_dir.empty() ? nullptr : config.scene_cache_dir.c_str();
+				loaded = s.scene.load_from_file(path, cache_options);
+			}
+			else
+			{
+				loaded = s.scene.load_from_file(path);
+			}
+
+			if (!loaded)
 			{
 				ROBOTICK_FATAL_EXIT("CanvasWorkload failed to load scene file: %s", path);
 			}
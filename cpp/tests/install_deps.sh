@@ -15,7 +15,7 @@ apt-get update -yq
 apt-get install -y --no-install-recommends \
   git cmake build-essential pkg-config \
   libopencv-dev \
-  libsdl2-dev libsdl2-ttf-dev libsdl2-gfx-dev \
+  libsdl2-dev libsdl2-ttf-dev \
   libssl-dev libcurl4-openssl-dev \
   python3-dev \
   libyaml-cpp-dev \
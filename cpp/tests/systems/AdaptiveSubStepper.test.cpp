@@ -0,0 +1,145 @@
+// Copyright Robotick contributors
+// SPDX-License-Identifier: Apache-2.0
+
+#include "robotick/systems/AdaptiveSubStepper.h"
+
+#include "robotick/framework/time/Clock.h"
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+namespace robotick::tests
+{
+	namespace
+	{
+		volatile uint64_t busy_sink = 0;
+
+		void spin_for_ms(uint32_t duration_ms)
+		{
+			const auto start = Clock::now();
+			while (Clock::to_nanoseconds(Clock::now() - start).count() < duration_ms * 1'000'000ll)
+				busy_sink = busy_sink + 1;
+		}
+
+		AdaptiveSubStepperConfig make_config(double timestep_sec, uint32_t max_steps_per_tick, double max_debt_sec)
+		{
+			AdaptiveSubStepperConfig config;
+			config.timestep_sec = timestep_sec;
+			config.max_steps_per_tick = max_steps_per_tick;
+			config.max_debt_sec = max_debt_sec;
+			config.deterministic = true;
+			return config;
+		}
+	} // namespace
+
+	TEST_CASE("Unit/Systems/AdaptiveSubStepper")
+	{
+		AdaptiveSubStepper sub_stepper;
+		uint32_t total_steps = 0;
+		auto step = [&total_steps]()
+		{
+			total_steps++;
+		};
+
+		SECTION("Keeping up takes exactly the nominal steps and owes nothing")
+		{
+			sub_stepper.configure(make_config(0.01, 8, 0.25));
+			for (int tick = 0; tick < 10; ++tick)
+			{
+				CHECK(sub_stepper.tick(2, step) == 2);
+				CHECK(sub_stepper.get_debt_sec() == Catch::Approx(0.0).margin(1e-9));
+			}
+			CHECK(total_steps == 20);
+			CHECK(sub_stepper.get_dropped_sec() == 0.0);
+		}
+
+		SECTION("Debt carries over and is repaid up to the step cap")
+		{
+			sub_stepper.configure(make_config(0.01, 4, 0.25));
+
+			// A long tick owes 6 steps; only 4 fit, so 2 carry over.
+			CHECK(sub_stepper.tick(6, step) == 4);
+			CHECK(sub_stepper.get_debt_sec() == Catch::Approx(0.02));
+
+			// The next tick owes its own 2 plus the 2 carried: all 4 fit and the debt is cleared.
+			CHECK(sub_stepper.tick(2, step) == 4);
+			CHECK(sub_stepper.get_debt_sec() == Catch::Approx(0.0).margin(1e-9));
+			CHECK(total_steps == 8);
+		}
+
+		SECTION("Debt beyond max_debt_sec is dropped and totalled")
+		{
+			// Owes 2 steps a tick but may only take 1: the debt grows by one step per tick until capped.
+			sub_stepper.configure(make_config(0.01, 1, 0.035));
+
+			const double expected_debt[] = {0.01, 0.02, 0.03, 0.035, 0.035};
+			const double expected_dropped[] = {0.0, 0.0, 0.0, 0.005, 0.015};
+			for (int tick = 0; tick < 5; ++tick)
+			{
+				CHECK(sub_stepper.tick(2, step) == 1);
+				CHECK(sub_stepper.get_debt_sec() == Catch::Approx(expected_debt[tick]));
+				CHECK(sub_stepper.get_dropped_sec() == Catch::Approx(expected_dropped[tick]).margin(1e-9));
+			}
+
+			sub_stepper.reset();
+			CHECK(sub_stepper.get_debt_sec() == 0.0);
+			CHECK(sub_stepper.get_dropped_sec() == 0.0);
+		}
+
+		SECTION("A slow step stops at the wall-clock budget and the shortfall becomes debt")
+		{
+			// 2 ms steps against a 5 ms budget: the first step always runs, and after two the estimate for a
+			// third (>= 6 ms) overruns, so every tick takes 1 or 2 of its 10 steps however the host is loaded.
+			AdaptiveSubStepperConfig config = make_config(0.001, 40, 0.02);
+			config.deterministic = false;
+			config.tick_budget_ns = 5'000'000;
+			sub_stepper.configure(config);
+
+			auto slow_step = [&total_steps]()
+			{
+				spin_for_ms(2);
+				total_steps++;
+			};
+
+			double expected_debt = 0.0;
+			double expected_dropped = 0.0;
+			for (int tick = 0; tick < 4; ++tick)
+			{
+				const uint32_t steps = sub_stepper.tick(10, slow_step);
+				CHECK(steps >= 1);
+				CHECK(steps <= 2);
+
+				expected_debt += (10.0 - static_cast<double>(steps)) * 0.001;
+				if (expected_debt > 0.02)
+				{
+					expected_dropped += expected_debt - 0.02;
+					expected_debt = 0.02;
+				}
+				CHECK(sub_stepper.get_debt_sec() == Catch::Approx(expected_debt).margin(1e-9));
+				CHECK(sub_stepper.get_dropped_sec() == Catch::Approx(expected_dropped).margin(1e-9));
+			}
+
+			// 4 ticks owe 40 ms and repay at most 8: the 20 ms cap must have been hit.
+			CHECK(sub_stepper.get_debt_sec() == Catch::Approx(0.02));
+			CHECK(sub_stepper.get_dropped_sec() > 0.0);
+		}
+
+		SECTION("Deterministic catch-up ignores the wall clock")
+		{
+			AdaptiveSubStepperConfig config = make_config(0.001, 10, 0.02);
+			config.tick_budget_ns = 1; // would stop after the first step if wall time counted
+			sub_stepper.configure(config);
+
+			CHECK(sub_stepper.tick(10, step) == 10);
+			CHECK(sub_stepper.get_debt_sec() == Catch::Approx(0.0).margin(1e-9));
+		}
+
+		SECTION("No timestep means no stepping")
+		{
+			sub_stepper.configure(make_config(0.0, 4, 0.25));
+			CHECK(sub_stepper.tick(2, step) == 0);
+			CHECK(total_steps == 0);
+		}
+	}
+
+} // namespace robotick::tests
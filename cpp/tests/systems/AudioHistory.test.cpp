@@ -0,0 +1,129 @@
+// Copyright Robotick contributors
+// SPDX-License-Identifier: Apache-2.0
+
+#include "robotick/systems/audio/AudioHistory.h"
+
+#include <catch2/catch_all.hpp>
+
+namespace robotick::test
+{
+	namespace
+	{
+		// Write `count` samples whose values are their absolute sample index.
+		void write_ramp(AudioHistory& history, uint64_t& next_value, size_t count)
+		{
+			static float block[1500];
+			REQUIRE(count <= sizeof(block) / sizeof(block[0]));
+			for (size_t i = 0; i < count; ++i)
+				block[i] = static_cast<float>(next_value++);
+			history.write(block, count);
+		}
+
+		void require_ramp(const AudioHistorySpan& span, uint64_t first_value)
+		{
+			REQUIRE(static_cast<uint64_t>(span.start_sample) == first_value);
+			for (size_t i = 0; i < span.size(); ++i)
+				REQUIRE(span[i] == static_cast<float>(first_value + i));
+		}
+	} // namespace
+
+	TEST_CASE("Unit/Systems/Audio/AudioHistory")
+	{
+		AudioHistory history;
+		history.initialize(1000, 1000);
+		uint64_t next_value = 0;
+
+		SECTION("Latest window wraps without copying")
+		{
+			REQUIRE(history.get_latest(100).empty());
+
+			write_ramp(history, next_value, 700);
+			write_ramp(history, next_value, 1300); // more than one write chunk, wraps the ring
+
+			const AudioHistorySpan latest = history.get_latest_seconds(0.25f);
+			REQUIRE(latest.size() == 250);
+			require_ramp(latest, 1750);
+
+			const AudioHistorySpan everything = history.get_latest(5000);
+			REQUIRE(everything.size() == history.get_capacity());
+			REQUIRE(everything.second_count > 0);
+			require_ramp(everything, 1000);
+			REQUIRE(history.is_intact(everything));
+
+			float contiguous[1000];
+			everything.copy_to(contiguous);
+			REQUIRE(contiguous[0] == 1000.0f);
+			REQUIRE(contiguous[999] == 1999.0f);
+		}
+
+		SECTION("Readers keep independent cursors")
+		{
+			AudioHistoryCursor fast;
+			AudioHistoryCursor slow;
+			history.attach(fast);
+			history.attach(slow);
+
+			write_ramp(history, next_value, 300);
+
+			const AudioHistorySpan fast_span = history.read(fast, 512);
+			REQUIRE(fast_span.size() == 300);
+			require_ramp(fast_span, 0);
+			REQUIRE(history.read(fast, 512).empty());
+
+			const AudioHistorySpan slow_first = history.read(slow, 100);
+			require_ramp(slow_first, 0);
+			REQUIRE(slow_first.size() == 100);
+
+			write_ramp(history, next_value, 1200);
+
+			// Slow reader was lapped: it skips to the oldest retained sample and reports the gap.
+			const AudioHistorySpan slow_second = history.read(slow, 5000);
+			REQUIRE(slow_second.size() == 1000);
+			require_ramp(slow_second, 500);
+			REQUIRE(slow.dropped_samples == 400);
+
+			const AudioHistorySpan fast_second = history.read(fast, 5000);
+			require_ramp(fast_second, 500);
+			REQUIRE(fast.dropped_samples == 200);
+		}
+
+		SECTION("Spans report when the writer has overwritten them")
+		{
+			write_ramp(history, next_value, 1000);
+			const AudioHistorySpan span = history.get_latest(1000);
+			REQUIRE(history.is_intact(span));
+
+			write_ramp(history, next_value, 1);
+			REQUIRE_FALSE(history.is_intact(span));
+			REQUIRE(history.is_intact(history.get_latest(1000)));
+		}
+	}
+
+	TEST_CASE("Unit/Systems/Audio/AudioHistoryRegistry")
+	{
+		AudioHistoryRegistry& registry = AudioHistoryRegistry::get();
+		const char* name = "test_audio_history";
+
+		AudioHistory* writer = registry.acquire(name, 2.0f, 16000);
+		REQUIRE(writer != nullptr);
+		REQUIRE(writer->get_capacity() == 32000);
+
+		AudioHistory* reader = registry.acquire(name, 1.0f, 16000);
+		REQUIRE(reader == writer);
+		REQUIRE(registry.get_ref_count(name) == 2);
+
+		// Readers that don't care about the rate may pass 0; a mismatched rate is refused.
+		REQUIRE(registry.acquire(name, 0.0f, 0) == writer);
+		REQUIRE(registry.acquire(name, 1.0f, 44100) == nullptr);
+		REQUIRE(registry.get_ref_count(name) == 3);
+
+		registry.release(writer);
+		registry.release(reader);
+		registry.release(reader);
+		REQUIRE(registry.get_ref_count(name) == 0);
+
+		// Nothing to attach to once released, and creation needs a rate and size.
+		REQUIRE(registry.acquire(name, 0.0f, 0) == nullptr);
+	}
+
+} // namespace robotick::test
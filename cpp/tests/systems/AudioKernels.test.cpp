@@ -0,0 +1,195 @@
+// Copyright Robotick contributors
+// SPDX-License-Identifier: Apache-2.0
+
+#include "robotick/systems/audio/AudioKernels.h"
+
+#include <catch2/catch_all.hpp>
+#include <cmath>
+#include <cstring>
+
+namespace robotick::test
+{
+	namespace
+	{
+		// Odd length so every SIMD path also exercises its scalar tail.
+		constexpr size_t kCount = 509;
+
+		void fill_signal(float* samples, size_t count, uint32_t seed)
+		{
+			for (size_t i = 0; i < count; ++i)
+			{
+				seed = 1664525u * seed + 1013904223u;
+				const float rand01 = static_cast<float>((seed >> 8) & 0x00FFFFFF) / static_cast<float>(0x01000000);
+				samples[i] = (rand01 * 2.0f - 1.0f) * 1.5f; // deliberately exceeds [-1, 1]
+			}
+		}
+
+		bool bit_equal(float a, float b)
+		{
+			return ::memcmp(&a, &b, sizeof(float)) == 0;
+		}
+	} // namespace
+
+	TEST_CASE("Unit/Systems/Audio/AudioKernels")
+	{
+		INFO("AudioKernels backend: " << AudioKernels::get_backend_name());
+
+		float a[kCount];
+		float b[kCount];
+		fill_signal(a, kCount, 3u);
+		fill_signal(b, kCount, 11u);
+
+		SECTION("Gain and copy match scalar reference exactly")
+		{
+			float out[kCount];
+			AudioKernels::copy_with_gain(a, out, kCount, 0.37f);
+			for (size_t i = 0; i < kCount; ++i)
+				REQUIRE(bit_equal(out[i], a[i] * 0.37f));
+
+			AudioKernels::apply_gain(out, kCount, 2.0f);
+			for (size_t i = 0; i < kCount; ++i)
+				REQUIRE(bit_equal(out[i], (a[i] * 0.37f) * 2.0f));
+		}
+
+		SECTION("Mix accumulates within tolerance")
+		{
+			float out[kCount];
+			::memcpy(out, b, sizeof(out));
+			AudioKernels::mix_into(a, out, kCount, 0.25f);
+			for (size_t i = 0; i < kCount; ++i)
+				REQUIRE(out[i] == Catch::Approx(b[i] + a[i] * 0.25f).margin(1e-6f));
+		}
+
+		SECTION("Average and clip match scalar reference exactly")
+		{
+			float out[kCount];
+			AudioKernels::average(a, b, out, kCount);
+			for (size_t i = 0; i < kCount; ++i)
+				REQUIRE(bit_equal(out[i], 0.5f * (a[i] + b[i])));
+
+			AudioKernels::clip(out, kCount, -0.5f, 0.75f);
+			for (size_t i = 0; i < kCount; ++i)
+			{
+				const float avg = 0.5f * (a[i] + b[i]);
+				const float expected = avg < -0.5f ? -0.5f : (avg > 0.75f ? 0.75f : avg);
+				REQUIRE(bit_equal(out[i], expected));
+			}
+		}
+
+		SECTION("int16 conversion round-trips and saturates")
+		{
+			int16_t pcm[kCount];
+			AudioKernels::float_to_int16(a, pcm, kCount);
+			for (size_t i = 0; i < kCount; ++i)
+			{
+				const float clamped = a[i] < -1.0f ? -1.0f : (a[i] > 1.0f ? 1.0f : a[i]);
+				REQUIRE(pcm[i] == static_cast<int16_t>(lrintf(clamped * 32767.0f)));
+			}
+
+			float restored[kCount];
+			AudioKernels::int16_to_float(pcm, restored, kCount);
+			for (size_t i = 0; i < kCount; ++i)
+				REQUIRE(bit_equal(restored[i], static_cast<float>(pcm[i]) / 32768.0f));
+
+			const int16_t extremes[5] = {-32768, -1, 0, 1, 32767};
+			float extremes_f[5];
+			AudioKernels::int16_to_float(extremes, extremes_f, 5);
+			CHECK(extremes_f[0] == -1.0f);
+			CHECK(extremes_f[2] == 0.0f);
+			CHECK(extremes_f[4] == Catch::Approx(32767.0f / 32768.0f));
+		}
+
+		SECTION("Stereo interleave, split and mix-down")
+		{
+			float lr[kCount * 2];
+			AudioKernels::interleave_stereo(a, b, lr, kCount);
+			for (size_t i = 0; i < kCount; ++i)
+			{
+				REQUIRE(bit_equal(lr[2 * i], a[i]));
+				REQUIRE(bit_equal(lr[2 * i + 1], b[i]));
+			}
+
+			float left[kCount];
+			float right[kCount];
+			AudioKernels::deinterleave_stereo(lr, left, right, kCount);
+			REQUIRE(::memcmp(left, a, sizeof(left)) == 0);
+			REQUIRE(::memcmp(right, b, sizeof(right)) == 0);
+
+			float mono[kCount];
+			AudioKernels::mix_stereo_to_mono(lr, mono, kCount);
+			for (size_t i = 0; i < kCount; ++i)
+				REQUIRE(bit_equal(mono[i], 0.5f * (a[i] + b[i])));
+
+			AudioKernels::interleave_stereo(nullptr, b, lr, kCount);
+			for (size_t i = 0; i < kCount; ++i)
+			{
+				REQUIRE(lr[2 * i] == 0.0f);
+				REQUIRE(bit_equal(lr[2 * i + 1], b[i]));
+			}
+
+			AudioKernels::duplicate_mono_to_stereo(a, lr, kCount);
+			for (size_t i = 0; i < kCount; ++i)
+			{
+				REQUIRE(bit_equal(lr[2 * i], a[i]));
+				REQUIRE(bit_equal(lr[2 * i + 1], a[i]));
+			}
+		}
+
+		SECTION("Planar interleave for arbitrary channel counts")
+		{
+			float c[kCount];
+			fill_signal(c, kCount, 17u);
+
+			for (size_t num_channels = 1; num_channels <= 5; ++num_channels)
+			{
+				// Channel 1 is left null to check silence handling.
+				const float* planar[5] = {a, nullptr, b, c, a};
+				static float out[kCount * 5];
+				AudioKernels::interleave(planar, num_channels, out, kCount);
+				for (size_t i = 0; i < kCount; ++i)
+				{
+					for (size_t ch = 0; ch < num_channels; ++ch)
+					{
+						const float expected = planar[ch] ? planar[ch][i] : 0.0f;
+						REQUIRE(bit_equal(out[i * num_channels + ch], expected));
+					}
+				}
+			}
+		}
+
+		SECTION("Planar mono fold weights every channel, silent ones included")
+		{
+			float out[kCount];
+
+			// Two active channels: the stereo average, exactly.
+			const float* both[2] = {a, b};
+			AudioKernels::mix_planar_to_mono(both, 2, out, kCount);
+			for (size_t i = 0; i < kCount; ++i)
+				REQUIRE(bit_equal(out[i], 0.5f * (a[i] + b[i])));
+
+			// One active channel of two plays at half level, as before the planar path.
+			const float* left_only[2] = {a, nullptr};
+			AudioKernels::mix_planar_to_mono(left_only, 2, out, kCount);
+			for (size_t i = 0; i < kCount; ++i)
+				REQUIRE(bit_equal(out[i], a[i] * 0.5f));
+
+			// One active channel of four: a quarter.
+			const float* quad[4] = {nullptr, nullptr, b, nullptr};
+			AudioKernels::mix_planar_to_mono(quad, 4, out, kCount);
+			for (size_t i = 0; i < kCount; ++i)
+				REQUIRE(bit_equal(out[i], b[i] * 0.25f));
+
+			// Three of three.
+			const float* three[3] = {a, b, a};
+			AudioKernels::mix_planar_to_mono(three, 3, out, kCount);
+			for (size_t i = 0; i < kCount; ++i)
+				REQUIRE(out[i] == Catch::Approx((2.0f * a[i] + b[i]) / 3.0f).margin(1e-6f));
+
+			const float* silent[2] = {nullptr, nullptr};
+			AudioKernels::mix_planar_to_mono(silent, 2, out, kCount);
+			for (size_t i = 0; i < kCount; ++i)
+				REQUIRE(out[i] == 0.0f);
+		}
+	}
+
+} // namespace robotick::test
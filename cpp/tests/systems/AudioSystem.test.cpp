@@ -5,6 +5,7 @@
 
 #include <catch2/catch_approx.hpp>
 #include <catch2/catch_test_macros.hpp>
+#include <cstring>
 
 namespace robotick::tests
 {
@@ -46,6 +47,42 @@ namespace robotick::tests
 		REQUIRE(result == AudioQueueResult::Error);
 	}
 
+	TEST_CASE("AudioSystem planar write reports error without initialization", "[audio]")
+	{
+		AudioSystem::shutdown();
+		float left = 0.0f;
+		float right = 0.0f;
+		const float* channels[2] = {&left, &right};
+		REQUIRE(AudioSystem::write_planar(channels, 2, 1) == AudioQueueResult::Error);
+		REQUIRE(AudioSystem::write_planar(nullptr, 2, 1) == AudioQueueResult::Error);
+		REQUIRE(::strcmp(AudioSystem::describe_queue_result(AudioQueueResult::Dropped), "dropped") == 0);
+	}
+
+	TEST_CASE("AudioSystem requested device config is sanitized and kept until init", "[audio]")
+	{
+		AudioSystem::shutdown();
+		const AudioDeviceConfig original = AudioSystem::get_requested_config();
+
+		AudioDeviceConfig config;
+		config.sample_rate = 16000;
+		config.buffer_frames = 4;
+		config.output_channels = 12;
+		config.format = AudioSampleFormat::Int16;
+		AudioSystem::set_requested_config(config);
+
+		const AudioDeviceConfig requested = AudioSystem::get_requested_config();
+		CHECK(requested.sample_rate == 16000);
+		CHECK(requested.buffer_frames == 16);
+		CHECK(requested.output_channels == AudioSystem::max_output_channels);
+		CHECK(requested.format == AudioSampleFormat::Int16);
+
+		AudioSystem::set_requested_output_channels(1);
+		CHECK(AudioSystem::get_requested_config().output_channels == 1);
+		CHECK(AudioSystem::get_requested_config().sample_rate == 16000);
+
+		AudioSystem::set_requested_config(original);
+	}
+
 	TEST_CASE("AudioSystem drop stats compute ms from bytes", "[audio]")
 	{
 		AudioSystem::reset_backpressure_stats();
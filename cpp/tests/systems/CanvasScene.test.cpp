@@ -5,11 +5,17 @@
 
 #include <catch2/catch_all.hpp>
 
+#include <cstdio>
+#include <cstring>
+#include <sys/stat.h>
+
 namespace robotick::test
 {
 	namespace
 	{
 		constexpr char kCanvasPath[] = ROBOTICK_CORE_ROOT "/cpp/tests/data/canvas/simple.canvas.yaml";
+		constexpr char kPlotCanvasPath[] = ROBOTICK_CORE_ROOT "/cpp/tests/data/canvas/plot.canvas.yaml";
+		constexpr char kCanvasCacheDir[] = "/tmp/robotick_canvas_cache_test";
 
 		FieldDescriptor* find_field(HeapVector<FieldDescriptor>& fields, const char* name)
 		{
@@ -20,6 +26,36 @@ namespace robotick::test
 			}
 			return nullptr;
 		}
+
+		// Whole-file helpers for corrupting a saved binary scene in place.
+		size_t read_file(const char* path, uint8_t* out, size_t capacity)
+		{
+			FILE* file = ::fopen(path, "rb");
+			if (!file)
+				return 0;
+			const size_t size = ::fread(out, 1, capacity, file);
+			::fclose(file);
+			return size;
+		}
+
+		bool write_file(const char* path, const uint8_t* data, size_t size)
+		{
+			FILE* file = ::fopen(path, "wb");
+			if (!file)
+				return false;
+			const bool ok = ::fwrite(data, 1, size, file) == size;
+			return ::fclose(file) == 0 && ok;
+		}
+
+		uint8_t* find_bytes(uint8_t* data, size_t size, const void* pattern, size_t pattern_size)
+		{
+			for (size_t i = 0; i + pattern_size <= size; ++i)
+			{
+				if (::memcmp(data + i, pattern, pattern_size) == 0)
+					return data + i;
+			}
+			return nullptr;
+		}
 	} // namespace
 
 	TEST_CASE("Unit/Systems/CanvasScene/LoadAndControls")
@@ -71,4 +107,234 @@ namespace robotick::test
 		}
 	}
 
+	TEST_CASE("Unit/Systems/CanvasScene/BinaryCache")
+	{
+		::mkdir(kCanvasCacheDir, 0755);
+		CanvasSceneCacheOptions cache_options;
+		cache_options.cache_dir = kCanvasCacheDir;
+
+		char cache_path[512];
+		REQUIRE(CanvasScene::get_cache_path(kCanvasPath, cache_options, cache_path, sizeof(cache_path)));
+		::remove(cache_path);
+
+		bool cache_hit = true;
+		CanvasScene parsed;
+		REQUIRE(parsed.load_from_file(kCanvasPath, cache_options, &cache_hit));
+		REQUIRE_FALSE(cache_hit);
+
+		CanvasScene cached;
+		REQUIRE(cached.load_from_file(kCanvasPath, cache_options, &cache_hit));
+		REQUIRE(cache_hit);
+
+		SECTION("Cached scene matches the YAML scene")
+		{
+			CHECK(cached.surface().output_width == Catch::Approx(parsed.surface().output_width));
+			CHECK(cached.surface().background.r == parsed.surface().background.r);
+
+			const CanvasNode* blob = cached.find_node("right_eye_blob");
+			REQUIRE(blob != nullptr);
+			CHECK(blob->type == CanvasNodeType::Ellipse);
+			CHECK(blob->has_fill);
+			CHECK(blob->ellipse_ry == Catch::Approx(65.0f));
+
+			const CanvasNode* root = cached.root();
+			REQUIRE(root != nullptr);
+			REQUIRE(root->child_count == 2);
+			CHECK(root->children[1] == cached.find_node("right_eye"));
+		}
+
+		SECTION("Cached scene exposes the same controls")
+		{
+			HeapVector<FieldDescriptor> fields;
+			cached.build_control_field_descriptors(fields);
+			REQUIRE(fields.size() == 4);
+
+			Blackboard controls;
+			controls.initialize_fields(fields);
+			cached.bind_control_fields(fields);
+			cached.set_control_defaults(controls);
+
+			FieldDescriptor* right_eye_translate = find_field(fields, "right_eye_translate");
+			REQUIRE(right_eye_translate != nullptr);
+			CHECK(controls.get<Vec2f>(*right_eye_translate).x == Catch::Approx(260.0f));
+
+			controls.set<Vec2f>(*right_eye_translate, Vec2f(10.0f, 20.0f));
+			cached.apply_control_values(controls);
+			CHECK(cached.find_node("right_eye")->translate.y == Catch::Approx(20.0f));
+		}
+
+		SECTION("A binary scene file loads directly")
+		{
+			CanvasScene direct;
+			REQUIRE(direct.load_from_file(cache_path));
+			REQUIRE(direct.find_node("left_eye_blob") != nullptr);
+		}
+
+		SECTION("A cache built from different YAML content is ignored")
+		{
+			REQUIRE(parsed.save_binary(cache_path, CanvasScene::compute_source_key(kCanvasPath) + 1));
+
+			CanvasScene rebuilt;
+			REQUIRE(rebuilt.load_from_file(kCanvasPath, cache_options, &cache_hit));
+			REQUIRE_FALSE(cache_hit);
+		}
+	}
+
+	TEST_CASE("Unit/Systems/CanvasScene/CorruptBinary")
+	{
+		::mkdir(kCanvasCacheDir, 0755);
+		const char* binary_path = "/tmp/robotick_canvas_cache_test/corrupt.canvasb";
+
+		CanvasScene parsed;
+		REQUIRE(parsed.load_from_file(kCanvasPath));
+		REQUIRE(parsed.save_binary(binary_path, 0));
+
+		static uint8_t blob[16384];
+		const size_t size = read_file(binary_path, blob, sizeof(blob));
+		REQUIRE(size > 0);
+		REQUIRE(size < sizeof(blob));
+
+		{
+			CanvasScene intact;
+			REQUIRE(intact.load_from_file(binary_path));
+		}
+
+		SECTION("A node claimed by two parents is rejected")
+		{
+			// Child links in pre-order: root -> {left_eye, right_eye}, left_eye -> left_eye_blob, right_eye -> right_eye_blob.
+			const uint32_t links[] = {1, 3, 2, 4};
+			uint8_t* link_table = find_bytes(blob, size, links, sizeof(links));
+			REQUIRE(link_table != nullptr);
+
+			// The root now also claims left_eye_blob, leaving right_eye without a parent. Every index still points forward.
+			const uint32_t corrupted[] = {1, 2, 2, 4};
+			::memcpy(link_table, corrupted, sizeof(corrupted));
+			REQUIRE(write_file(binary_path, blob, size));
+
+			CanvasScene scene;
+			CHECK_FALSE(scene.load_from_file(binary_path));
+			CHECK(scene.root() == nullptr);
+		}
+
+		SECTION("A duplicate node id is rejected")
+		{
+			uint8_t* id = find_bytes(blob, size, "right_eye_blob", 14);
+			REQUIRE(id != nullptr);
+			::memcpy(id, "left_eye_blob", 14); // includes the terminator
+
+			REQUIRE(write_file(binary_path, blob, size));
+			CanvasScene scene;
+			CHECK_FALSE(scene.load_from_file(binary_path));
+		}
+
+		::remove(binary_path);
+	}
+
+	TEST_CASE("Unit/Systems/CanvasScene/Plot")
+	{
+		CanvasScene scene;
+		REQUIRE(scene.load_from_file(kPlotCanvasPath));
+
+		HeapVector<FieldDescriptor> fields;
+		scene.build_control_field_descriptors(fields);
+
+		Blackboard controls;
+		controls.initialize_fields(fields);
+		scene.bind_control_fields(fields);
+		scene.set_control_defaults(controls);
+
+		FieldDescriptor* speed_sample = find_field(fields, "speed_sample");
+		FieldDescriptor* battery_history = find_field(fields, "battery_history");
+		REQUIRE(speed_sample != nullptr);
+		REQUIRE(battery_history != nullptr);
+		CHECK(speed_sample->type_id == GET_TYPE_ID(float));
+		CHECK(battery_history->type_id == GET_TYPE_ID(CanvasPlotSamples));
+
+		const CanvasNode* speed = scene.find_node("speed");
+		const CanvasNode* battery = scene.find_node("battery");
+		REQUIRE(speed != nullptr);
+		REQUIRE(battery != nullptr);
+		CHECK(speed->type == CanvasNodeType::Plot);
+		CHECK(speed->plot.capacity == 4);
+		CHECK(speed->plot.count == 0);
+		CHECK(battery->plot.mode == CanvasPlotMode::Area);
+
+		SECTION("Pushed samples fill the ring and wrap oldest-first")
+		{
+			for (int i = 1; i <= 6; ++i)
+			{
+				controls.set<float>(*speed_sample, static_cast<float>(i));
+				scene.apply_control_values(controls);
+			}
+
+			REQUIRE(speed->plot.count == 4);
+			CHECK(speed->plot.sample(0) == Catch::Approx(3.0f));
+			CHECK(speed->plot.sample(3) == Catch::Approx(6.0f));
+		}
+
+		SECTION("A samples control replaces the whole history")
+		{
+			CanvasPlotSamples history;
+			history.samples.add(0.5f);
+			history.samples.add(-0.25f);
+			controls.set<CanvasPlotSamples>(*battery_history, history);
+			scene.apply_control_values(controls);
+			scene.apply_control_values(controls);
+
+			REQUIRE(battery->plot.count == 2);
+			CHECK(battery->plot.sample(0) == Catch::Approx(0.5f));
+			CHECK(battery->plot.sample(1) == Catch::Approx(-0.25f));
+		}
+
+		SECTION("An append control takes each chunk once, by sequence")
+		{
+			FieldDescriptor* trace_chunk = find_field(fields, "trace_chunk");
+			const CanvasNode* trace = scene.find_node("trace");
+			REQUIRE(trace_chunk != nullptr);
+			REQUIRE(trace != nullptr);
+			CHECK(trace_chunk->type_id == GET_TYPE_ID(CanvasPlotSamples));
+
+			// Defaults (sequence 0) append nothing.
+			scene.apply_control_values(controls);
+			CHECK(trace->plot.count == 0);
+
+			CanvasPlotSamples chunk;
+			chunk.sequence = 1;
+			chunk.samples.add(1.0f);
+			chunk.samples.add(2.0f);
+			controls.set<CanvasPlotSamples>(*trace_chunk, chunk);
+
+			// A producer holding its output across canvas ticks must not duplicate samples.
+			scene.apply_control_values(controls);
+			scene.apply_control_values(controls);
+			REQUIRE(trace->plot.count == 2);
+
+			chunk.sequence = 2;
+			chunk.samples.clear();
+			chunk.samples.add(3.0f);
+			controls.set<CanvasPlotSamples>(*trace_chunk, chunk);
+			scene.apply_control_values(controls);
+
+			REQUIRE(trace->plot.count == 3);
+			CHECK(trace->plot.sample(0) == Catch::Approx(1.0f));
+			CHECK(trace->plot.sample(2) == Catch::Approx(3.0f));
+		}
+
+		SECTION("Plot configuration survives the binary cache")
+		{
+			::mkdir(kCanvasCacheDir, 0755);
+			const char* binary_path = "/tmp/robotick_canvas_cache_test/plot.canvasb";
+			REQUIRE(scene.save_binary(binary_path, CanvasScene::compute_source_key(kPlotCanvasPath)));
+
+			CanvasScene loaded;
+			REQUIRE(loaded.load_from_file(binary_path));
+			const CanvasNode* loaded_battery = loaded.find_node("battery");
+			REQUIRE(loaded_battery != nullptr);
+			CHECK(loaded_battery->plot.capacity == 8);
+			CHECK(loaded_battery->plot.value_min == Catch::Approx(-1.0f));
+			CHECK(loaded_battery->plot.mode == CanvasPlotMode::Area);
+			CHECK(loaded_battery->plot.count == 0);
+		}
+	}
+
 } // namespace robotick::test
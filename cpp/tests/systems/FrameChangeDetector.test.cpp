@@ -0,0 +1,79 @@
+// Copyright Robotick contributors
+// SPDX-License-Identifier: Apache-2.0
+
+#include "robotick/systems/FrameChangeDetector.h"
+
+#include <catch2/catch_all.hpp>
+
+#include <cstring>
+
+namespace robotick::test
+{
+	namespace
+	{
+		constexpr int kWidth = 64;
+		constexpr int kHeight = 48;
+		constexpr size_t kStride = kWidth * 3;
+
+		void fill_bgr(uint8_t* pixels, uint8_t value)
+		{
+			::memset(pixels, value, kStride * kHeight);
+		}
+	} // namespace
+
+	TEST_CASE("Unit/Systems/FrameChangeDetector")
+	{
+		static uint8_t frame[kStride * kHeight];
+		FrameChangeDetector detector;
+
+		fill_bgr(frame, 100);
+		CHECK(detector.measure_bgr888(frame, kWidth, kHeight, kStride) == Catch::Approx(255.0f));
+		detector.accept();
+		REQUIRE(detector.has_reference());
+
+		SECTION("An identical frame scores zero")
+		{
+			CHECK(detector.measure_bgr888(frame, kWidth, kHeight, kStride) == Catch::Approx(0.0f));
+		}
+
+		SECTION("A uniform brightness change scores its luma difference")
+		{
+			fill_bgr(frame, 110);
+			CHECK(detector.measure_bgr888(frame, kWidth, kHeight, kStride) == Catch::Approx(10.0f).margin(1.0f));
+		}
+
+		SECTION("The reference only moves on accept, so small steps accumulate")
+		{
+			fill_bgr(frame, 101);
+			const float first_step = detector.measure_bgr888(frame, kWidth, kHeight, kStride);
+			fill_bgr(frame, 104);
+			const float second_step = detector.measure_bgr888(frame, kWidth, kHeight, kStride);
+			CHECK(second_step > first_step);
+
+			detector.accept();
+			CHECK(detector.measure_bgr888(frame, kWidth, kHeight, kStride) == Catch::Approx(0.0f));
+		}
+
+		SECTION("A local change is seen through the sampling grid")
+		{
+			// Paint the left half white.
+			for (int y = 0; y < kHeight; ++y)
+				::memset(frame + static_cast<size_t>(y) * kStride, 255, kStride / 2);
+			const float score = detector.measure_bgr888(frame, kWidth, kHeight, kStride);
+			CHECK(score == Catch::Approx(0.5f * (255.0f - 100.0f)).margin(2.0f));
+		}
+
+		SECTION("RGB565 frames score like their BGR equivalent")
+		{
+			static uint8_t rgb565[kWidth * kHeight * 2];
+			FrameChangeDetector rgb_detector;
+			::memset(rgb565, 0, sizeof(rgb565));
+			rgb_detector.measure_rgb565_be(rgb565, kWidth, kHeight, kWidth * 2);
+			rgb_detector.accept();
+
+			::memset(rgb565, 0xFF, sizeof(rgb565));
+			CHECK(rgb_detector.measure_rgb565_be(rgb565, kWidth, kHeight, kWidth * 2) > 240.0f);
+		}
+	}
+
+} // namespace robotick::test
@@ -0,0 +1,166 @@
+// Copyright Robotick contributors
+// SPDX-License-Identifier: Apache-2.0
+
+#include "robotick/systems/ImageFramePool.h"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstring>
+
+namespace robotick::tests
+{
+	namespace
+	{
+		ImageHandle publish_bytes(ImageFramePool& pool, const char* text)
+		{
+			uint8_t* data = pool.begin_write();
+			REQUIRE(data != nullptr);
+			const size_t size = ::strlen(text);
+			::memcpy(data, text, size);
+			return pool.publish(size, ImageFormat::Jpeg, 4, 2);
+		}
+	} // namespace
+
+	TEST_CASE("Unit/Systems/ImageFramePool")
+	{
+		ImageFramePool* pool = ImageFramePoolRegistry::get().acquire("test_frames", 3, 16);
+		REQUIRE(pool != nullptr);
+		REQUIRE(pool->get_slot_count() == 3);
+
+		SECTION("Readers see the published frame in place")
+		{
+			const ImageHandle handle = publish_bytes(*pool, "frame-a");
+			REQUIRE(handle.is_valid());
+			CHECK(handle.format == ImageFormat::Jpeg);
+			CHECK(handle.width == 4);
+
+			ImageFramePool* by_handle = ImageFramePoolRegistry::get().acquire(handle);
+			CHECK(by_handle == pool);
+			CHECK(ImageFramePoolRegistry::get().get_ref_count("test_frames") == 2);
+			ImageFramePoolRegistry::get().release(by_handle);
+
+			const ImageFrameView view = pool->acquire(handle);
+			REQUIRE(view.is_valid());
+			REQUIRE(view.size == 7);
+			CHECK(::memcmp(view.data, "frame-a", 7) == 0);
+			CHECK(pool->get_ref_count(handle) == 2);
+
+			pool->release(view);
+			CHECK(pool->get_ref_count(handle) == 1);
+		}
+
+		SECTION("Unheld frames are recycled and their old handles go stale")
+		{
+			const ImageHandle first = publish_bytes(*pool, "one");
+			publish_bytes(*pool, "two");
+			publish_bytes(*pool, "three");
+			publish_bytes(*pool, "four");
+
+			CHECK_FALSE(pool->acquire(first).is_valid());
+			CHECK(pool->get_free_slot_count() == 2);
+		}
+
+		SECTION("Free slots are reused round-robin, so an unheld handle outlives slot_count - 1 further frames")
+		{
+			ImageHandle previous = publish_bytes(*pool, "f0");
+			ImageHandle current = publish_bytes(*pool, "f1");
+			for (int i = 2; i < 10; ++i)
+			{
+				const ImageHandle next = publish_bytes(*pool, "fn");
+
+				// previous was superseded two frames ago and is unheld; reusing the lowest free slot would have
+				// recycled it by now.
+				const ImageFrameView view = pool->acquire(previous);
+				CHECK(view.is_valid());
+				pool->release(view);
+
+				previous = current;
+				current = next;
+			}
+		}
+
+		SECTION("A held frame survives until released, and a full pool refuses writes")
+		{
+			const ImageHandle held_a = publish_bytes(*pool, "a");
+			const ImageFrameView view_a = pool->acquire(held_a);
+			const ImageHandle held_b = publish_bytes(*pool, "b");
+			const ImageFrameView view_b = pool->acquire(held_b);
+			publish_bytes(*pool, "c");
+
+			// a and b are held by readers, c is the latest: nothing left to write into.
+			CHECK(pool->begin_write() == nullptr);
+			CHECK(::memcmp(view_a.data, "a", 1) == 0);
+
+			pool->release(view_a);
+			uint8_t* data = pool->begin_write();
+			REQUIRE(data != nullptr);
+			pool->cancel_write();
+
+			pool->release(view_b);
+			CHECK(pool->get_free_slot_count() == 2);
+		}
+
+		SECTION("Pools are shared by name and checked against frame size")
+		{
+			CHECK(ImageFramePoolRegistry::get().acquire("test_frames", 3, 64) == nullptr);
+
+			ImageFramePool* same = ImageFramePoolRegistry::get().acquire("test_frames", 3, 8);
+			CHECK(same == pool);
+			CHECK(ImageFramePoolRegistry::get().get_ref_count("test_frames") == 2);
+			ImageFramePoolRegistry::get().release(same);
+		}
+
+		SECTION("Handles from a released pool are not resolved by its successor")
+		{
+			const ImageHandle old_handle = publish_bytes(*pool, "old");
+			ImageFramePoolRegistry::get().release(pool);
+			CHECK(ImageFramePoolRegistry::get().acquire(old_handle) == nullptr);
+
+			pool = ImageFramePoolRegistry::get().acquire("test_frames", 3, 16);
+			REQUIRE(pool != nullptr);
+			publish_bytes(*pool, "new");
+			CHECK_FALSE(pool->acquire(old_handle).is_valid());
+		}
+
+		SECTION("A reader's frame outlives the producer releasing the pool")
+		{
+			const ImageHandle handle = publish_bytes(*pool, "kept");
+
+			ScopedImageFrame frame(handle);
+			REQUIRE(frame.is_valid());
+			CHECK(ImageFramePoolRegistry::get().get_ref_count("test_frames") == 2);
+
+			ImageFramePoolRegistry::get().release(pool);
+			pool = nullptr;
+
+			// Still referenced by the reader, so neither the pool nor the frame's bytes have gone.
+			CHECK(ImageFramePoolRegistry::get().get_ref_count("test_frames") == 1);
+			REQUIRE(frame.size() == 4);
+			CHECK(::memcmp(frame.data(), "kept", 4) == 0);
+
+			frame.reset();
+			CHECK_FALSE(frame.is_valid());
+			CHECK(ImageFramePoolRegistry::get().get_ref_count("test_frames") == 0);
+			CHECK_FALSE(ScopedImageFrame(handle).is_valid());
+		}
+
+		SECTION("ScopedImageFrame releases its frame when moved to another")
+		{
+			const ImageHandle first = publish_bytes(*pool, "one");
+			ScopedImageFrame frame(first);
+			CHECK(pool->get_ref_count(first) == 2);
+
+			const ImageHandle second = publish_bytes(*pool, "two");
+			CHECK(pool->get_ref_count(first) == 1); // only the reader holds the superseded frame
+
+			REQUIRE(frame.reset(second));
+			CHECK(pool->get_ref_count(first) == 0);
+			CHECK(pool->get_ref_count(second) == 2);
+			CHECK(ImageFramePoolRegistry::get().get_ref_count("test_frames") == 2);
+		}
+
+		ImageFramePoolRegistry::get().release(pool);
+		CHECK(ImageFramePoolRegistry::get().get_ref_count("test_frames") == 0);
+	}
+
+} // namespace robotick::tests
@@ -54,4 +54,31 @@ namespace robotick::tests
 		SUCCEED("QoS helpers only available in test builds");
 #endif
 	}
+
+	TEST_CASE("MqttClient store-and-forward holds the latest value per topic while offline", "[mqtt]")
+	{
+		// Nothing listens on port 1, so the client stays disconnected.
+		MqttClient client("mqtt://127.0.0.1:1", "test-store-and-forward");
+		client.set_store_and_forward(2, 4);
+
+		CHECK(client.publish("robotick/state/a", "1") == MqttOpResult::Queued);
+		CHECK(client.publish("robotick/state/a", "2") == MqttOpResult::Queued);
+		CHECK(client.publish("robotick/state/b", "3") == MqttOpResult::Queued);
+
+		const MqttClient::BackpressureStats& stats = client.get_backpressure_stats();
+		CHECK(stats.queued_publishes == 3);
+		CHECK(stats.coalesced_publishes == 1);
+		CHECK(stats.pending_publishes == 2);
+		CHECK(stats.publish_drops == 0);
+
+		// Full outbox: a new topic is dropped, an already-held one is still updated
+		CHECK(client.publish("robotick/state/c", "4") == MqttOpResult::Dropped);
+		CHECK(client.publish("robotick/state/b", "5") == MqttOpResult::Queued);
+		CHECK(stats.publish_drops == 1);
+		CHECK(stats.pending_publishes == 2);
+
+		// Non-retained messages are events, not latest values - they are never held
+		CHECK(client.publish("robotick/event", "x", false) == MqttOpResult::Dropped);
+		CHECK(stats.pending_publishes == 2);
+	}
 } // namespace robotick::tests
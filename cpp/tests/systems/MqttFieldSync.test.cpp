@@ -10,7 +10,6 @@
 #include "robotick/framework/utils/WorkloadFieldsIterator.h"
 
 #include <catch2/catch_all.hpp>
-#include <nlohmann/json.hpp>
 #include <cstring>
 
 namespace robotick::test
@@ -61,6 +60,7 @@ namespace robotick::test
 			Map<FixedString256, FixedString256, 128> retained;
 			MqttOpResult subscribe_result = MqttOpResult::Success;
 			Function<MqttOpResult(const char*, const char*)> publish_override;
+			Function<void(const char*, const char*)> on_message;
 
 			bool connect() override { return true; }
 			MqttOpResult subscribe(const char* /*topic*/, int /*qos*/ = 1) override { return subscribe_result; }
@@ -91,7 +91,7 @@ namespace robotick::test
 
 			void clear_retained() { retained.clear(); }
 
-			void set_callback(Function<void(const char*, const char*)>) override {}
+			void set_callback(Function<void(const char*, const char*)> fn) override { on_message = robotick::move(fn); }
 
 			void set_publish_override(Function<MqttOpResult(const char*, const char*)> fn) { publish_override = robotick::move(fn); }
 			void set_subscribe_result(MqttOpResult result) { subscribe_result = result; }
@@ -253,10 +253,8 @@ namespace robotick::test
 			FixedString64 root_topic_name = "robotick";
 			MqttFieldSync sync(engine, root_topic_name.c_str(), dummy_client);
 
-			nlohmann::json json_val = 99;
-			nlohmann::json json_subint = 5;
-			sync.queue_control_topic("robotick/control/W2/inputs/value", json_val);
-			sync.queue_control_topic("robotick/control/W2/inputs/blackboard/flag", json_subint);
+			sync.queue_control_topic("robotick/control/W2/inputs/value", "99");
+			sync.queue_control_topic("robotick/control/W2/inputs/blackboard/flag", "5");
 
 			sync.apply_control_updates();
 
@@ -266,6 +264,120 @@ namespace robotick::test
 			CHECK(val == 99);
 			CHECK(flag == 5);
 		}
+
+		SECTION("MqttFieldSync decodes typed control payloads")
+		{
+			Model model;
+			static const WorkloadSeed* const workloads[] = {&test_workload_w2_tick};
+			model.use_workload_seeds(workloads);
+			model.set_root_workload(test_workload_w2_tick);
+
+			Engine engine;
+			engine.load(model);
+
+			const auto& info = *engine.find_instance_info(test_workload_w2_tick.unique_name);
+			auto* test_workload_ptr = static_cast<TestWorkload*>((void*)info.get_ptr(engine));
+
+			DummyMqttClient dummy_client;
+			MqttFieldSync sync(engine, "robotick", dummy_client);
+
+			sync.queue_control_topic("robotick/control/W2/inputs/text", "\"say \\\"hi\\\"\\n\"");
+			sync.queue_control_topic("robotick/control/W2/inputs/blackboard/ratio", "0.25");
+			sync.queue_control_topic("robotick/control/W2/inputs/value", "12.0");
+			sync.apply_control_updates();
+
+			CHECK(::strcmp(test_workload_ptr->inputs.text.c_str(), "say \"hi\"\n") == 0);
+			CHECK(test_workload_ptr->inputs.blackboard.get<double>("ratio") == 0.25);
+			CHECK(test_workload_ptr->inputs.value == 12);
+
+			// Malformed or mistyped payloads leave the field untouched
+			sync.queue_control_topic("robotick/control/W2/inputs/value", "12.5");
+			sync.queue_control_topic("robotick/control/W2/inputs/text", "unquoted");
+			sync.apply_control_updates();
+
+			CHECK(test_workload_ptr->inputs.value == 12);
+			CHECK(::strcmp(test_workload_ptr->inputs.text.c_str(), "say \"hi\"\n") == 0);
+		}
+
+		SECTION("MqttFieldSync ignores echoes of its own control publishes")
+		{
+			Model model;
+			static const WorkloadSeed* const workloads[] = {&test_workload_w2_tick};
+			model.use_workload_seeds(workloads);
+			model.set_root_workload(test_workload_w2_tick);
+
+			Engine engine;
+			engine.load(model);
+
+			const auto& info = *engine.find_instance_info(test_workload_w2_tick.unique_name);
+			auto* test_workload_ptr = static_cast<TestWorkload*>((void*)info.get_ptr(engine));
+
+			DummyMqttClient dummy_client;
+			MqttFieldSync sync(engine, "robotick", dummy_client);
+			sync.subscribe_and_sync_startup();
+			REQUIRE(dummy_client.on_message);
+
+			// The echo is dropped, so a local change made meanwhile is not overwritten by the stale value
+			test_workload_ptr->inputs.value = 8;
+			dummy_client.on_message("robotick/control/W2/inputs/value", "7");
+			sync.apply_control_updates();
+			CHECK(test_workload_ptr->inputs.value == 8);
+
+			dummy_client.on_message("robotick/control/W2/inputs/value", "3");
+			dummy_client.on_message("robotick/state/W2/inputs/value", "4");
+			sync.apply_control_updates();
+			CHECK(test_workload_ptr->inputs.value == 3);
+		}
+
+		SECTION("MqttFieldSync skips topics and payloads too long to keep whole")
+		{
+			Model model;
+			static const WorkloadSeed* const workloads[] = {&test_workload_w2_tick};
+			model.use_workload_seeds(workloads);
+			model.set_root_workload(test_workload_w2_tick);
+
+			Engine engine;
+			engine.load(model);
+
+			const auto& info = *engine.find_instance_info(test_workload_w2_tick.unique_name);
+			auto* test_workload_ptr = static_cast<TestWorkload*>((void*)info.get_ptr(engine));
+
+			DummyMqttClient dummy_client;
+			MqttFieldSync sync(engine, "robotick", dummy_client);
+
+			// 1100 chars: a truncated copy would be an unterminated string, so the control is dropped whole
+			static char long_payload[1104];
+			long_payload[0] = '"';
+			::memset(long_payload + 1, 'a', 1100);
+			long_payload[1101] = '"';
+			long_payload[1102] = '\0';
+
+			sync.queue_control_topic("robotick/control/W2/inputs/text", long_payload);
+			sync.queue_control_topic("robotick/control/W2/inputs/value", "5");
+			sync.apply_control_updates();
+			CHECK(sync.get_metrics().oversize_skips == 1);
+			CHECK(::strcmp(test_workload_ptr->inputs.text.c_str(), "abc") == 0);
+			CHECK(test_workload_ptr->inputs.value == 5);
+
+			// A root this long leaves no room for any field path within a topic key
+			static char long_root[241];
+			::memset(long_root, 'r', 240);
+			long_root[240] = '\0';
+
+			DummyMqttClient long_root_client;
+			uint32_t publish_count = 0;
+			long_root_client.set_publish_override(
+				[&](const char*, const char*) -> MqttOpResult
+				{
+					publish_count++;
+					return MqttOpResult::Success;
+				});
+
+			MqttFieldSync long_root_sync(engine, long_root, long_root_client);
+			long_root_sync.publish_fields(engine, engine.get_workloads_buffer(), true);
+			CHECK(long_root_sync.get_metrics().oversize_skips > 0);
+			CHECK(publish_count == 0);
+		}
 	}
 
 } // namespace robotick::test
@@ -0,0 +1,133 @@
+// Copyright Robotick contributors
+// SPDX-License-Identifier: Apache-2.0
+
+#include "robotick/systems/MuJoCoModelCache.h"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstdio>
+#include <cstring>
+#include <sys/stat.h>
+
+#if defined(ROBOTICK_PLATFORM_DESKTOP) || defined(ROBOTICK_PLATFORM_LINUX)
+#include <mujoco/mujoco.h>
+#endif
+
+namespace robotick::tests
+{
+	namespace
+	{
+		constexpr char kCacheTestDir[] = "/tmp/robotick_mujoco_model_cache_test";
+
+		void write_text(const char* path, const char* text)
+		{
+			FILE* file = ::fopen(path, "wb");
+			REQUIRE(file != nullptr);
+			::fputs(text, file);
+			::fclose(file);
+		}
+
+		// Model that pulls in a body via <include> and a mesh via <compiler meshdir>.
+		void write_test_model()
+		{
+			::mkdir(kCacheTestDir, 0755);
+			::mkdir("/tmp/robotick_mujoco_model_cache_test/meshes", 0755);
+			write_text("/tmp/robotick_mujoco_model_cache_test/model.xml",
+				"<mujoco model=\"cache_test\">\n"
+				"  <compiler meshdir=\"meshes\"/>\n"
+				"  <!-- <mesh file=\"commented_out.stl\"/> -->\n"
+				"  <asset><mesh name=\"part\" file=\"part.stl\"/></asset>\n"
+				"  <worldbody><include file=\"body.xml\"/></worldbody>\n"
+				"</mujoco>\n");
+			write_text("/tmp/robotick_mujoco_model_cache_test/body.xml", "<mujoco><body name=\"b\"/></mujoco>\n");
+			write_text("/tmp/robotick_mujoco_model_cache_test/meshes/part.stl", "mesh v1");
+		}
+	} // namespace
+
+	TEST_CASE("Unit/Systems/MuJoCoModelCache/ContentKey")
+	{
+		write_test_model();
+		const char* model_path = "/tmp/robotick_mujoco_model_cache_test/model.xml";
+
+		const uint64_t key = MuJoCoModelCache::compute_content_key(model_path);
+		REQUIRE(key != 0);
+		REQUIRE(MuJoCoModelCache::compute_content_key(model_path) == key);
+		REQUIRE(MuJoCoModelCache::compute_content_key("/tmp/robotick_mujoco_model_cache_test/missing.xml") == 0);
+
+		SECTION("Editing a mesh referenced through meshdir changes the key")
+		{
+			write_text("/tmp/robotick_mujoco_model_cache_test/meshes/part.stl", "mesh v2");
+			REQUIRE(MuJoCoModelCache::compute_content_key(model_path) != key);
+		}
+
+		SECTION("Editing an included file changes the key")
+		{
+			write_text("/tmp/robotick_mujoco_model_cache_test/body.xml", "<mujoco><body name=\"renamed\"/></mujoco>\n");
+			REQUIRE(MuJoCoModelCache::compute_content_key(model_path) != key);
+		}
+
+		SECTION("Files only named inside comments are ignored")
+		{
+			write_text("/tmp/robotick_mujoco_model_cache_test/meshes/commented_out.stl", "unused");
+			REQUIRE(MuJoCoModelCache::compute_content_key(model_path) == key);
+		}
+	}
+
+	TEST_CASE("Unit/Systems/MuJoCoModelCache/CachePaths")
+	{
+		char mjb_path[512];
+		char key_path[512];
+
+		MuJoCoModelCacheOptions beside_model;
+		REQUIRE(MuJoCoModelCache::get_cache_paths("/models/robot.xml", beside_model, mjb_path, sizeof(mjb_path), key_path, sizeof(key_path)));
+		REQUIRE(::strcmp(mjb_path, "/models/robot.xml.mjb") == 0);
+		REQUIRE(::strcmp(key_path, "/models/robot.xml.mjb.key") == 0);
+
+		MuJoCoModelCacheOptions shared_dir;
+		shared_dir.cache_dir = "/cache";
+		char other_mjb_path[512];
+		REQUIRE(MuJoCoModelCache::get_cache_paths("/models/a/robot.xml", shared_dir, mjb_path, sizeof(mjb_path), key_path, sizeof(key_path)));
+		REQUIRE(MuJoCoModelCache::get_cache_paths("/models/b/robot.xml", shared_dir, other_mjb_path, sizeof(other_mjb_path), key_path, sizeof(key_path)));
+		REQUIRE(::strncmp(mjb_path, "/cache/robot.xml.", 17) == 0);
+		REQUIRE(::strcmp(mjb_path, other_mjb_path) != 0);
+
+		char tiny[8];
+		REQUIRE_FALSE(MuJoCoModelCache::get_cache_paths("/models/robot.xml", beside_model, tiny, sizeof(tiny), key_path, sizeof(key_path)));
+	}
+
+#if defined(ROBOTICK_PLATFORM_DESKTOP) || defined(ROBOTICK_PLATFORM_LINUX)
+	TEST_CASE("Unit/Systems/MuJoCoModelCache/LoadHitsCacheOnSecondLoad")
+	{
+		::mkdir(kCacheTestDir, 0755);
+		const char* model_path = "/tmp/robotick_mujoco_model_cache_test/minimal.xml";
+		write_text(model_path,
+			"<mujoco model=\"minimal\">\n"
+			"  <option timestep=\"0.001\"/>\n"
+			"  <worldbody/>\n"
+			"</mujoco>\n");
+
+		MuJoCoModelCacheOptions options;
+		options.cache_dir = "/tmp/robotick_mujoco_model_cache_test/cache";
+
+		char mjb_path[512];
+		char key_path[512];
+		REQUIRE(MuJoCoModelCache::get_cache_paths(model_path, options, mjb_path, sizeof(mjb_path), key_path, sizeof(key_path)));
+		::remove(key_path);
+
+		char error[512] = {0};
+		bool cache_hit = true;
+		mjModel* compiled = MuJoCoModelCache::load(model_path, options, error, sizeof(error), &cache_hit);
+		REQUIRE(compiled != nullptr);
+		REQUIRE_FALSE(cache_hit);
+
+		mjModel* cached = MuJoCoModelCache::load(model_path, options, error, sizeof(error), &cache_hit);
+		REQUIRE(cached != nullptr);
+		REQUIRE(cache_hit);
+		REQUIRE(cached->opt.timestep == compiled->opt.timestep);
+
+		mj_deleteModel(compiled);
+		mj_deleteModel(cached);
+	}
+#endif
+
+} // namespace robotick::tests
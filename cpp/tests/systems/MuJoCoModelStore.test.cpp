@@ -0,0 +1,81 @@
+// Copyright Robotick contributors
+// SPDX-License-Identifier: Apache-2.0
+
+#include "robotick/systems/MuJoCoModelStore.h"
+#include "robotick/systems/MuJoCoPhysics.h"
+
+#include <catch2/catch_test_macros.hpp>
+
+#if defined(ROBOTICK_PLATFORM_DESKTOP) || defined(ROBOTICK_PLATFORM_LINUX)
+#include <mujoco/mujoco.h>
+#endif
+
+namespace robotick::tests
+{
+#if defined(ROBOTICK_PLATFORM_DESKTOP) || defined(ROBOTICK_PLATFORM_LINUX)
+	namespace
+	{
+		constexpr char kMinimalModelPath[] = ROBOTICK_CORE_ROOT "/cpp/tests/data/mujoco/minimal.xml";
+	} // namespace
+
+	TEST_CASE("Unit/Systems/MuJoCoModelStore")
+	{
+		MuJoCoModelStore& store = MuJoCoModelStore::get();
+		const uint32_t models_before = store.get_num_models();
+
+		SECTION("Instances loading the same model share it and keep their own data")
+		{
+			MuJoCoPhysics first;
+			MuJoCoPhysics second;
+			REQUIRE(first.load_shared_from_xml(kMinimalModelPath));
+			REQUIRE(second.load_shared_from_xml(kMinimalModelPath));
+
+			REQUIRE(first.is_model_shared());
+			REQUIRE(first.model() == second.model());
+			REQUIRE(first.data() != second.data());
+			REQUIRE(store.get_ref_count(first.model()) == 2);
+			REQUIRE(store.get_num_models() == models_before + 1);
+
+			first.unload();
+			REQUIRE(store.get_ref_count(second.model()) == 1);
+			second.unload();
+			REQUIRE(store.get_num_models() == models_before);
+		}
+
+		SECTION("Matching timesteps stay shared, a different one gets a private copy")
+		{
+			MuJoCoPhysics first;
+			MuJoCoPhysics second;
+			MuJoCoPhysics third;
+			REQUIRE(first.load_shared_from_xml(kMinimalModelPath));
+			REQUIRE(second.load_shared_from_xml(kMinimalModelPath));
+			REQUIRE(third.load_shared_from_xml(kMinimalModelPath));
+
+			first.set_timestep(0.002);
+			second.set_timestep(0.002);
+			REQUIRE(first.model() == second.model());
+			REQUIRE(second.is_model_shared());
+
+			third.set_timestep(0.004);
+			REQUIRE_FALSE(third.is_model_shared());
+			REQUIRE(third.model() != first.model());
+			REQUIRE(third.model()->opt.timestep == 0.004);
+			REQUIRE(first.model()->opt.timestep == 0.002);
+			REQUIRE(store.get_ref_count(first.model()) == 2);
+
+			third.step();
+		}
+
+		SECTION("Unshared loads are unaffected")
+		{
+			MuJoCoPhysics physics;
+			REQUIRE(physics.load_from_xml(kMinimalModelPath));
+			REQUIRE_FALSE(physics.is_model_shared());
+			REQUIRE(store.get_ref_count(physics.model()) == 0);
+		}
+
+		REQUIRE(store.get_num_models() == models_before);
+	}
+#endif
+
+} // namespace robotick::tests
@@ -13,6 +13,10 @@
 #include <opencv2/imgcodecs.hpp>
 #include <opencv2/imgproc.hpp>
 
+#if defined(ROBOTICK_PLATFORM_DESKTOP) || defined(ROBOTICK_PLATFORM_LINUX)
+#include <mujoco/mujoco.h>
+#endif
+
 namespace robotick::tests
 {
 #if defined(ROBOTICK_PLATFORM_DESKTOP) || defined(ROBOTICK_PLATFORM_LINUX)
@@ -22,6 +26,8 @@ namespace robotick::tests
 		constexpr char kMinimalModelPath[] = ROBOTICK_CORE_ROOT "/cpp/tests/data/mujoco/minimal.xml";
 		// Scene that clears to a solid blue background; used to validate GL render output colour.
 		constexpr char kBlueBackgroundModelPath[] = ROBOTICK_CORE_ROOT "/cpp/tests/data/mujoco/blue_background.xml";
+		// Box whose top face is 1.75 m below a downward camera, with a second geom ahead of it in the model.
+		constexpr char kDepthTargetModelPath[] = ROBOTICK_CORE_ROOT "/cpp/tests/data/mujoco/depth_target.xml";
 	} // namespace
 
 	TEST_CASE("Unit/Systems/MuJoCoRenderContext")
@@ -60,12 +66,20 @@ namespace robotick::tests
 			REQUIRE(snapshot_model != nullptr);
 			REQUIRE(snapshot_data != nullptr);
 
+			// The model may be shared with other instances: init() must size its context without touching it.
+			const int offwidth = snapshot_model->vis.global.offwidth;
+			const int offheight = snapshot_model->vis.global.offheight;
+			const int offsamples = snapshot_model->vis.quality.offsamples;
+
 			MuJoCoRenderContext context;
 			if (!context.init(snapshot_model, 64, 48))
 			{
 				MuJoCoPhysics::destroy_snapshot(snapshot_data);
 				SKIP("MuJoCo render context init failed (likely headless GL)");
 			}
+			CHECK(snapshot_model->vis.global.offwidth == offwidth);
+			CHECK(snapshot_model->vis.global.offheight == offheight);
+			CHECK(snapshot_model->vis.quality.offsamples == offsamples);
 
 			HeapVector<uint8_t> rgb;
 			rgb.initialize(64 * 48 * 3);
@@ -90,6 +104,120 @@ namespace robotick::tests
 			MuJoCoPhysics::destroy_snapshot(snapshot_data);
 		}
 
+		SECTION("Depth and segmentation come back from the same frame for an empty scene")
+		{
+			MuJoCoPhysics physics;
+			REQUIRE(physics.load_from_xml(kMinimalModelPath));
+
+			mjData* snapshot_data = nullptr;
+			const mjModel* snapshot_model = nullptr;
+			double snapshot_time = 0.0;
+			REQUIRE(physics.alloc_render_snapshot(snapshot_data, snapshot_model, snapshot_time));
+
+			MuJoCoRenderContext context;
+			if (!context.init(snapshot_model, 64, 48))
+			{
+				MuJoCoPhysics::destroy_snapshot(snapshot_data);
+				SKIP("MuJoCo render context init failed (likely headless GL)");
+			}
+
+			HeapVector<uint8_t> rgb;
+			HeapVector<float> depth;
+			HeapVector<int32_t> segmentation;
+			rgb.initialize(64 * 48 * 3);
+			depth.initialize(64 * 48);
+			segmentation.initialize(64 * 48);
+
+			MuJoCoRenderTargets targets;
+			targets.rgb = rgb.data();
+			targets.rgb_capacity = rgb.size();
+			targets.depth = depth.data();
+			targets.depth_capacity = depth.size();
+			targets.segmentation = segmentation.data();
+			targets.segmentation_capacity = segmentation.size();
+
+			int width = 0;
+			int height = 0;
+			if (!context.render_frame(snapshot_model, snapshot_data, "", targets, width, height))
+			{
+				MuJoCoPhysics::destroy_snapshot(snapshot_data);
+				SKIP("MuJoCo render failed (likely headless GL)");
+			}
+
+			REQUIRE(width == 64);
+			REQUIRE(height == 48);
+
+			// Nothing in the scene: every pixel is background, at the far clip plane.
+			const float zfar = static_cast<float>(snapshot_model->vis.map.zfar * snapshot_model->stat.extent);
+			for (size_t i = 0; i < depth.size(); ++i)
+			{
+				CHECK(depth.data()[i] > zfar * 0.99f);
+				CHECK(segmentation.data()[i] == -1);
+			}
+
+			MuJoCoPhysics::destroy_snapshot(snapshot_data);
+		}
+
+		SECTION("Depth is linearised to metres and segmentation names the geom under each pixel")
+		{
+			MuJoCoPhysics physics;
+			REQUIRE(physics.load_from_xml(kDepthTargetModelPath));
+
+			mjData* snapshot_data = nullptr;
+			const mjModel* snapshot_model = nullptr;
+			double snapshot_time = 0.0;
+			REQUIRE(physics.alloc_render_snapshot(snapshot_data, snapshot_model, snapshot_time));
+
+			const int target_geom_id = mj_name2id(snapshot_model, mjOBJ_GEOM, "target");
+			REQUIRE(target_geom_id == 1);
+
+			MuJoCoRenderContext context;
+			if (!context.init(snapshot_model, 64, 48))
+			{
+				MuJoCoPhysics::destroy_snapshot(snapshot_data);
+				SKIP("MuJoCo render context init failed (likely headless GL)");
+			}
+
+			HeapVector<uint8_t> rgb;
+			HeapVector<float> depth;
+			HeapVector<int32_t> segmentation;
+			rgb.initialize(64 * 48 * 3);
+			depth.initialize(64 * 48);
+			segmentation.initialize(64 * 48);
+
+			MuJoCoRenderTargets targets;
+			targets.rgb = rgb.data();
+			targets.rgb_capacity = rgb.size();
+			targets.depth = depth.data();
+			targets.depth_capacity = depth.size();
+			targets.segmentation = segmentation.data();
+			targets.segmentation_capacity = segmentation.size();
+
+			int width = 0;
+			int height = 0;
+			if (!context.render_frame(snapshot_model, snapshot_data, "down_cam", targets, width, height))
+			{
+				MuJoCoPhysics::destroy_snapshot(snapshot_data);
+				SKIP("MuJoCo render failed (likely headless GL)");
+			}
+
+			REQUIRE(width == 64);
+			REQUIRE(height == 48);
+
+			// Centre of the view: the box's top face.
+			const size_t centre = static_cast<size_t>(24 * 64 + 32);
+			CHECK(depth.data()[centre] > 1.74f);
+			CHECK(depth.data()[centre] < 1.76f);
+			CHECK(segmentation.data()[centre] == target_geom_id);
+
+			// Corner of the view: past the box, nothing but background at the far clip plane.
+			const float zfar = static_cast<float>(snapshot_model->vis.map.zfar * snapshot_model->stat.extent);
+			CHECK(depth.data()[0] > zfar * 0.99f);
+			CHECK(segmentation.data()[0] == -1);
+
+			MuJoCoPhysics::destroy_snapshot(snapshot_data);
+		}
+
 		SECTION("Manual GL clear produces blue pixels")
 		{
 			MuJoCoPhysics physics;
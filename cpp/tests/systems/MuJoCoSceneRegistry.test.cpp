@@ -44,6 +44,39 @@ namespace robotick::tests
 			REQUIRE_FALSE(registry.is_valid(scene_id));
 		}
 
+		SECTION("State revision advances only when the simulation changes")
+		{
+			MuJoCoPhysics physics;
+			REQUIRE(physics.load_from_xml(kMinimalModelPath));
+
+			MuJoCoSceneRegistry& registry = MuJoCoSceneRegistry::get();
+			const uint32_t scene_id = registry.register_scene(&physics);
+
+			uint64_t revision = 0;
+			REQUIRE(registry.get_state_revision(scene_id, revision));
+
+			uint64_t unchanged_revision = 0;
+			REQUIRE(registry.get_state_revision(scene_id, unchanged_revision));
+			REQUIRE(unchanged_revision == revision);
+
+			physics.step();
+			uint64_t stepped_revision = 0;
+			REQUIRE(registry.get_state_revision(scene_id, stepped_revision));
+			REQUIRE(stepped_revision > revision);
+
+			mjData* snapshot_data = nullptr;
+			const mjModel* snapshot_model = nullptr;
+			double snapshot_time = 0.0;
+			REQUIRE(registry.alloc_render_snapshot(scene_id, snapshot_data, snapshot_model, snapshot_time));
+			uint64_t copied_revision = 0;
+			REQUIRE(registry.copy_render_snapshot(scene_id, snapshot_data, snapshot_model, snapshot_time, &copied_revision));
+			REQUIRE(copied_revision == stepped_revision);
+			registry.destroy_render_snapshot(snapshot_data);
+
+			registry.unregister_scene(scene_id);
+			REQUIRE_FALSE(registry.get_state_revision(scene_id, revision));
+		}
+
 		SECTION("Rejects operations on invalid handles")
 		{
 			MuJoCoSceneRegistry& registry = MuJoCoSceneRegistry::get();
@@ -0,0 +1,99 @@
+// Copyright Robotick contributors
+// SPDX-License-Identifier: Apache-2.0
+
+#include "robotick/systems/MultiCamera.h"
+
+#include "robotick/systems/Image.h"
+
+#include <catch2/catch_test_macros.hpp>
+
+namespace robotick::tests
+{
+	namespace
+	{
+		// Stands in for MultiCamera: "encodes" camera i as a few bytes of (set_id + i), and can fail on demand.
+		struct FakeCameras
+		{
+			uint32_t camera_count = 3;
+			uint8_t set_id = 0;
+			bool fail_capture = false;
+			int fail_encode_camera = -1;
+
+			bool capture()
+			{
+				set_id++;
+				return !fail_capture;
+			}
+
+			uint32_t get_camera_count() const { return camera_count; }
+
+			bool encode_jpeg(uint32_t camera, uint8_t* dst_buffer, size_t dst_capacity, size_t& out_size_used)
+			{
+				out_size_used = 0;
+				if (static_cast<int>(camera) == fail_encode_camera || dst_capacity < 4)
+					return false;
+
+				for (size_t i = 0; i < 4; ++i)
+					dst_buffer[i] = static_cast<uint8_t>(set_id + camera);
+				out_size_used = 4;
+				return true;
+			}
+		};
+
+		struct JpegOutputs
+		{
+			ImageJpeg128k jpeg[MultiCamera::kMaxCameras];
+			ImageJpeg128k* const ptrs[MultiCamera::kMaxCameras] = {&jpeg[0], &jpeg[1], &jpeg[2], &jpeg[3]};
+		};
+
+		bool holds_set(const JpegOutputs& outputs, uint32_t camera_count, uint8_t set_id)
+		{
+			for (uint32_t i = 0; i < camera_count; ++i)
+			{
+				if (outputs.jpeg[i].size() != 4 || outputs.jpeg[i][0] != static_cast<uint8_t>(set_id + i))
+					return false;
+			}
+			return true;
+		}
+	} // namespace
+
+	TEST_CASE("Unit/Systems/MultiCamera")
+	{
+		FakeCameras cameras;
+		JpegOutputs outputs;
+
+		REQUIRE(capture_jpeg_set(cameras, outputs.ptrs));
+		REQUIRE(holds_set(outputs, cameras.camera_count, 1));
+
+		SECTION("Every camera succeeding publishes the whole new set")
+		{
+			CHECK(capture_jpeg_set(cameras, outputs.ptrs));
+			CHECK(holds_set(outputs, cameras.camera_count, 2));
+			CHECK(outputs.jpeg[3].empty());
+		}
+
+		SECTION("A failed capture publishes nothing and keeps the previous set")
+		{
+			cameras.fail_capture = true;
+			CHECK_FALSE(capture_jpeg_set(cameras, outputs.ptrs));
+			CHECK(holds_set(outputs, cameras.camera_count, 1));
+		}
+
+		SECTION("A failed encode on any camera empties every output")
+		{
+			for (int failing = 0; failing < static_cast<int>(cameras.camera_count); ++failing)
+			{
+				cameras.fail_encode_camera = failing;
+				CHECK_FALSE(capture_jpeg_set(cameras, outputs.ptrs));
+				for (uint32_t i = 0; i < cameras.camera_count; ++i)
+					CHECK(outputs.jpeg[i].empty());
+			}
+
+			// Recovery publishes a whole set again.
+			cameras.fail_encode_camera = -1;
+			CHECK(capture_jpeg_set(cameras, outputs.ptrs));
+			CHECK(holds_set(outputs, cameras.camera_count, cameras.set_id));
+		}
+	}
+
+} // namespace robotick::tests
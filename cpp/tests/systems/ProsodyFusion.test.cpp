@@ -0,0 +1,311 @@
+// Copyright Robotick contributors
+// SPDX-License-Identifier: Apache-2.0
+
+#include "robotick/systems/auditory/ProsodyFusion.h"
+
+#include <catch2/catch_all.hpp>
+
+namespace robotick::test
+{
+	namespace
+	{
+		ProsodicSegment make_segment(uint32_t segment_id, uint32_t revision, float start_time_sec)
+		{
+			ProsodicSegment segment;
+			segment.segment_id = segment_id;
+			segment.revision = revision;
+			segment.start_time_sec = start_time_sec;
+			segment.end_time_sec = start_time_sec + 1.0f;
+			return segment;
+		}
+	} // namespace
+
+	TEST_CASE("Unit/Systems/Auditory/ProsodyFusion/SegmentDelta")
+	{
+		static ProsodicSegmentBuffer segments;
+		segments.clear();
+		segments.add(make_segment(1, 3, 0.0f));
+		segments.add(make_segment(2, 7, 2.0f));
+		segments.add(make_segment(3, 5, 4.0f));
+
+		static ProsodicSegmentDelta delta;
+
+		SECTION("Only segments newer than the revision are collected, in buffer order")
+		{
+			REQUIRE(collect_segments_changed_since(segments, 4, delta));
+			REQUIRE(delta.size() == 2);
+			CHECK(delta[0].segment_id == 2);
+			CHECK(delta[1].segment_id == 3);
+
+			REQUIRE(collect_segments_changed_since(segments, 7, delta));
+			CHECK(delta.empty());
+		}
+
+		SECTION("Overflow keeps the newest changes and reports incompleteness")
+		{
+			segments.add(make_segment(4, 8, 6.0f));
+			segments.add(make_segment(5, 9, 8.0f));
+
+			REQUIRE_FALSE(collect_segments_changed_since(segments, 0, delta));
+			REQUIRE(delta.size() == ProsodicSegmentDelta::capacity());
+			CHECK(delta[0].segment_id == 4); // only the newest revisions (8, 9) fit
+			CHECK(delta[delta.size() - 1].segment_id == 5);
+		}
+
+		SECTION("Mirror converges on the producer and tolerates re-delivery")
+		{
+			static ProsodicSegmentBuffer mirror;
+			mirror.clear();
+
+			// Three segments outgrow one delta: apply the two newest, then the oldest, which lands in id order.
+			REQUIRE(collect_segments_changed_since(segments, 4, delta));
+			apply_segment_delta(mirror, delta);
+			ProsodicSegmentDelta first;
+			first.add(segments[0]);
+			apply_segment_delta(mirror, first);
+			REQUIRE(mirror.size() == 3);
+			CHECK(mirror[0].segment_id == 1);
+
+			// Live segment 3 keeps its id but moves on; an unseen segment 4 appears.
+			segments[2].end_time_sec = 6.0f;
+			segments[2].revision = 8;
+			segments.add(make_segment(4, 9, 7.0f));
+
+			REQUIRE(collect_segments_changed_since(segments, 7, delta));
+			apply_segment_delta(mirror, delta);
+			apply_segment_delta(mirror, delta); // same delta seen again on a later consumer tick
+
+			REQUIRE(mirror.size() == 4);
+			for (size_t i = 0; i < mirror.size(); ++i)
+			{
+				CHECK(mirror[i].segment_id == segments[i].segment_id);
+				CHECK(mirror[i].revision == segments[i].revision);
+				CHECK(mirror[i].end_time_sec == segments[i].end_time_sec);
+			}
+
+			// A stale copy never overwrites a newer one.
+			ProsodicSegmentDelta stale;
+			stale.add(make_segment(3, 4, 4.0f));
+			apply_segment_delta(mirror, stale);
+			CHECK(mirror[2].revision == 8);
+		}
+	}
+
+	TEST_CASE("Unit/Systems/Auditory/ProsodyFusion/SegmentMirror")
+	{
+		static ProsodicSegmentBuffer segments;
+		segments.clear();
+		segments.add(make_segment(1, 1, 0.0f));
+		segments.add(make_segment(2, 2, 2.0f));
+
+		static ProsodicSegmentMirror mirror;
+		mirror.clear();
+
+		static ProsodicSegmentDelta delta;
+
+		// First sync always copies: the mirror has seen nothing.
+		REQUIRE(collect_segments_changed_since(segments, 1, delta));
+		CHECK(mirror.sync(delta, true, 1, 2, segments));
+		REQUIRE(mirror.segments.size() == 2);
+		CHECK(mirror.revision == 2);
+
+		SECTION("Consecutive deltas apply without a resync")
+		{
+			segments.add(make_segment(3, 3, 4.0f));
+			REQUIRE(collect_segments_changed_since(segments, 2, delta));
+			CHECK_FALSE(mirror.sync(delta, true, 2, 3, segments));
+			REQUIRE(mirror.segments.size() == 3);
+			CHECK(mirror.segments[2].segment_id == 3);
+			CHECK(mirror.revision == 3);
+		}
+
+		SECTION("An unchanged revision is skipped")
+		{
+			static ProsodicSegmentBuffer unrelated;
+			unrelated.clear();
+			CHECK_FALSE(mirror.sync(delta, true, 1, 2, unrelated));
+			CHECK(mirror.segments.size() == 2);
+		}
+
+		SECTION("A missed tick resyncs from the full buffer")
+		{
+			// Revision 3 is published and missed; only the delta for revision 4 is seen.
+			segments.add(make_segment(3, 3, 4.0f));
+			segments.add(make_segment(4, 4, 6.0f));
+			REQUIRE(collect_segments_changed_since(segments, 3, delta));
+			REQUIRE(delta.size() == 1);
+
+			CHECK(mirror.sync(delta, true, 3, 4, segments));
+			REQUIRE(mirror.segments.size() == 4);
+			CHECK(mirror.segments[2].segment_id == 3);
+			CHECK(mirror.revision == 4);
+		}
+
+		SECTION("An incomplete delta resyncs from the full buffer")
+		{
+			segments.add(make_segment(3, 3, 4.0f));
+			REQUIRE(collect_segments_changed_since(segments, 2, delta));
+			CHECK(mirror.sync(delta, false, 2, 3, segments));
+			CHECK(mirror.segments.size() == 3);
+		}
+
+		SECTION("A producer reset clears the mirror")
+		{
+			segments.clear();
+			delta.clear();
+			CHECK(mirror.sync(delta, true, 3, 3, segments));
+			CHECK(mirror.segments.empty());
+			CHECK(mirror.revision == 3);
+		}
+	}
+
+	namespace
+	{
+		// Stands in for ProsodyFusionWorkload: edits its set, then publishes the delta outputs and the store set.
+		struct FakeFusion
+		{
+			ProsodicSegmentBuffer segments;
+			ProsodicSegmentDelta changed_segments;
+			bool changed_segments_complete = true;
+			uint32_t changed_segments_base_revision = 0;
+			uint32_t segments_revision = 0;
+			uint32_t segments_handle = 0;
+
+			uint32_t revision = 0;
+			uint32_t next_segment_id = 0;
+
+			void start()
+			{
+				segments_handle = ProsodicSegmentStore::get().acquire_set();
+				segments.clear();
+				changed_segments.clear();
+				changed_segments_complete = true;
+				changed_segments_base_revision = segments_revision = ++revision;
+				publish();
+			}
+
+			void stop() { ProsodicSegmentStore::get().release_set(segments_handle); }
+
+			// One tick: add new_segments segments and touch the oldest touched_segments existing ones.
+			void tick(uint32_t new_segments, uint32_t touched_segments)
+			{
+				const uint32_t tick_start_revision = revision;
+				for (uint32_t i = 0; i < touched_segments && i < segments.size(); ++i)
+				{
+					segments[i].end_time_sec += 0.5f;
+					segments[i].revision = ++revision;
+				}
+				for (uint32_t i = 0; i < new_segments; ++i)
+				{
+					append_segment_with_capacity(segments, make_segment(++next_segment_id, ++revision, 2.0f * next_segment_id));
+				}
+
+				changed_segments_complete = collect_segments_changed_since(segments, tick_start_revision, changed_segments);
+				changed_segments_base_revision = tick_start_revision;
+				segments_revision = revision;
+				if (revision != tick_start_revision)
+				{
+					publish();
+				}
+			}
+
+			void publish()
+			{
+				ProsodicSegmentStore::get().publish(
+					segments_handle, changed_segments, changed_segments_complete, changed_segments_base_revision, segments_revision, segments);
+			}
+		};
+
+		// The consumer only has the delta outputs wired - never the full segments.
+		bool sync_from_delta(ProsodicSegmentMirror& mirror, const FakeFusion& fusion)
+		{
+			return mirror.sync(fusion.changed_segments,
+				fusion.changed_segments_complete,
+				fusion.changed_segments_base_revision,
+				fusion.segments_revision,
+				fusion.segments_handle);
+		}
+
+		bool matches(const ProsodicSegmentMirror& mirror, const FakeFusion& fusion)
+		{
+			if (mirror.segments.size() != fusion.segments.size())
+			{
+				return false;
+			}
+			for (size_t i = 0; i < mirror.segments.size(); ++i)
+			{
+				const ProsodicSegment& a = mirror.segments[i];
+				const ProsodicSegment& b = fusion.segments[i];
+				if (a.segment_id != b.segment_id || a.revision != b.revision || a.end_time_sec != b.end_time_sec)
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+	} // namespace
+
+	TEST_CASE("Unit/Systems/Auditory/ProsodyFusion/SegmentStore")
+	{
+		static FakeFusion fusion;
+		fusion = FakeFusion{};
+		fusion.start();
+		REQUIRE(fusion.segments_handle != 0);
+
+		static ProsodicSegmentMirror mirror;
+		mirror.clear();
+
+		// The first sync has seen nothing, so it fetches the (empty) set from the store.
+		CHECK(sync_from_delta(mirror, fusion));
+		CHECK(mirror.segments_handle == fusion.segments_handle);
+
+		SECTION("A consumer with only the delta wired stays in sync")
+		{
+			for (uint32_t tick = 0; tick < 40; ++tick)
+			{
+				fusion.tick(tick % 5 == 0 ? 1 : 0, 1);
+				CHECK_FALSE(sync_from_delta(mirror, fusion));
+				CHECK(matches(mirror, fusion));
+			}
+			CHECK(fusion.segments.size() == 8);
+		}
+
+		SECTION("Missed ticks and overfull deltas are refetched from the store")
+		{
+			fusion.tick(1, 0);
+			CHECK_FALSE(sync_from_delta(mirror, fusion));
+
+			fusion.tick(1, 0); // missed by the consumer
+			fusion.tick(0, 1);
+			CHECK(sync_from_delta(mirror, fusion));
+			CHECK(matches(mirror, fusion));
+
+			fusion.tick(3, 2); // five changes: more than a delta holds
+			REQUIRE_FALSE(fusion.changed_segments_complete);
+			CHECK(sync_from_delta(mirror, fusion));
+			CHECK(matches(mirror, fusion));
+
+			fusion.tick(0, 1);
+			CHECK_FALSE(sync_from_delta(mirror, fusion));
+			CHECK(matches(mirror, fusion));
+		}
+
+		SECTION("A restarted producer is followed under its new handle")
+		{
+			fusion.tick(2, 0);
+			CHECK_FALSE(sync_from_delta(mirror, fusion));
+
+			const uint32_t old_handle = fusion.segments_handle;
+			fusion.stop();
+			fusion.start();
+			CHECK(fusion.segments_handle != old_handle);
+
+			fusion.tick(1, 0);
+			CHECK(sync_from_delta(mirror, fusion));
+			CHECK(matches(mirror, fusion));
+		}
+
+		fusion.stop();
+	}
+
+} // namespace robotick::test
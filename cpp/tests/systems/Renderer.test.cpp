@@ -0,0 +1,131 @@
+// Copyright Robotick contributors
+// SPDX-License-Identifier: Apache-2.0
+
+#include "robotick/systems/Renderer.h"
+#include "robotick/systems/Image.h"
+
+#include <catch2/catch_test_macros.hpp>
+
+#if defined(ROBOTICK_PLATFORM_DESKTOP) || defined(ROBOTICK_PLATFORM_LINUX)
+#include <SDL2/SDL.h>
+#include <opencv2/imgcodecs.hpp>
+#endif
+
+namespace robotick::tests
+{
+#if defined(ROBOTICK_PLATFORM_DESKTOP) || defined(ROBOTICK_PLATFORM_LINUX)
+	namespace
+	{
+		constexpr int kSize = 64;
+
+		// Offscreen 64x64 renderer with a 1:1 viewport, so logical and pixel coordinates coincide.
+		struct TestRenderer : Renderer
+		{
+			TestRenderer()
+			{
+				// Headless CI has no display; the software renderer only needs a window surface.
+				SDL_SetHint(SDL_HINT_VIDEODRIVER, "dummy");
+				set_texture_only_size(kSize, kSize);
+				set_viewport(kSize, kSize);
+				init(true);
+				clear(Colors::Black);
+			}
+
+			// Capture through capture_as_png (which flushes any pending batch) and decode to BGR.
+			cv::Mat capture()
+			{
+				static ImagePng128k png;
+				size_t png_size = 0;
+				REQUIRE(capture_as_png(png.data(), png.capacity(), png_size));
+				png.set_size(png_size);
+
+				const cv::Mat encoded(1, static_cast<int>(png_size), CV_8UC1, png.data());
+				cv::Mat bgr = cv::imdecode(encoded, cv::IMREAD_COLOR);
+				REQUIRE(bgr.cols == kSize);
+				REQUIRE(bgr.rows == kSize);
+				return bgr;
+			}
+		};
+
+		bool is_color(const cv::Mat& bgr, int x, int y, const Color& color)
+		{
+			const cv::Vec3b& pixel = bgr.at<cv::Vec3b>(y, x);
+			return pixel[0] == color.b && pixel[1] == color.g && pixel[2] == color.r;
+		}
+
+		const Vec2f kBigRect[2] = {Vec2f(8.0f, 8.0f), Vec2f(56.0f, 56.0f)};
+		const Vec2f kSmallRect[2] = {Vec2f(28.0f, 28.0f), Vec2f(36.0f, 36.0f)};
+	} // namespace
+
+	TEST_CASE("Unit/Systems/Renderer")
+	{
+		// Each section queues a filled rect (batched), then a primitive that draws immediately, then another
+		// batched rect. Painter's order only holds if the first batch is flushed before the immediate draw,
+		// and the second is kept until capture.
+		TestRenderer renderer;
+
+		SECTION("Polylines draw over earlier fills and under later ones")
+		{
+			renderer.draw_rect_filled(kBigRect[0], kBigRect[1], Colors::Red);
+			const Vec2f line[2] = {Vec2f(0.0f, 20.0f), Vec2f(63.0f, 20.0f)};
+			renderer.draw_polyline(line, 2, Colors::Green);
+			const Vec2f cross[2] = {Vec2f(32.0f, 0.0f), Vec2f(32.0f, 63.0f)};
+			renderer.draw_polyline(cross, 2, Colors::Green);
+			renderer.draw_rect_filled(kSmallRect[0], kSmallRect[1], Colors::Blue);
+
+			const cv::Mat bgr = renderer.capture();
+			CHECK(is_color(bgr, 16, 16, Colors::Red));
+			CHECK(is_color(bgr, 16, 20, Colors::Green));
+			CHECK(is_color(bgr, 32, 48, Colors::Green));
+			CHECK(is_color(bgr, 32, 32, Colors::Blue));
+			CHECK(is_color(bgr, 2, 2, Colors::Black));
+		}
+
+		SECTION("Images draw over earlier fills and under later ones")
+		{
+			renderer.draw_rect_filled(kBigRect[0], kBigRect[1], Colors::Red);
+			// Opaque white reads the same in any byte order.
+			uint8_t white[2 * 2 * 4];
+			for (uint8_t& byte : white)
+				byte = 255;
+			renderer.draw_image_rgba8888_fit(white, 2, 2);
+			renderer.draw_rect_filled(kSmallRect[0], kSmallRect[1], Colors::Blue);
+
+			const cv::Mat bgr = renderer.capture();
+			CHECK(is_color(bgr, 16, 16, Colors::White));
+			CHECK(is_color(bgr, 2, 2, Colors::White));
+			CHECK(is_color(bgr, 32, 32, Colors::Blue));
+		}
+
+		SECTION("Text draws over earlier fills and under later ones")
+		{
+			renderer.draw_rect_filled(Vec2f(0.0f, 0.0f), Vec2f(64.0f, 64.0f), Colors::Red);
+			renderer.draw_text("MM", Vec2f(32.0f, 32.0f), 24.0f, TextAlign::Center, Colors::Green);
+			renderer.draw_rect_filled(Vec2f(0.0f, 0.0f), Vec2f(64.0f, 4.0f), Colors::Blue);
+
+			const cv::Mat bgr = renderer.capture();
+			int glyph_pixels = 0;
+			for (int y = 16; y < 48; ++y)
+			{
+				for (int x = 8; x < 56; ++x)
+					glyph_pixels += is_color(bgr, x, y, Colors::Green) ? 1 : 0;
+			}
+			CHECK(glyph_pixels > 20);
+			CHECK(is_color(bgr, 32, 2, Colors::Blue));
+			CHECK(is_color(bgr, 32, 60, Colors::Red));
+		}
+
+		SECTION("clear() drops fills queued before it")
+		{
+			renderer.draw_rect_filled(kBigRect[0], kBigRect[1], Colors::Red);
+			renderer.clear(Colors::Black);
+			renderer.draw_rect_filled(kSmallRect[0], kSmallRect[1], Colors::Blue);
+
+			const cv::Mat bgr = renderer.capture();
+			CHECK(is_color(bgr, 16, 16, Colors::Black));
+			CHECK(is_color(bgr, 32, 32, Colors::Blue));
+		}
+	}
+#endif // #if defined(ROBOTICK_PLATFORM_DESKTOP) || defined(ROBOTICK_PLATFORM_LINUX)
+
+} // namespace robotick::tests
@@ -0,0 +1,139 @@
+// Copyright Robotick contributors
+// SPDX-License-Identifier: Apache-2.0
+
+#include "robotick/systems/SharedTelemetryWriter.h"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace robotick::tests
+{
+	namespace
+	{
+		struct TestOutputs
+		{
+			int count = 0;
+			float gain = 0.0f;
+			double time = 0.0;
+			FixedString16 label;
+		};
+
+		struct TestBuffer
+		{
+			TestOutputs outputs;
+			uint8_t unexported[64] = {};
+			uint32_t other = 0;
+		};
+
+		SharedTelemetryField make_field(const char* path, const void* src, size_t size, RobotickSharedTelemetryKind kind)
+		{
+			SharedTelemetryField field;
+			field.path = path;
+			field.src = src;
+			field.size = static_cast<uint32_t>(size);
+			field.kind = kind;
+			return field;
+		}
+
+		// Maps the segment the way an external reader would.
+		struct ReaderMapping
+		{
+			void* segment = nullptr;
+			size_t size = 0;
+
+			explicit ReaderMapping(const char* name)
+			{
+				const int fd = ::shm_open(name, O_RDONLY, 0);
+				if (fd < 0)
+					return;
+				size = static_cast<size_t>(::lseek(fd, 0, SEEK_END));
+				void* mapped = ::mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+				::close(fd);
+				segment = (mapped == MAP_FAILED) ? nullptr : mapped;
+			}
+
+			~ReaderMapping()
+			{
+				if (segment)
+					::munmap(segment, size);
+			}
+		};
+	} // namespace
+
+	TEST_CASE("Unit/Systems/SharedTelemetryWriter")
+	{
+		TestBuffer buffer;
+		TestOutputs& outputs = buffer.outputs;
+		uint32_t& other = buffer.other;
+
+		const SharedTelemetryField fields[] = {
+			make_field("W.outputs.count", &outputs.count, sizeof(outputs.count), ROBOTICK_SHARED_TELEMETRY_INT32),
+			make_field("W.outputs.gain", &outputs.gain, sizeof(outputs.gain), ROBOTICK_SHARED_TELEMETRY_FLOAT32),
+			make_field("W.outputs.time", &outputs.time, sizeof(outputs.time), ROBOTICK_SHARED_TELEMETRY_FLOAT64),
+			make_field("W.outputs.label", &outputs.label, sizeof(outputs.label), ROBOTICK_SHARED_TELEMETRY_STRING),
+			make_field("X.outputs.other", &other, sizeof(other), ROBOTICK_SHARED_TELEMETRY_UINT32),
+		};
+
+		SharedTelemetryWriter writer;
+		REQUIRE(writer.open("robotick_shared_telemetry_test", fields, 5));
+
+		SECTION("Adjacent fields of a struct are copied as one run")
+		{
+			CHECK(writer.get_copy_run_count() == 2);
+			CHECK(writer.get_data_size() >= sizeof(TestOutputs) + sizeof(other));
+		}
+
+		SECTION("A separate reader sees the layout and consistent snapshots")
+		{
+			ReaderMapping reader("/robotick_shared_telemetry_test");
+			REQUIRE(reader.segment != nullptr);
+
+			const RobotickSharedTelemetryHeader* header = robotick_shared_telemetry_header(reader.segment);
+			REQUIRE(header != nullptr);
+			CHECK(header->field_count == 5);
+			CHECK((header->flags & ROBOTICK_SHARED_TELEMETRY_FLAG_WRITER_ATTACHED) != 0);
+
+			const RobotickSharedTelemetryField* gain = robotick_shared_telemetry_find_field(reader.segment, "W.outputs.gain");
+			const RobotickSharedTelemetryField* label = robotick_shared_telemetry_find_field(reader.segment, "W.outputs.label");
+			const RobotickSharedTelemetryField* other_field = robotick_shared_telemetry_find_field(reader.segment, "X.outputs.other");
+			REQUIRE(gain != nullptr);
+			REQUIRE(label != nullptr);
+			REQUIRE(other_field != nullptr);
+			CHECK(gain->kind == ROBOTICK_SHARED_TELEMETRY_FLOAT32);
+			CHECK(robotick_shared_telemetry_find_field(reader.segment, "W.outputs.missing") == nullptr);
+
+			outputs.gain = 0.5f;
+			outputs.label = "ready";
+			other = 42;
+			writer.publish(1234);
+
+			uint8_t snapshot[256] = {};
+			uint64_t timestamp_ns = 0;
+			REQUIRE(robotick_shared_telemetry_read(reader.segment, snapshot, sizeof(snapshot), &timestamp_ns, 4) == 1);
+			CHECK(timestamp_ns == 1234);
+			CHECK(header->publish_count == 1);
+
+			float gain_value = 0.0f;
+			uint32_t other_value = 0;
+			::memcpy(&gain_value, snapshot + gain->offset, sizeof(gain_value));
+			::memcpy(&other_value, snapshot + other_field->offset, sizeof(other_value));
+			CHECK(gain_value == 0.5f);
+			CHECK(other_value == 42);
+			CHECK(::strcmp(reinterpret_cast<const char*>(snapshot + label->offset), "ready") == 0);
+
+			// Too small a buffer is refused rather than partially filled
+			CHECK(robotick_shared_telemetry_read(reader.segment, snapshot, 4, nullptr, 4) == 0);
+
+			writer.close();
+			CHECK((header->flags & ROBOTICK_SHARED_TELEMETRY_FLAG_WRITER_ATTACHED) == 0);
+		}
+
+		writer.close();
+		CHECK(ReaderMapping("/robotick_shared_telemetry_test").segment == nullptr);
+	}
+
+} // namespace robotick::tests
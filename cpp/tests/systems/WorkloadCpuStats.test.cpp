@@ -0,0 +1,102 @@
+// Copyright Robotick contributors
+// SPDX-License-Identifier: Apache-2.0
+
+#include "robotick/systems/WorkloadCpuStats.h"
+
+#include "robotick/framework/concurrency/Thread.h"
+#include "robotick/framework/time/Clock.h"
+
+#include <catch2/catch_test_macros.hpp>
+
+#if defined(ROBOTICK_PLATFORM_DESKTOP) || defined(ROBOTICK_PLATFORM_LINUX)
+#include <sys/resource.h>
+#endif
+
+namespace robotick::tests
+{
+	namespace
+	{
+		volatile uint64_t busy_sink = 0;
+
+		void spin_for_ms(uint32_t duration_ms)
+		{
+			const auto start = Clock::now();
+			while (Clock::to_nanoseconds(Clock::now() - start).count() < duration_ms * 1'000'000ll)
+				busy_sink = busy_sink + 1;
+		}
+	} // namespace
+
+	TEST_CASE("Unit/Systems/WorkloadCpuStats")
+	{
+		SECTION("Computing counts as CPU time, sleeping does not")
+		{
+			ThreadCpuSample before;
+			REQUIRE(sample_thread_cpu(before));
+
+			spin_for_ms(20);
+			ThreadCpuSample after_spin;
+			REQUIRE(sample_thread_cpu(after_spin));
+			CHECK(after_spin.cpu_ns - before.cpu_ns >= 10'000'000u);
+
+			Thread::sleep_ms(20);
+			ThreadCpuSample after_sleep;
+			REQUIRE(sample_thread_cpu(after_sleep));
+			CHECK(after_sleep.cpu_ns - after_spin.cpu_ns < 10'000'000u);
+#if defined(RUSAGE_THREAD)
+			// Switch counts are only sampled where the platform reports them per thread.
+			CHECK(after_sleep.voluntary_switches > after_spin.voluntary_switches);
+#endif
+		}
+
+		SECTION("Recording stays enabled until the last reporter is removed")
+		{
+			WorkloadCpuStatsRegistry& registry = WorkloadCpuStatsRegistry::get();
+			const bool was_enabled = registry.is_enabled();
+
+			registry.add_reporter();
+			registry.add_reporter();
+			CHECK(registry.is_enabled());
+
+			registry.remove_reporter();
+			CHECK(registry.is_enabled());
+
+			registry.remove_reporter();
+			CHECK(registry.is_enabled() == was_enabled);
+		}
+
+		SECTION("Ticks accumulate per workload name")
+		{
+			WorkloadCpuStatsRegistry& registry = WorkloadCpuStatsRegistry::get();
+			WorkloadCpuStats* stats = registry.find_or_add("cpu_stats_test");
+			REQUIRE(stats != nullptr);
+			CHECK(registry.find_or_add("cpu_stats_test") == stats);
+			CHECK(registry.find_or_add("cpu_stats_test_other") != stats);
+
+			const WorkloadCpuTotals start = stats->get_totals();
+
+			ThreadCpuSample before;
+			before.cpu_ns = 1000;
+			before.voluntary_switches = 4;
+			ThreadCpuSample after;
+			after.cpu_ns = 1500;
+			after.voluntary_switches = 6;
+			after.involuntary_switches = 1;
+
+			stats->record_tick(2000, before, after);
+			stats->record_tick(2000, before, after);
+
+			const WorkloadCpuTotals totals = stats->get_totals();
+			CHECK(totals.tick_count - start.tick_count == 2);
+			CHECK(totals.wall_ns - start.wall_ns == 4000);
+			CHECK(totals.cpu_ns - start.cpu_ns == 1000);
+			CHECK(totals.voluntary_switches - start.voluntary_switches == 4);
+			CHECK(totals.involuntary_switches - start.involuntary_switches == 2);
+
+			bool found = false;
+			for (uint32_t i = 0; i < registry.get_count(); ++i)
+				found = found || (registry.get_entry(i).name == "cpu_stats_test");
+			CHECK(found);
+		}
+	}
+
+} // namespace robotick::tests
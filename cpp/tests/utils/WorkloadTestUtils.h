@@ -0,0 +1,36 @@
+// Copyright Robotick contributors
+// SPDX-License-Identifier: Apache-2.0
+//
+// Helpers shared by the workload tests, which poke a loaded instance's fields directly rather than
+// wiring it into a full model.
+
+#pragma once
+
+#include "robotick/api.h"
+#include "robotick/framework/Engine.h"
+
+#include <cstdint>
+
+namespace robotick::tests
+{
+	// Locate a named input/output field of a loaded workload instance (nullptr if there is none).
+	template <typename T> T* find_field(void* inst_ptr, const WorkloadDescriptor& desc, bool is_output, const char* name)
+	{
+		const auto* type_desc = is_output ? desc.outputs_desc : desc.inputs_desc;
+		const size_t struct_offset = is_output ? desc.outputs_offset : desc.inputs_offset;
+		if (type_desc == nullptr || struct_offset == OFFSET_UNBOUND)
+		{
+			return nullptr;
+		}
+
+		for (const auto& field : type_desc->get_struct_desc()->fields)
+		{
+			if (field.name == name)
+			{
+				return reinterpret_cast<T*>(static_cast<uint8_t*>(inst_ptr) + struct_offset + field.offset_within_container);
+			}
+		}
+		return nullptr;
+	}
+
+} // namespace robotick::tests
@@ -0,0 +1,170 @@
+// Copyright Robotick contributors
+// SPDX-License-Identifier: Apache-2.0
+
+#include "robotick/api.h"
+#include "robotick/framework/Engine.h"
+#include "robotick/framework/utils/TypeId.h"
+
+#include "utils/WorkloadTestUtils.h"
+
+#include <catch2/catch_all.hpp>
+
+namespace robotick
+{
+	void ensure_matrix_mixer_workload()
+	{
+		ROBOTICK_KEEP_WORKLOAD(MatrixMixerWorkload)
+	}
+
+} // namespace robotick
+
+using namespace robotick;
+using robotick::tests::find_field;
+
+namespace
+{
+	using MixerVector = FixedVector<float, 16>;		 // matches MatrixMixerWorkload's vectors
+	using MixerMatrix = FixedVector<float, 16 * 16>; // matches MatrixMixerWorkload's matrix
+
+	// Mecanum base: (vx, vy, wz) -> front-left, front-right, rear-left, rear-right wheel speeds.
+	static const float kMecanumWeights[4 * 3] = {
+		1.0f, -1.0f, -1.0f, // front-left
+		1.0f, 1.0f, 1.0f,	// front-right
+		1.0f, 1.0f, -1.0f,	// rear-left
+		1.0f, -1.0f, 1.0f,	// rear-right
+	};
+
+	static const FieldConfigEntry mecanum_config[] = {{"num_inputs", "3"}, {"num_outputs", "4"}};
+	static const FieldConfigEntry seek_config[] = {
+		{"num_inputs", "3"},
+		{"num_outputs", "4"},
+		{"clamp_outputs", "true"},
+		{"output_min", "-1.0"},
+		{"output_max", "1.0"},
+		{"seek_rate", "10.0"},
+	};
+
+	static const WorkloadSeed mecanum_seed{TypeId("MatrixMixerWorkload"), StringView("mixer"), 100.0f, {}, mecanum_config, {}};
+	static const WorkloadSeed seek_seed{TypeId("MatrixMixerWorkload"), StringView("seek_mixer"), 100.0f, {}, seek_config, {}};
+
+	static const WorkloadSeed* const mecanum_workloads[] = {&mecanum_seed};
+	static const WorkloadSeed* const seek_workloads[] = {&seek_seed};
+
+	// Loads one mixer with the mecanum matrix on its live weights input and ticks it at 100 Hz.
+	struct MixerHarness
+	{
+		Model model;
+		Engine engine;
+		void* inst_ptr = nullptr;
+		const WorkloadDescriptor* desc = nullptr;
+		MixerVector* values = nullptr;
+		MixerMatrix* weights = nullptr;
+		const MixerVector* result = nullptr;
+
+		explicit MixerHarness(const WorkloadSeed* const (&workloads)[1])
+		{
+			const WorkloadSeed& seed = *workloads[0];
+			model.use_workload_seeds(workloads);
+			model.set_root_workload(seed);
+			engine.load(model);
+
+			const auto& info = *engine.find_instance_info(seed.unique_name);
+			inst_ptr = info.get_ptr(engine);
+			REQUIRE(inst_ptr != nullptr);
+			desc = info.type->get_workload_desc();
+			REQUIRE(desc != nullptr);
+
+			values = find_field<MixerVector>(inst_ptr, *desc, false, "values");
+			weights = find_field<MixerMatrix>(inst_ptr, *desc, false, "weights");
+			result = find_field<MixerVector>(inst_ptr, *desc, true, "result");
+			REQUIRE(values != nullptr);
+			REQUIRE(weights != nullptr);
+			REQUIRE(result != nullptr);
+
+			weights->set(kMecanumWeights, 4 * 3);
+		}
+
+		void tick()
+		{
+			desc->tick_fn(inst_ptr, TICK_INFO_FIRST_10MS_100HZ);
+			REQUIRE(result->size() == 4);
+		}
+
+		void mix(float vx, float vy, float wz)
+		{
+			values->set_size(3);
+			(*values)[0] = vx;
+			(*values)[1] = vy;
+			(*values)[2] = wz;
+			tick();
+		}
+	};
+
+} // namespace
+
+TEST_CASE("Unit/Workloads/MatrixMixerWorkload")
+{
+	SECTION("Mixes every output as its row of weights times the inputs")
+	{
+		MixerHarness mixer(mecanum_workloads);
+
+		mixer.mix(0.5f, 0.0f, 0.0f); // straight ahead: every wheel forward
+		for (size_t j = 0; j < 4; ++j)
+			CHECK((*mixer.result)[j] == Catch::Approx(0.5f));
+
+		mixer.mix(0.0f, 0.0f, 0.25f); // spin in place: left and right sides oppose
+		CHECK((*mixer.result)[0] == Catch::Approx(-0.25f));
+		CHECK((*mixer.result)[1] == Catch::Approx(0.25f));
+		CHECK((*mixer.result)[2] == Catch::Approx(-0.25f));
+		CHECK((*mixer.result)[3] == Catch::Approx(0.25f));
+
+		mixer.mix(0.3f, 0.2f, 0.1f);
+		for (size_t j = 0; j < 4; ++j)
+		{
+			const float* row = kMecanumWeights + j * 3;
+			CHECK((*mixer.result)[j] == Catch::Approx(row[0] * 0.3f + row[1] * 0.2f + row[2] * 0.1f));
+		}
+	}
+
+	SECTION("Missing inputs count as zero")
+	{
+		MixerHarness mixer(mecanum_workloads);
+		mixer.mix(0.0f, 1.0f, 1.0f);
+
+		// Only vx connected now: the stale vy / wz beyond the vector's size must not leak into the mix.
+		mixer.values->set_size(1);
+		(*mixer.values)[0] = 0.5f;
+		mixer.tick();
+		for (size_t j = 0; j < 4; ++j)
+			CHECK((*mixer.result)[j] == Catch::Approx(0.5f));
+	}
+
+	SECTION("A changed weights matrix takes effect on the next tick")
+	{
+		MixerHarness mixer(mecanum_workloads);
+		mixer.mix(1.0f, 0.0f, 0.0f);
+		CHECK((*mixer.result)[0] == Catch::Approx(1.0f));
+
+		(*mixer.weights)[0] = 0.25f; // front-left vx gain
+		mixer.mix(1.0f, 0.0f, 0.0f);
+		CHECK((*mixer.result)[0] == Catch::Approx(0.25f));
+		CHECK((*mixer.result)[1] == Catch::Approx(1.0f));
+	}
+
+	SECTION("Clamped outputs seek their target at seek_rate")
+	{
+		MixerHarness mixer(seek_workloads);
+
+		// Full forward plus full strafe asks 2.0 of two wheels and 0.0 of the others; the clamp caps it at 1.0
+		// and seeking at 10 / s moves at most 0.1 per 10 ms tick.
+		for (int tick = 1; tick <= 15; ++tick)
+		{
+			mixer.mix(1.0f, 1.0f, 0.0f);
+			const float expected = robotick::min(1.0f, 0.1f * static_cast<float>(tick));
+			CHECK((*mixer.result)[1] == Catch::Approx(expected).margin(1e-5f));
+			CHECK((*mixer.result)[2] == Catch::Approx(expected).margin(1e-5f));
+			CHECK((*mixer.result)[0] == Catch::Approx(0.0f).margin(1e-6f));
+			CHECK((*mixer.result)[3] == Catch::Approx(0.0f).margin(1e-6f));
+		}
+	}
+}
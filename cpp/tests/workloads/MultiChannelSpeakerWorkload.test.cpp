@@ -0,0 +1,97 @@
+// Copyright Robotick contributors
+// SPDX-License-Identifier: Apache-2.0
+
+#include "robotick/api.h"
+#include "robotick/framework/Engine.h"
+#include "robotick/framework/utils/TypeId.h"
+#include "robotick/systems/audio/AudioFrame.h"
+#include "robotick/systems/audio/AudioSystem.h"
+
+#include "utils/WorkloadTestUtils.h"
+
+#include <catch2/catch_all.hpp>
+
+namespace robotick
+{
+	void ensure_multi_channel_speaker_workload()
+	{
+		ROBOTICK_KEEP_WORKLOAD(MultiChannelSpeakerWorkload)
+	}
+
+} // namespace robotick
+
+using namespace robotick;
+using robotick::tests::find_field;
+
+namespace
+{
+	void fill_frame(AudioFrame& frame, size_t num_samples, float value)
+	{
+		frame.sample_rate = AudioSystem::get_sample_rate();
+		frame.samples.set_size(num_samples);
+		for (float& sample : frame.samples)
+		{
+			sample = value;
+		}
+	}
+
+	static const FieldConfigEntry speaker_config[] = {
+		{"num_channels", "2"},
+	};
+
+	static const WorkloadSeed speaker_seed{TypeId("MultiChannelSpeakerWorkload"), StringView("speaker"), 100.0f, {}, speaker_config, {}};
+
+} // namespace
+
+TEST_CASE("Unit/Workloads/MultiChannelSpeakerWorkload")
+{
+	Model model;
+	static const WorkloadSeed* const workloads[] = {&speaker_seed};
+	model.use_workload_seeds(workloads);
+	model.set_root_workload(speaker_seed);
+
+	// Runs with or without an audio device: only the frame bookkeeping is checked, not what reaches SDL.
+	Engine engine;
+	engine.load(model);
+
+	const auto& info = *engine.find_instance_info(speaker_seed.unique_name);
+	void* inst_ptr = info.get_ptr(engine);
+	REQUIRE(inst_ptr != nullptr);
+	const WorkloadDescriptor* desc = info.type->get_workload_desc();
+	REQUIRE(desc != nullptr);
+
+	AudioFrame* channel1 = find_field<AudioFrame>(inst_ptr, *desc, false, "channel1");
+	AudioFrame* channel2 = find_field<AudioFrame>(inst_ptr, *desc, false, "channel2");
+	const uint32_t* frame_count = find_field<uint32_t>(inst_ptr, *desc, true, "frame_count");
+	REQUIRE(channel1 != nullptr);
+	REQUIRE(channel2 != nullptr);
+	REQUIRE(frame_count != nullptr);
+
+	SECTION("Matching channels queue their full length")
+	{
+		fill_frame(*channel1, 100, 0.25f);
+		fill_frame(*channel2, 100, -0.25f);
+		desc->tick_fn(inst_ptr, TICK_INFO_FIRST_10MS_100HZ);
+		CHECK(*frame_count == 100);
+	}
+
+	SECTION("Mismatched channels are clamped to the shortest")
+	{
+		fill_frame(*channel1, 100, 0.25f);
+		fill_frame(*channel2, 60, -0.25f);
+		desc->tick_fn(inst_ptr, TICK_INFO_FIRST_10MS_100HZ);
+		CHECK(*frame_count == 60);
+
+		fill_frame(*channel1, 40, 0.25f);
+		desc->tick_fn(inst_ptr, TICK_INFO_FIRST_10MS_100HZ);
+		CHECK(*frame_count == 40);
+	}
+
+	SECTION("An empty channel is silence, not a zero-length clamp")
+	{
+		fill_frame(*channel1, 100, 0.25f);
+		channel2->samples.set_size(0);
+		desc->tick_fn(inst_ptr, TICK_INFO_FIRST_10MS_100HZ);
+		CHECK(*frame_count == 100);
+	}
+}
@@ -0,0 +1,161 @@
+// Copyright Robotick contributors
+// SPDX-License-Identifier: Apache-2.0
+
+#include "robotick/api.h"
+#include "robotick/framework/Engine.h"
+#include "robotick/framework/utils/TypeId.h"
+
+#include "utils/WorkloadTestUtils.h"
+
+#include <catch2/catch_all.hpp>
+#include <cmath>
+
+namespace robotick
+{
+	void ensure_multi_low_pass_filter_workload()
+	{
+		ROBOTICK_KEEP_WORKLOAD(MultiLowPassFilterWorkload)
+	}
+
+} // namespace robotick
+
+using namespace robotick;
+using robotick::tests::find_field;
+
+namespace
+{
+	using LowPassChannels = FixedVector<float, 64>; // matches MultiLowPassFilterWorkload's channel vector
+
+	static const FieldConfigEntry order1_config[] = {{"order", "1"}};
+	static const FieldConfigEntry order2_config[] = {{"order", "2"}};
+	static const FieldConfigEntry order4_config[] = {{"order", "4"}};
+
+	static const WorkloadSeed order1_seed{TypeId("MultiLowPassFilterWorkload"), StringView("lpf1"), 100.0f, {}, order1_config, {}};
+	static const WorkloadSeed order2_seed{TypeId("MultiLowPassFilterWorkload"), StringView("lpf2"), 100.0f, {}, order2_config, {}};
+	static const WorkloadSeed order4_seed{TypeId("MultiLowPassFilterWorkload"), StringView("lpf4"), 100.0f, {}, order4_config, {}};
+
+	static const WorkloadSeed* const order1_workloads[] = {&order1_seed};
+	static const WorkloadSeed* const order2_workloads[] = {&order2_seed};
+	static const WorkloadSeed* const order4_workloads[] = {&order4_seed};
+
+	// Loads one filter (default tau 0.25 s, so a ~0.64 Hz cutoff) and ticks it at 100 Hz.
+	struct FilterHarness
+	{
+		Model model;
+		Engine engine;
+		void* inst_ptr = nullptr;
+		const WorkloadDescriptor* desc = nullptr;
+		LowPassChannels* values = nullptr;
+		const LowPassChannels* result = nullptr;
+
+		explicit FilterHarness(const WorkloadSeed* const (&workloads)[1])
+		{
+			const WorkloadSeed& seed = *workloads[0];
+			model.use_workload_seeds(workloads);
+			model.set_root_workload(seed);
+			engine.load(model);
+
+			const auto& info = *engine.find_instance_info(seed.unique_name);
+			inst_ptr = info.get_ptr(engine);
+			REQUIRE(inst_ptr != nullptr);
+			desc = info.type->get_workload_desc();
+			REQUIRE(desc != nullptr);
+
+			values = find_field<LowPassChannels>(inst_ptr, *desc, false, "values");
+			result = find_field<LowPassChannels>(inst_ptr, *desc, true, "result");
+			REQUIRE(values != nullptr);
+			REQUIRE(result != nullptr);
+
+			desc->start_fn(inst_ptr, 100.0f);
+		}
+
+		void tick() { desc->tick_fn(inst_ptr, TICK_INFO_FIRST_10MS_100HZ); }
+
+		// Channel 0: unit step. Channel 1: held at zero. Channel 2: +/-1 at Nyquist.
+		// Returns the largest |channel 2| over the last half of the run.
+		float run_probe(int num_ticks)
+		{
+			values->set_size(3);
+			(*values)[0] = 0.0f;
+			(*values)[1] = 0.0f;
+			(*values)[2] = 0.0f;
+			tick(); // first tick snaps to the input
+
+			float nyquist_peak = 0.0f;
+			for (int i = 0; i < num_ticks; ++i)
+			{
+				(*values)[0] = 1.0f;
+				(*values)[1] = 0.0f;
+				(*values)[2] = (i % 2) ? 1.0f : -1.0f;
+				tick();
+				if (i >= num_ticks / 2)
+				{
+					nyquist_peak = robotick::max(nyquist_peak, fabsf((*result)[2]));
+				}
+			}
+			return nyquist_peak;
+		}
+	};
+
+	void check_response(FilterHarness& filter, float nyquist_limit)
+	{
+		const float nyquist_peak = filter.run_probe(1000);
+		REQUIRE(filter.result->size() == 3);
+
+		// DC gain is unity: the step settles on its input.
+		CHECK((*filter.result)[0] == Catch::Approx(1.0f).margin(1e-3f));
+
+		// Nyquist is strongly attenuated.
+		CHECK(nyquist_peak < nyquist_limit);
+
+		// Channels are independent: the held channel is untouched by its neighbours.
+		CHECK((*filter.result)[1] == 0.0f);
+	}
+
+} // namespace
+
+TEST_CASE("Unit/Workloads/MultiLowPassFilterWorkload")
+{
+	SECTION("Order 1")
+	{
+		FilterHarness filter(order1_workloads);
+		check_response(filter, 0.03f); // one-pole only rolls off at 6 dB/octave
+	}
+
+	SECTION("Order 2")
+	{
+		FilterHarness filter(order2_workloads);
+		check_response(filter, 1e-4f);
+	}
+
+	SECTION("Order 4")
+	{
+		FilterHarness filter(order4_workloads);
+		check_response(filter, 1e-4f);
+	}
+
+	SECTION("A channel filters the same whatever its neighbours carry")
+	{
+		FilterHarness alone(order2_workloads);
+		alone.values->set_size(1);
+		(*alone.values)[0] = 0.0f;
+		alone.tick();
+
+		FilterHarness shared(order2_workloads);
+		shared.values->set_size(3);
+		(*shared.values)[0] = 0.0f;
+		(*shared.values)[1] = 5.0f;
+		(*shared.values)[2] = -5.0f;
+		shared.tick();
+
+		for (int i = 0; i < 50; ++i)
+		{
+			(*alone.values)[0] = 1.0f;
+			(*shared.values)[0] = 1.0f;
+			(*shared.values)[1] = (i % 2) ? 5.0f : -5.0f;
+			alone.tick();
+			shared.tick();
+			REQUIRE((*shared.result)[0] == Catch::Approx((*alone.result)[0]).margin(1e-6f));
+		}
+	}
+}
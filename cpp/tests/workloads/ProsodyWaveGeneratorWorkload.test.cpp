@@ -0,0 +1,168 @@
+// Copyright Robotick contributors
+// SPDX-License-Identifier: Apache-2.0
+
+#include "robotick/api.h"
+#include "robotick/framework/Engine.h"
+#include "robotick/framework/utils/TypeId.h"
+#include "robotick/systems/audio/AudioFrame.h"
+#include "robotick/systems/audio/AudioSystem.h"
+#include "robotick/systems/auditory/ProsodyState.h"
+
+#include "utils/WorkloadTestUtils.h"
+
+#include <catch2/catch_all.hpp>
+#include <cmath>
+
+namespace robotick
+{
+	void ensure_prosody_wave_generator_workload()
+	{
+		ROBOTICK_KEEP_WORKLOAD(ProsodyWaveGeneratorWorkload)
+	}
+
+} // namespace robotick
+
+using namespace robotick;
+using robotick::tests::find_field;
+
+namespace
+{
+	struct GeneratorHarness
+	{
+		void* inst_ptr = nullptr;
+		const WorkloadDescriptor* desc = nullptr;
+
+		ProsodyState* voice1 = nullptr;
+		ProsodyState* voice2 = nullptr;
+		const AudioFrame* mono = nullptr;
+		const int* active_voices = nullptr;
+
+		void bind(Engine& engine, const WorkloadSeed& seed)
+		{
+			const auto& info = *engine.find_instance_info(seed.unique_name);
+			inst_ptr = info.get_ptr(engine);
+			REQUIRE(inst_ptr != nullptr);
+			desc = info.type->get_workload_desc();
+			REQUIRE(desc != nullptr);
+
+			voice1 = find_field<ProsodyState>(inst_ptr, *desc, false, "prosody_state");
+			voice2 = find_field<ProsodyState>(inst_ptr, *desc, false, "prosody_state2");
+			mono = find_field<AudioFrame>(inst_ptr, *desc, true, "mono");
+			active_voices = find_field<int>(inst_ptr, *desc, true, "active_voices");
+			REQUIRE(voice1 != nullptr);
+			REQUIRE(voice2 != nullptr);
+			REQUIRE(mono != nullptr);
+			REQUIRE(active_voices != nullptr);
+
+			// No audio device is needed: the generator only reads the output sample rate.
+			AudioSystem::set_output_spec_for_test(44100, 1);
+			desc->start_fn(inst_ptr, 100.0f);
+		}
+
+		void tick(float delta_time)
+		{
+			TickInfo tick_info = TICK_INFO_FIRST_10MS_100HZ;
+			tick_info.delta_time = delta_time;
+			desc->tick_fn(inst_ptr, tick_info);
+		}
+
+		float peak() const
+		{
+			float result = 0.0f;
+			for (float sample : mono->samples)
+			{
+				result = robotick::max(result, fabsf(sample));
+			}
+			return result;
+		}
+	};
+
+	ProsodyState make_voiced(float pitch_hz, float rms)
+	{
+		ProsodyState prosody;
+		prosody.is_voiced = true;
+		prosody.pitch_hz = pitch_hz;
+		prosody.rms = rms;
+		return prosody;
+	}
+
+	// Pure tone only, no smoothing lag, so amplitudes are predictable.
+	static const FieldConfigEntry generator_config[] = {
+		{"num_voices", "2"},
+		{"enable_partials", "false"},
+		{"enable_noise", "false"},
+		{"mix_smooth_alpha", "1.0"},
+	};
+
+	static const WorkloadSeed generator_seed{TypeId("ProsodyWaveGeneratorWorkload"), StringView("generator"), 100.0f, {}, generator_config, {}};
+
+} // namespace
+
+TEST_CASE("Unit/Workloads/ProsodyWaveGeneratorWorkload")
+{
+	Model model;
+	static const WorkloadSeed* const workloads[] = {&generator_seed};
+	model.use_workload_seeds(workloads);
+	model.set_root_workload(generator_seed);
+
+	Engine engine;
+	engine.load(model);
+
+	GeneratorHarness generator;
+	generator.bind(engine, generator_seed);
+
+	SECTION("Gated voices emit a full frame of silence; open voices follow the sample clock")
+	{
+		generator.tick(0.01f);
+		CHECK(generator.mono->samples.size() == generator.mono->samples.capacity());
+		CHECK(*generator.active_voices == 0);
+		CHECK(generator.peak() == 0.0f);
+
+		*generator.voice1 = make_voiced(220.0f, 0.5f);
+		generator.tick(0.01f);
+		CHECK(generator.mono->samples.size() == 441);
+		CHECK(*generator.active_voices == 1);
+		CHECK(generator.peak() > 0.0f);
+
+		// Gating off again releases the voice with a short tail inside a full-capacity frame.
+		generator.voice1->is_voiced = false;
+		generator.tick(0.01f);
+		REQUIRE(generator.mono->samples.size() == generator.mono->samples.capacity());
+		CHECK(*generator.active_voices == 0);
+		for (size_t i = 64; i < generator.mono->samples.size(); ++i)
+		{
+			CHECK(generator.mono->samples[i] == 0.0f);
+		}
+	}
+
+	SECTION("A tick with no samples due still emits a full frame")
+	{
+		*generator.voice1 = make_voiced(220.0f, 0.5f);
+		generator.tick(0.01f);
+
+		generator.tick(0.0f);
+		REQUIRE(generator.mono->samples.size() == generator.mono->samples.capacity());
+		for (size_t i = 16; i < generator.mono->samples.size(); ++i)
+		{
+			CHECK(generator.mono->samples[i] == 0.0f);
+		}
+	}
+
+	SECTION("Overlapping voices add up and the mix is clipped to full scale")
+	{
+		// Identical voices start in phase, so the mix is exactly twice one voice.
+		*generator.voice1 = make_voiced(220.0f, 0.3f);
+		*generator.voice2 = make_voiced(220.0f, 0.3f);
+		generator.tick(0.01f);
+		generator.tick(0.01f);
+		CHECK(*generator.active_voices == 2);
+		CHECK(generator.peak() == Catch::Approx(0.6f).margin(0.01f));
+
+		// Two loud voices would reach 1.6 - clipped.
+		generator.voice1->rms = 0.8f;
+		generator.voice2->rms = 0.8f;
+		generator.tick(0.01f);
+		generator.tick(0.01f);
+		CHECK(generator.peak() == 1.0f);
+	}
+}
@@ -0,0 +1,185 @@
+// Copyright Robotick contributors
+// SPDX-License-Identifier: Apache-2.0
+
+#include "robotick/api.h"
+#include "robotick/framework/Engine.h"
+#include "robotick/framework/utils/TypeId.h"
+
+#include "utils/WorkloadTestUtils.h"
+
+#include <catch2/catch_all.hpp>
+#include <cmath>
+
+namespace robotick
+{
+	void ensure_quat_batch_convert_workload()
+	{
+		ROBOTICK_KEEP_WORKLOAD(QuatBatchConvertWorkload)
+	}
+
+} // namespace robotick
+
+using namespace robotick;
+using robotick::tests::find_field;
+
+namespace
+{
+	static constexpr size_t kBatchSize = 32; // matches QuatBatchConvertWorkload's kMaxQuatBatch
+
+	using QuatBatch = FixedVector<Quatf, kBatchSize>;
+	using Vec3Batch = FixedVector<Vec3f, kBatchSize>;
+
+	// Unit quaternion for intrinsic Z-Y-X (yaw, pitch, roll) angles.
+	Quatf quat_from_euler(double roll, double pitch, double yaw)
+	{
+		const double cr = std::cos(roll * 0.5), sr = std::sin(roll * 0.5);
+		const double cp = std::cos(pitch * 0.5), sp = std::sin(pitch * 0.5);
+		const double cy = std::cos(yaw * 0.5), sy = std::sin(yaw * 0.5);
+
+		Quatf q;
+		q.w = static_cast<float>(cr * cp * cy + sr * sp * sy);
+		q.x = static_cast<float>(sr * cp * cy - cr * sp * sy);
+		q.y = static_cast<float>(cr * sp * cy + sr * cp * sy);
+		q.z = static_cast<float>(cr * cp * sy - sr * sp * cy);
+		return q;
+	}
+
+	// Reference angles from the same float atan2/asin arguments the workload builds, evaluated by libm in
+	// double - so any difference is the approximation's alone, not float rounding of the arguments.
+	Vec3f reference_euler(const Quatf& q)
+	{
+		const float sinp = robotick::clamp(2.0f * (q.w * q.y - q.z * q.x), -1.0f, 1.0f);
+		Vec3f euler;
+		euler.x = static_cast<float>(std::atan2(double(2.0f * (q.w * q.x + q.y * q.z)), double(1.0f - 2.0f * (q.x * q.x + q.y * q.y))));
+		euler.y = static_cast<float>(std::asin(double(sinp)));
+		euler.z = static_cast<float>(std::atan2(double(2.0f * (q.w * q.z + q.x * q.y)), double(1.0f - 2.0f * (q.y * q.y + q.z * q.z))));
+		return euler;
+	}
+
+	double reference_rotation_angle(const Quatf& q)
+	{
+		const double sin_half = std::sqrt(double(q.x * q.x + q.y * q.y + q.z * q.z));
+		return 2.0 * std::atan2(sin_half, std::fabs(double(q.w)));
+	}
+
+	// Angle error with +/-pi treated as the same angle (atan2's branch cut).
+	double angle_error(double a, double b)
+	{
+		const double d = std::fabs(a - b);
+		return robotick::min(d, 2.0 * M_PI - d);
+	}
+
+	static const FieldConfigEntry fast_trig_config[] = {
+		{"output_euler", "true"},
+		{"output_rotation_vectors", "true"},
+		{"fast_trig", "true"},
+	};
+
+	static const WorkloadSeed fast_trig_seed{TypeId("QuatBatchConvertWorkload"), StringView("quat_batch"), 100.0f, {}, fast_trig_config, {}};
+
+} // namespace
+
+TEST_CASE("Unit/Workloads/QuatBatchConvertWorkload")
+{
+	Model model;
+	static const WorkloadSeed* const workloads[] = {&fast_trig_seed};
+	model.use_workload_seeds(workloads);
+	model.set_root_workload(fast_trig_seed);
+
+	Engine engine;
+	engine.load(model);
+
+	const auto& info = *engine.find_instance_info(fast_trig_seed.unique_name);
+	void* inst_ptr = info.get_ptr(engine);
+	REQUIRE(inst_ptr != nullptr);
+	const WorkloadDescriptor* desc = info.type->get_workload_desc();
+	REQUIRE(desc != nullptr);
+
+	QuatBatch* quats = find_field<QuatBatch>(inst_ptr, *desc, false, "quats");
+	const Vec3Batch* euler = find_field<Vec3Batch>(inst_ptr, *desc, true, "euler");
+	const Vec3Batch* rotation_vectors = find_field<Vec3Batch>(inst_ptr, *desc, true, "rotation_vectors");
+	REQUIRE(quats != nullptr);
+	REQUIRE(euler != nullptr);
+	REQUIRE(rotation_vectors != nullptr);
+
+	SECTION("fast_trig stays within 1e-5 rad of libm across the sphere")
+	{
+		// Roll and yaw wrap the full circle; pitch stops short of +/-90 degrees, where roll and yaw are
+		// undefined (gimbal lock) and a one-ulp change in the arguments swings them arbitrarily.
+		static constexpr int kAxisSteps = 24;
+		static constexpr int kPitchSteps = 18;
+		const double pitch_limit = 85.0 * M_PI / 180.0;
+
+		QuatBatch batch_inputs;
+		double max_euler_error = 0.0;
+		double max_rotation_error = 0.0;
+
+		auto convert_batch = [&]()
+		{
+			*quats = batch_inputs;
+			desc->tick_fn(inst_ptr, TICK_INFO_FIRST_10MS_100HZ);
+			REQUIRE(euler->size() == batch_inputs.size());
+			REQUIRE(rotation_vectors->size() == batch_inputs.size());
+
+			for (size_t i = 0; i < batch_inputs.size(); ++i)
+			{
+				const Quatf& q = batch_inputs[i];
+				const Vec3f expected = reference_euler(q);
+				max_euler_error = robotick::max(max_euler_error, angle_error((*euler)[i].x, expected.x));
+				max_euler_error = robotick::max(max_euler_error, angle_error((*euler)[i].y, expected.y));
+				max_euler_error = robotick::max(max_euler_error, angle_error((*euler)[i].z, expected.z));
+
+				const Vec3f& rv = (*rotation_vectors)[i];
+				const double angle = std::sqrt(double(rv.x * rv.x + rv.y * rv.y + rv.z * rv.z));
+				max_rotation_error = robotick::max(max_rotation_error, std::fabs(angle - reference_rotation_angle(q)));
+			}
+			batch_inputs.set_size(0);
+		};
+
+		for (int r = 0; r < kAxisSteps; ++r)
+		{
+			for (int p = 0; p <= kPitchSteps; ++p)
+			{
+				for (int y = 0; y < kAxisSteps; ++y)
+				{
+					const double roll = -M_PI + 2.0 * M_PI * r / kAxisSteps;
+					const double pitch = -pitch_limit + 2.0 * pitch_limit * p / kPitchSteps;
+					const double yaw = -M_PI + 2.0 * M_PI * y / kAxisSteps;
+					batch_inputs.add(quat_from_euler(roll, pitch, yaw));
+					if (batch_inputs.size() == kBatchSize)
+					{
+						convert_batch();
+					}
+				}
+			}
+		}
+		if (!batch_inputs.empty())
+		{
+			convert_batch();
+		}
+
+		CHECK(max_euler_error <= 1e-5);
+		// The rotation angle is 2 * atan2(...), so it carries twice the atan2 error.
+		CHECK(max_rotation_error <= 2e-5);
+	}
+
+	SECTION("fast_trig asin holds its bound right up to gimbal lock")
+	{
+		// Pure pitch rotations sweep asin's argument over [-1, 1], including the endpoints.
+		static constexpr int kSteps = 31;
+		QuatBatch batch_inputs;
+		for (int i = 0; i <= kSteps; ++i)
+		{
+			batch_inputs.add(quat_from_euler(0.0, -0.5 * M_PI + M_PI * i / kSteps, 0.0));
+		}
+
+		*quats = batch_inputs;
+		desc->tick_fn(inst_ptr, TICK_INFO_FIRST_10MS_100HZ);
+		REQUIRE(euler->size() == batch_inputs.size());
+
+		for (size_t i = 0; i < batch_inputs.size(); ++i)
+		{
+			CHECK(angle_error((*euler)[i].y, reference_euler(batch_inputs[i]).y) <= 1e-5);
+		}
+	}
+}
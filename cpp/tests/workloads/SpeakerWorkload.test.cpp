@@ -0,0 +1,131 @@
+// Copyright Robotick contributors
+// SPDX-License-Identifier: Apache-2.0
+
+#include "robotick/api.h"
+#include "robotick/framework/Engine.h"
+#include "robotick/framework/utils/TypeId.h"
+#include "robotick/systems/audio/AudioFrame.h"
+#include "robotick/systems/audio/AudioSystem.h"
+
+#include "utils/WorkloadTestUtils.h"
+
+#include <catch2/catch_all.hpp>
+
+namespace robotick
+{
+	void ensure_speaker_workload()
+	{
+		ROBOTICK_KEEP_WORKLOAD(SpeakerWorkload)
+	}
+
+} // namespace robotick
+
+using namespace robotick;
+using robotick::tests::find_field;
+
+namespace
+{
+	static constexpr size_t kFrames = 64;
+
+	void fill_frame(AudioFrame& frame, size_t num_samples, float value)
+	{
+		frame.sample_rate = AudioSystem::get_sample_rate();
+		frame.samples.set_size(num_samples);
+		for (float& sample : frame.samples)
+		{
+			sample = value;
+		}
+	}
+
+	// Captures what the speaker queues on a test device of the given channel count, instead of playing it.
+	struct CapturedOutput
+	{
+		float samples[kFrames * 2] = {};
+
+		explicit CapturedOutput(uint8_t channels)
+		{
+			AudioSystem::set_output_spec_for_test(44100, channels);
+			AudioSystem::set_output_capture_for_test(samples, kFrames * 2);
+		}
+
+		~CapturedOutput()
+		{
+			AudioSystem::set_output_capture_for_test(nullptr, 0);
+			AudioSystem::shutdown();
+		}
+
+		size_t count() const { return AudioSystem::get_captured_samples_for_test(); }
+	};
+
+	static const WorkloadSeed speaker_seed{TypeId("SpeakerWorkload"), StringView("speaker"), 100.0f, {}, {}, {}};
+
+} // namespace
+
+TEST_CASE("Unit/Workloads/SpeakerWorkload")
+{
+	Model model;
+	static const WorkloadSeed* const workloads[] = {&speaker_seed};
+	model.use_workload_seeds(workloads);
+	model.set_root_workload(speaker_seed);
+
+	Engine engine;
+	engine.load(model);
+
+	const auto& info = *engine.find_instance_info(speaker_seed.unique_name);
+	void* inst_ptr = info.get_ptr(engine);
+	REQUIRE(inst_ptr != nullptr);
+	const WorkloadDescriptor* desc = info.type->get_workload_desc();
+	REQUIRE(desc != nullptr);
+
+	AudioFrame* left = find_field<AudioFrame>(inst_ptr, *desc, false, "left");
+	AudioFrame* right = find_field<AudioFrame>(inst_ptr, *desc, false, "right");
+	REQUIRE(left != nullptr);
+	REQUIRE(right != nullptr);
+
+	SECTION("A lone side plays at full level on a mono device")
+	{
+		CapturedOutput output(1);
+
+		fill_frame(*left, kFrames, 0.5f);
+		right->samples.set_size(0);
+		desc->tick_fn(inst_ptr, TICK_INFO_FIRST_10MS_100HZ);
+		REQUIRE(output.count() == kFrames);
+		for (size_t i = 0; i < kFrames; ++i)
+			CHECK(output.samples[i] == 0.5f);
+
+		AudioSystem::set_output_capture_for_test(output.samples, kFrames * 2);
+		left->samples.set_size(0);
+		fill_frame(*right, kFrames, -0.25f);
+		desc->tick_fn(inst_ptr, TICK_INFO_FIRST_10MS_100HZ);
+		REQUIRE(output.count() == kFrames);
+		for (size_t i = 0; i < kFrames; ++i)
+			CHECK(output.samples[i] == -0.25f);
+	}
+
+	SECTION("Both sides fold to their average on a mono device")
+	{
+		CapturedOutput output(1);
+
+		fill_frame(*left, kFrames, 0.5f);
+		fill_frame(*right, kFrames, 0.25f);
+		desc->tick_fn(inst_ptr, TICK_INFO_FIRST_10MS_100HZ);
+		REQUIRE(output.count() == kFrames);
+		for (size_t i = 0; i < kFrames; ++i)
+			CHECK(output.samples[i] == Catch::Approx(0.375f));
+	}
+
+	SECTION("A lone side stays on its own channel of a stereo device")
+	{
+		CapturedOutput output(2);
+
+		left->samples.set_size(0);
+		fill_frame(*right, kFrames, 0.5f);
+		desc->tick_fn(inst_ptr, TICK_INFO_FIRST_10MS_100HZ);
+		REQUIRE(output.count() == kFrames * 2);
+		for (size_t i = 0; i < kFrames; ++i)
+		{
+			CHECK(output.samples[2 * i + 0] == 0.0f);
+			CHECK(output.samples[2 * i + 1] == 0.5f);
+		}
+	}
+}
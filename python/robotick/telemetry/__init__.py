@@ -0,0 +1,3 @@
+from .shared_telemetry import SharedTelemetryReader
+
+__all__ = ["SharedTelemetryReader"]
@@ -0,0 +1,139 @@
+"""Reader for the shared-memory telemetry segment written by SharedTelemetryWorkload.
+
+The layout is defined in cpp/include/robotick/systems/SharedTelemetryFormat.h:
+[header][field descriptors][snapshot data], with the snapshot guarded by a seqlock.
+
+    reader = SharedTelemetryReader("/robotick_telemetry")
+    timestamp_ns, values = reader.read()
+    print(values["my_workload.outputs.speed"])
+"""
+
+import mmap
+import os
+import struct
+import time
+
+MAGIC = 0x4D545452
+VERSION = 1
+FLAG_WRITER_ATTACHED = 0x1
+
+# Must match RobotickSharedTelemetryHeader / RobotickSharedTelemetryField.
+_HEADER_LAYOUT = (
+    ("magic", "I"),
+    ("version", "H"),
+    ("header_size", "H"),
+    ("flags", "I"),
+    ("writer_pid", "I"),
+    ("field_count", "I"),
+    ("fields_offset", "I"),
+    ("data_offset", "I"),
+    ("data_size", "I"),
+    ("sequence", "I"),
+    ("reserved0", "I"),
+    ("timestamp_ns", "Q"),
+    ("publish_count", "Q"),
+    ("reserved1", "Q"),
+)
+_HEADER = struct.Struct("<" + "".join(fmt for _, fmt in _HEADER_LAYOUT))
+_FIELD = struct.Struct("<112sIIB7x")
+
+
+def _header_offset(name):
+    names = [field_name for field_name, _ in _HEADER_LAYOUT]
+    return struct.calcsize("<" + "".join(fmt for _, fmt in _HEADER_LAYOUT[: names.index(name)]))
+
+
+HEADER_OFFSETS = {name: _header_offset(name) for name, _ in _HEADER_LAYOUT}
+_FLAGS_OFFSET = HEADER_OFFSETS["flags"]
+_SEQUENCE_OFFSET = HEADER_OFFSETS["sequence"]
+_TIMESTAMP_OFFSET = HEADER_OFFSETS["timestamp_ns"]
+
+assert _HEADER.size == 64, "RobotickSharedTelemetryHeader is 64 bytes"
+assert _FIELD.size == 128, "RobotickSharedTelemetryField is 128 bytes"
+
+# RobotickSharedTelemetryKind -> struct format (None = decoded specially)
+_KIND_FORMATS = {
+    1: "<i",  # INT32
+    2: "<B",  # UINT8
+    3: "<H",  # UINT16
+    4: "<I",  # UINT32
+    5: "<f",  # FLOAT32
+    6: "<d",  # FLOAT64
+    7: "<?",  # BOOL
+}
+_KIND_STRING = 8
+
+
+class SharedTelemetryField:
+    def __init__(self, path, offset, size, kind):
+        self.path = path
+        self.offset = offset
+        self.size = size
+        self.kind = kind
+
+    def decode(self, snapshot):
+        raw = snapshot[self.offset : self.offset + self.size]
+        fmt = _KIND_FORMATS.get(self.kind)
+        if fmt is not None:
+            return struct.unpack(fmt, raw)[0]
+        if self.kind == _KIND_STRING:
+            return raw.split(b"\0", 1)[0].decode("utf-8", errors="replace")
+        return bytes(raw)
+
+
+class SharedTelemetryReader:
+    """Maps a telemetry segment read-only and decodes consistent snapshots of it."""
+
+    def __init__(self, segment_name="/robotick_telemetry", shm_dir="/dev/shm"):
+        path = os.path.join(shm_dir, segment_name.lstrip("/"))
+        with open(path, "rb") as segment_file:
+            self._map = mmap.mmap(segment_file.fileno(), 0, prot=mmap.PROT_READ)
+
+        header = dict(zip((name for name, _ in _HEADER_LAYOUT), _HEADER.unpack_from(self._map, 0)))
+        if header["magic"] != MAGIC or header["version"] != VERSION:
+            self._map.close()
+            raise ValueError(f"{path} is not a robotick telemetry segment (v{VERSION})")
+
+        self.writer_pid = header["writer_pid"]
+        self._data_offset = header["data_offset"]
+        self._data_size = header["data_size"]
+
+        self.fields = {}
+        for index in range(header["field_count"]):
+            raw_path, offset, size, kind = _FIELD.unpack_from(self._map, header["fields_offset"] + index * _FIELD.size)
+            field_path = raw_path.split(b"\0", 1)[0].decode("utf-8")
+            self.fields[field_path] = SharedTelemetryField(field_path, offset, size, kind)
+
+    def close(self):
+        self._map.close()
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, *_):
+        self.close()
+
+    def is_writer_attached(self):
+        flags = struct.unpack_from("<I", self._map, _FLAGS_OFFSET)[0]
+        return (flags & FLAG_WRITER_ATTACHED) != 0
+
+    def read_raw(self, max_attempts=100):
+        """Returns (timestamp_ns, snapshot bytes), retrying while the writer is mid-update."""
+        begin_data = self._data_offset
+        end_data = begin_data + self._data_size
+        for _ in range(max_attempts):
+            begin = struct.unpack_from("<I", self._map, _SEQUENCE_OFFSET)[0]
+            if begin & 1:
+                time.sleep(0)
+                continue
+            snapshot = self._map[begin_data:end_data]
+            timestamp_ns = struct.unpack_from("<Q", self._map, _TIMESTAMP_OFFSET)[0]
+            if struct.unpack_from("<I", self._map, _SEQUENCE_OFFSET)[0] == begin:
+                return timestamp_ns, snapshot
+        raise TimeoutError("no consistent telemetry snapshot (writer updating too often?)")
+
+    def read(self, paths=None, max_attempts=100):
+        """Returns (timestamp_ns, {path: value}) for all fields, or just the given paths."""
+        timestamp_ns, snapshot = self.read_raw(max_attempts)
+        selected = self.fields.values() if paths is None else (self.fields[path] for path in paths)
+        return timestamp_ns, {field.path: field.decode(snapshot) for field in selected}
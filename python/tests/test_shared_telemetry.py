@@ -0,0 +1,135 @@
+"""Checks the Python telemetry reader against the C layout in SharedTelemetryFormat.h.
+
+Run with: python -m unittest discover -s python/tests
+"""
+
+import os
+import shutil
+import struct
+import subprocess
+import sys
+import tempfile
+import unittest
+
+sys.path.insert(0, os.path.join(os.path.dirname(__file__), ".."))
+
+from robotick.telemetry import shared_telemetry  # noqa: E402
+from robotick.telemetry.shared_telemetry import SharedTelemetryReader  # noqa: E402
+
+_FORMAT_HEADER = os.path.join(
+    os.path.dirname(__file__), "..", "..", "cpp", "include", "robotick", "systems", "SharedTelemetryFormat.h"
+)
+
+_LAYOUT_PROGRAM = r"""
+#include <stddef.h>
+#include <stdio.h>
+#include "SharedTelemetryFormat.h"
+#define PRINT_OFFSET(member) printf(#member " %zu\n", offsetof(RobotickSharedTelemetryHeader, member))
+int main(void)
+{
+	printf("header_size %zu\n", sizeof(RobotickSharedTelemetryHeader));
+	printf("field_size %zu\n", sizeof(RobotickSharedTelemetryField));
+	printf("field_offset %zu\n", offsetof(RobotickSharedTelemetryField, offset));
+	printf("field_kind %zu\n", offsetof(RobotickSharedTelemetryField, kind));
+	PRINT_OFFSET(magic); PRINT_OFFSET(version); PRINT_OFFSET(flags); PRINT_OFFSET(writer_pid);
+	PRINT_OFFSET(field_count); PRINT_OFFSET(fields_offset); PRINT_OFFSET(data_offset); PRINT_OFFSET(data_size);
+	PRINT_OFFSET(sequence); PRINT_OFFSET(timestamp_ns); PRINT_OFFSET(publish_count);
+	return 0;
+}
+"""
+
+
+def build_segment(path, fields, sequence=2, timestamp_ns=1234, flags=shared_telemetry.FLAG_WRITER_ATTACHED):
+    """Writes a segment the way SharedTelemetryWriter lays it out. fields: [(path, kind, packed bytes)]"""
+    fields_offset = 64
+    data_offset = fields_offset + len(fields) * 128
+    data = b""
+    descriptors = b""
+    for field_path, kind, packed in fields:
+        descriptors += shared_telemetry._FIELD.pack(field_path.encode(), len(data), len(packed), kind)
+        data += packed + b"\0" * (-len(packed) % 8)
+
+    header = shared_telemetry._HEADER.pack(
+        shared_telemetry.MAGIC,
+        shared_telemetry.VERSION,
+        64,
+        flags,
+        os.getpid(),
+        len(fields),
+        fields_offset,
+        data_offset,
+        len(data),
+        sequence,
+        0,
+        timestamp_ns,
+        sequence // 2,
+        0,
+    )
+    with open(path, "wb") as segment_file:
+        segment_file.write(header + descriptors + data)
+
+
+class SharedTelemetryLayoutTest(unittest.TestCase):
+    def test_struct_sizes_and_offsets(self):
+        self.assertEqual(shared_telemetry._HEADER.size, 64)
+        self.assertEqual(shared_telemetry._FIELD.size, 128)
+        self.assertEqual(shared_telemetry.HEADER_OFFSETS["flags"], 8)
+        self.assertEqual(shared_telemetry.HEADER_OFFSETS["sequence"], 32)
+        self.assertEqual(shared_telemetry.HEADER_OFFSETS["timestamp_ns"], 40)
+
+    @unittest.skipUnless(shutil.which("cc"), "needs a C compiler")
+    def test_matches_c_structs(self):
+        with tempfile.TemporaryDirectory() as work_dir:
+            source = os.path.join(work_dir, "layout.c")
+            binary = os.path.join(work_dir, "layout")
+            with open(source, "w") as source_file:
+                source_file.write(_LAYOUT_PROGRAM)
+            include_dir = os.path.dirname(os.path.abspath(_FORMAT_HEADER))
+            subprocess.run(["cc", "-std=c99", "-I", include_dir, source, "-o", binary], check=True)
+            output = subprocess.run([binary], check=True, capture_output=True, text=True).stdout
+
+        c_layout = dict((name, int(value)) for name, value in (line.split() for line in output.splitlines()))
+        self.assertEqual(c_layout.pop("header_size"), shared_telemetry._HEADER.size)
+        self.assertEqual(c_layout.pop("field_size"), shared_telemetry._FIELD.size)
+        self.assertEqual(c_layout.pop("field_offset"), struct.calcsize("<112s"))
+        self.assertEqual(c_layout.pop("field_kind"), struct.calcsize("<112sII"))
+        for name, offset in c_layout.items():
+            self.assertEqual(shared_telemetry.HEADER_OFFSETS[name], offset, name)
+
+
+class SharedTelemetryReaderTest(unittest.TestCase):
+    def setUp(self):
+        self.shm_dir = tempfile.mkdtemp()
+        self.fields = [
+            ("W.outputs.count", 1, struct.pack("<i", -7)),
+            ("W.outputs.gain", 5, struct.pack("<f", 0.5)),
+            ("W.outputs.label", 8, b"ready\0\0\0"),
+        ]
+
+    def tearDown(self):
+        shutil.rmtree(self.shm_dir)
+
+    def open_reader(self, **segment_args):
+        build_segment(os.path.join(self.shm_dir, "telemetry"), self.fields, **segment_args)
+        return SharedTelemetryReader("/telemetry", shm_dir=self.shm_dir)
+
+    def test_reads_consistent_snapshot(self):
+        with self.open_reader() as reader:
+            self.assertTrue(reader.is_writer_attached())
+            self.assertEqual(sorted(reader.fields), ["W.outputs.count", "W.outputs.gain", "W.outputs.label"])
+            timestamp_ns, values = reader.read()
+            self.assertEqual(timestamp_ns, 1234)
+            self.assertEqual(values, {"W.outputs.count": -7, "W.outputs.gain": 0.5, "W.outputs.label": "ready"})
+
+    def test_refuses_snapshot_while_writer_is_updating(self):
+        with self.open_reader(sequence=3) as reader:
+            with self.assertRaises(TimeoutError):
+                reader.read(max_attempts=3)
+
+    def test_reports_detached_writer(self):
+        with self.open_reader(flags=0) as reader:
+            self.assertFalse(reader.is_writer_attached())
+
+
+if __name__ == "__main__":
+    unittest.main()